@@ -164,7 +164,7 @@ public class FrontendTest {
 
             UIntPtr battle = UIntPtr.Zero;
             fixed (byte* bufferPtr = buffer) {
-                battle = Bindings.FRONTEND_CreateBattle(512, false);
+                battle = Bindings.FRONTEND_CreateBattle(512, false, 0);
                 _logger.WriteLine($"Created battle at pointer addr = 0x{battle:x}");
                 uint selfJoinIndex = 1;
                 string selfPlayerId = "foobar";
@@ -11,6 +11,17 @@ add_executable(BackendTest ${BACKEND_TEST_SRC_FILES})
 
 target_compile_definitions(BackendTest PRIVATE JPH_SHARED_LIBRARY) # [IMPORTANT] For correctly define the macro "JPH_EXPORT" as "__declspec(dllimport)"
 #target_compile_definitions(BackendTest PRIVATE JPH_ENABLE_ASSERTS)
+
+# For "runTestCase9" to enumerate the fields of the LITE_RUNTIME messages by reflection
+set(BACKEND_TEST_PB_DESC ${CMAKE_CURRENT_BINARY_DIR}/serializable_data.desc)
+add_custom_command(
+    OUTPUT ${BACKEND_TEST_PB_DESC}
+    COMMAND ${Protobuf_PROTOC_EXECUTABLE} --descriptor_set_out=${BACKEND_TEST_PB_DESC} -I ${JOLT_BINDINGS_ROOT} ${JOLT_BINDINGS_ROOT}/serializable_data.proto
+    DEPENDS ${JOLT_BINDINGS_ROOT}/serializable_data.proto
+)
+add_custom_target(BackendTestPbDesc DEPENDS ${BACKEND_TEST_PB_DESC})
+add_dependencies(BackendTest BackendTestPbDesc)
+target_compile_definitions(BackendTest PRIVATE SERIALIZABLE_DATA_DESC_PATH="${BACKEND_TEST_PB_DESC}")
 target_link_libraries(BackendTest LINK_PUBLIC ${TARGET_NAME})
 if(USE_STATIC_PB) 
     target_link_libraries(BackendTest PRIVATE 
@@ -5,6 +5,8 @@
 #include <chrono>
 #include <fstream>
 #include <filesystem>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
 
 google::protobuf::Arena pbTestCaseDataAllocator;
 
@@ -478,6 +480,377 @@ bool runTestCase6(BackendBattle* reusedBattle, WsReq* initializerMapData) {
     return true;
 }
 
+bool runTestCase7(BackendBattle* reusedBattle, WsReq* initializerMapData) {
+    // Drives "DrainUpsyncInputs" directly: merging of consecutive "ifdId"s, interleaved players, the "[int32_t bytesCnt][bytes]" framing and stopping at an unfit "DownsyncSnapshot".
+    reusedBattle->ResetStartRdf(initializerMapData);
+    DownsyncSnapshot* downsyncSnapshotHolder = google::protobuf::Arena::Create<DownsyncSnapshot>(&pbTestCaseDataAllocator);
+    bool enqueued = false, parsed = false, taken = false;
+
+    // Queue order: A0 A1 A2 B0 B1 A3 B2, i.e. applied as batches [A0, A2], [B0, B1], [A3], [B2]
+    enqueued = reusedBattle->EnqueueUpsyncInput(1, 0, 16, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(1, 1, 16, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(1, 2, 16, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(2, 0, 0, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(2, 1, 0, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(1, 3, 16, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(2, 2, 0, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(0, 3, 0, true, false);
+    JPH_ASSERT(!enqueued); // Invalid "joinIndex"
+
+    long outBytesCnt = pbBufferSizeLimit;
+    memset(downsyncSnapshotByteBuffer, 0, sizeof(downsyncSnapshotByteBuffer));
+    int drainedCnt = reusedBattle->DrainUpsyncInputs(downsyncSnapshotByteBuffer, &outBytesCnt);
+    JPH_ASSERT(7 == drainedCnt && 0 < outBytesCnt);
+
+    // Exactly 2 frames, i.e. "B0, B1" were merged into a single "UpsyncSnapshot" instead of producing 1 "DownsyncSnapshot" each
+    const int expectedStIfdIds[] = { 0, 2 };
+    const int expectedBatchSizes[] = { 2, 1 };
+    int framesCnt = 0;
+    long offset = 0;
+    while (offset < outBytesCnt) {
+        int32_t bytesCnt = 0;
+        memcpy(&bytesCnt, downsyncSnapshotByteBuffer + offset, sizeof(int32_t));
+        offset += sizeof(int32_t);
+        JPH_ASSERT(0 < bytesCnt && offset + bytesCnt <= outBytesCnt);
+        JPH_ASSERT(2 > framesCnt);
+        parsed = downsyncSnapshotHolder->ParseFromArray(downsyncSnapshotByteBuffer + offset, bytesCnt);
+        JPH_ASSERT(parsed);
+        JPH_ASSERT(expectedStIfdIds[framesCnt] == downsyncSnapshotHolder->st_ifd_id() && expectedBatchSizes[framesCnt] == downsyncSnapshotHolder->ifd_batch_size());
+        offset += bytesCnt;
+        ++framesCnt;
+    }
+    JPH_ASSERT(2 == framesCnt && offset == outBytesCnt);
+    JPH_ASSERT(2 == reusedBattle->lcacIfdId && 0 == reusedBattle->GetUnfitDownsyncSnapshotSize());
+
+    outBytesCnt = pbBufferSizeLimit;
+    drainedCnt = reusedBattle->DrainUpsyncInputs(downsyncSnapshotByteBuffer, &outBytesCnt);
+    JPH_ASSERT(0 == drainedCnt && 0 == outBytesCnt);
+
+    // Queue order: A4 B3 A5 B4 with too small a buffer, the "DownsyncSnapshot" of [B3] is kept and "A5" is carried
+    enqueued = reusedBattle->EnqueueUpsyncInput(1, 4, 16, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(2, 3, 0, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(1, 5, 16, true, false);
+    JPH_ASSERT(enqueued);
+    enqueued = reusedBattle->EnqueueUpsyncInput(2, 4, 0, true, false);
+    JPH_ASSERT(enqueued);
+    outBytesCnt = 8;
+    drainedCnt = reusedBattle->DrainUpsyncInputs(downsyncSnapshotByteBuffer, &outBytesCnt);
+    JPH_ASSERT(2 == drainedCnt && 0 == outBytesCnt && 3 == reusedBattle->lcacIfdId);
+    long unfitBytesCnt = reusedBattle->GetUnfitDownsyncSnapshotSize();
+    JPH_ASSERT(8 - (long)sizeof(int32_t) < unfitBytesCnt);
+
+    // Nothing is drained till the kept one is taken
+    outBytesCnt = pbBufferSizeLimit;
+    drainedCnt = reusedBattle->DrainUpsyncInputs(downsyncSnapshotByteBuffer, &outBytesCnt);
+    JPH_ASSERT(0 == drainedCnt && 0 == outBytesCnt);
+    outBytesCnt = 1;
+    taken = reusedBattle->TakeUnfitDownsyncSnapshot(downsyncSnapshotByteBuffer, &outBytesCnt);
+    JPH_ASSERT(!taken && unfitBytesCnt == outBytesCnt);
+    outBytesCnt = pbBufferSizeLimit;
+    taken = reusedBattle->TakeUnfitDownsyncSnapshot(downsyncSnapshotByteBuffer, &outBytesCnt);
+    JPH_ASSERT(taken && unfitBytesCnt == outBytesCnt);
+    parsed = downsyncSnapshotHolder->ParseFromArray(downsyncSnapshotByteBuffer, outBytesCnt);
+    JPH_ASSERT(parsed);
+    JPH_ASSERT(3 == downsyncSnapshotHolder->st_ifd_id() && 1 == downsyncSnapshotHolder->ifd_batch_size()); // [3]
+    JPH_ASSERT(0 == reusedBattle->GetUnfitDownsyncSnapshotSize());
+
+    // The carried "A5" is applied first
+    outBytesCnt = pbBufferSizeLimit;
+    drainedCnt = reusedBattle->DrainUpsyncInputs(downsyncSnapshotByteBuffer, &outBytesCnt);
+    JPH_ASSERT(2 == drainedCnt && 0 < outBytesCnt && 4 == reusedBattle->lcacIfdId);
+    int32_t bytesCnt = 0;
+    memcpy(&bytesCnt, downsyncSnapshotByteBuffer, sizeof(int32_t));
+    JPH_ASSERT((long)sizeof(int32_t) + bytesCnt == outBytesCnt);
+    parsed = downsyncSnapshotHolder->ParseFromArray(downsyncSnapshotByteBuffer + sizeof(int32_t), bytesCnt);
+    JPH_ASSERT(parsed);
+    JPH_ASSERT(4 == downsyncSnapshotHolder->st_ifd_id() && 1 == downsyncSnapshotHolder->ifd_batch_size()); // [4]
+
+    std::cout << "Passed TestCase7\n" << std::endl;
+    reusedBattle->Clear();   
+    return true;
+}
+
+bool runTestCase8(BackendBattle* reusedBattle, WsReq* initializerMapData) {
+    // Same inputs as TestCase5, but "ifdBuffer" is allowed to grow instead of force-confirming the lagging player.
+    reusedBattle->ResetStartRdf(initializerMapData);
+    DownsyncSnapshot* downsyncSnapshotHolder = google::protobuf::Arena::Create<DownsyncSnapshot>(&pbTestCaseDataAllocator);
+    int maxPlayerInputFrontId = 0, minPlayerInputFrontId = 0;
+
+    const int oldN = reusedBattle->ifdBuffer.N;
+    JPH_ASSERT(600 >= oldN); // Otherwise "A2" below wouldn't lag "B1" past "ifdBuffer.N"
+    const int sizeCap = 2*oldN;
+    reusedBattle->SetIfdBufferSizeCap(sizeCap);
+
+    long outBytesCnt = pbBufferSizeLimit;
+
+    auto reqA1 = google::protobuf::Arena::Create<WsReq>(&pbTestCaseDataAllocator);
+    reqA1->set_join_index(1);
+    auto a1 = reqA1->mutable_upsync_snapshot();
+    a1->set_st_ifd_id(0);
+    for (int ifdId = 0; ifdId <= 2; ifdId++) {
+        a1->add_cmd_list(16);
+    }
+    memset(downsyncSnapshotByteBuffer, 0, sizeof(downsyncSnapshotByteBuffer));
+    bool upserted = reusedBattle->OnUpsyncSnapshotReceived(reqA1->join_index(), reqA1->upsync_snapshot(), true, false, downsyncSnapshotByteBuffer, &outBytesCnt, &forceConfirmedStEvictedCnt, &oldLcacIfdId, &newLcacIfdId, &oldDynamicsRdfId, &newDynamicsRdfId, &maxPlayerInputFrontId, &minPlayerInputFrontId);
+    JPH_ASSERT(upserted);
+    JPH_ASSERT(-1 == newLcacIfdId && 0 == outBytesCnt);
+
+    auto reqB1 = google::protobuf::Arena::Create<WsReq>(&pbTestCaseDataAllocator);
+    reqB1->set_join_index(2);
+    auto b1 = reqB1->mutable_upsync_snapshot();
+    b1->set_st_ifd_id(0);
+    for (int ifdId = 0; ifdId <= 2; ifdId++) {
+        b1->add_cmd_list(0);
+    }
+    outBytesCnt = pbBufferSizeLimit;
+    memset(downsyncSnapshotByteBuffer, 0, sizeof(downsyncSnapshotByteBuffer));
+    upserted = reusedBattle->OnUpsyncSnapshotReceived(reqB1->join_index(), reqB1->upsync_snapshot(), true, false, downsyncSnapshotByteBuffer, &outBytesCnt, &forceConfirmedStEvictedCnt, &oldLcacIfdId, &newLcacIfdId, &oldDynamicsRdfId, &newDynamicsRdfId, &maxPlayerInputFrontId, &minPlayerInputFrontId);
+    JPH_ASSERT(upserted);
+    JPH_ASSERT(2 == newLcacIfdId && 0 < outBytesCnt && 0 == forceConfirmedStEvictedCnt);
+    bool parsed = downsyncSnapshotHolder->ParseFromArray(downsyncSnapshotByteBuffer, outBytesCnt);
+    JPH_ASSERT(parsed);
+    JPH_ASSERT(3 == downsyncSnapshotHolder->ifd_batch_size() && 0 == downsyncSnapshotHolder->st_ifd_id()); // [0, 2]
+
+    // "A2" lags "B" by more than "oldN" input frames
+    InputFrameDownsync* frame0Ptr = reusedBattle->ifdBuffer.GetByFrameId(0);
+    InputFrameDownsync* frame2Ptr = reusedBattle->ifdBuffer.GetByFrameId(2);
+    auto reqA2 = google::protobuf::Arena::Create<WsReq>(&pbTestCaseDataAllocator);
+    reqA2->set_join_index(1);
+    auto a2 = reqA2->mutable_upsync_snapshot();
+    a2->set_st_ifd_id(459);
+    for (int ifdId = 459; ifdId <= 600; ifdId++) {
+        a2->add_cmd_list(16);
+    }
+    outBytesCnt = pbBufferSizeLimit;
+    memset(downsyncSnapshotByteBuffer, 0, sizeof(downsyncSnapshotByteBuffer));
+    upserted = reusedBattle->OnUpsyncSnapshotReceived(reqA2->join_index(), reqA2->upsync_snapshot(), true, false, downsyncSnapshotByteBuffer, &outBytesCnt, &forceConfirmedStEvictedCnt, &oldLcacIfdId, &newLcacIfdId, &oldDynamicsRdfId, &newDynamicsRdfId, &maxPlayerInputFrontId, &minPlayerInputFrontId);
+    JPH_ASSERT(upserted);
+    JPH_ASSERT(0 == forceConfirmedStEvictedCnt); // Compared with the 147 of TestCase5
+    JPH_ASSERT(2 == newLcacIfdId && 0 == outBytesCnt);
+    JPH_ASSERT(601 <= reusedBattle->ifdBuffer.N && sizeCap >= reusedBattle->ifdBuffer.N);
+    JPH_ASSERT(0 == reusedBattle->ifdBuffer.StFrameId && 601 == reusedBattle->ifdBuffer.EdFrameId && 601 == reusedBattle->ifdBuffer.Cnt);
+    JPH_ASSERT(frame0Ptr == reusedBattle->ifdBuffer.GetByFrameId(0) && frame2Ptr == reusedBattle->ifdBuffer.GetByFrameId(2)); // Grown in place
+
+    std::cout << "Passed TestCase8\n" << std::endl;
+    reusedBattle->SetIfdBufferSizeCap(0);
+    reusedBattle->Clear(); // [WARNING] The grown "ifdBuffer.N" is kept, hence this case MUST run last on "reusedBattle"
+    return true;
+}
+
+/*
+[REMINDER] "serializable_data.proto" is "optimize_for = LITE_RUNTIME", hence its fields are enumerated from the descriptor set generated by protoc (see "Backend.cmake") into a dynamic (reflective) twin, whose serialized bytes are then parsed back into the lite generated classes.
+*/
+typedef std::vector<const google::protobuf::FieldDescriptor*> PB_FIELD_PATH_T;
+const int deltaTestMaxMsgDepth = 4;
+
+void fillNonDefaultFields(google::protobuf::Message* msg, int depth) {
+    const google::protobuf::Descriptor* desc = msg->GetDescriptor();
+    const google::protobuf::Reflection* refl = msg->GetReflection();
+    for (int i = 0; i < desc->field_count(); i++) {
+        const google::protobuf::FieldDescriptor* field = desc->field(i);
+        // [WARNING] All count and id fields become 3 while every repeated field holds 1 element, i.e. no "xxx_count" would point at an existing element to be reset by "CopyChd" and no id would collide with a "terminating_xxx_id".
+        switch (field->cpp_type()) {
+        case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE:
+            if (depth >= deltaTestMaxMsgDepth) break;
+            fillNonDefaultFields(field->is_repeated() ? refl->AddMessage(msg, field) : refl->MutableMessage(msg, field), depth + 1);
+            break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+            field->is_repeated() ? refl->AddInt32(msg, field, 3) : refl->SetInt32(msg, field, 3);
+            break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+            field->is_repeated() ? refl->AddInt64(msg, field, 3) : refl->SetInt64(msg, field, 3);
+            break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+            field->is_repeated() ? refl->AddUInt32(msg, field, 3) : refl->SetUInt32(msg, field, 3);
+            break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+            field->is_repeated() ? refl->AddUInt64(msg, field, 3) : refl->SetUInt64(msg, field, 3);
+            break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+            field->is_repeated() ? refl->AddFloat(msg, field, 3.5f) : refl->SetFloat(msg, field, 3.5f);
+            break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+            field->is_repeated() ? refl->AddDouble(msg, field, 3.5) : refl->SetDouble(msg, field, 3.5);
+            break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+            field->is_repeated() ? refl->AddBool(msg, field, true) : refl->SetBool(msg, field, true);
+            break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_ENUM: {
+            const int enumVal = (1 < field->enum_type()->value_count() ? field->enum_type()->value(1)->number() : 0);
+            field->is_repeated() ? refl->AddEnumValue(msg, field, enumVal) : refl->SetEnumValue(msg, field, enumVal);
+            break;
+        }
+        case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+            field->is_repeated() ? refl->AddString(msg, field, "a") : refl->SetString(msg, field, "a");
+            break;
+        }
+    }
+}
+
+void collectLeafFieldPaths(const google::protobuf::Descriptor* desc, int depth, PB_FIELD_PATH_T& prefix, std::vector<PB_FIELD_PATH_T>& outPaths) {
+    for (int i = 0; i < desc->field_count(); i++) {
+        const google::protobuf::FieldDescriptor* field = desc->field(i);
+        prefix.push_back(field);
+        if (google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE != field->cpp_type()) {
+            outPaths.push_back(prefix);
+        } else if (depth < deltaTestMaxMsgDepth) {
+            collectLeafFieldPaths(field->message_type(), depth + 1, prefix, outPaths);
+        }
+        prefix.pop_back();
+    }
+}
+
+std::string fieldPathToString(const PB_FIELD_PATH_T& path) {
+    std::string res;
+    for (auto field : path) {
+        if (!res.empty()) res += ".";
+        res += field->name();
+    }
+    return res;
+}
+
+// Changes the leaf of "path" (the 1st element of each repeated field on the way) from the value set by "fillNonDefaultFields".
+void mutateLeafField(google::protobuf::Message* msg, const PB_FIELD_PATH_T& path) {
+    for (size_t k = 0; k + 1 < path.size(); k++) {
+        const google::protobuf::FieldDescriptor* field = path[k];
+        msg = field->is_repeated() ? msg->GetReflection()->MutableRepeatedMessage(msg, field, 0) : msg->GetReflection()->MutableMessage(msg, field);
+    }
+    const google::protobuf::FieldDescriptor* field = path.back();
+    const google::protobuf::Reflection* refl = msg->GetReflection();
+    switch (field->cpp_type()) {
+    case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+        field->is_repeated() ? refl->SetRepeatedInt32(msg, field, 0, 10) : refl->SetInt32(msg, field, 10);
+        break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+        field->is_repeated() ? refl->SetRepeatedInt64(msg, field, 0, 10) : refl->SetInt64(msg, field, 10);
+        break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+        field->is_repeated() ? refl->SetRepeatedUInt32(msg, field, 0, 10) : refl->SetUInt32(msg, field, 10);
+        break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+        field->is_repeated() ? refl->SetRepeatedUInt64(msg, field, 0, 10) : refl->SetUInt64(msg, field, 10);
+        break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+        field->is_repeated() ? refl->SetRepeatedFloat(msg, field, 0, -0.25f) : refl->SetFloat(msg, field, -0.25f);
+        break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+        field->is_repeated() ? refl->SetRepeatedDouble(msg, field, 0, -0.25) : refl->SetDouble(msg, field, -0.25);
+        break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+        field->is_repeated() ? refl->SetRepeatedBool(msg, field, 0, false) : refl->SetBool(msg, field, false);
+        break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_ENUM: {
+        const int enumVal = (2 < field->enum_type()->value_count() ? field->enum_type()->value(2)->number() : field->enum_type()->value(0)->number());
+        field->is_repeated() ? refl->SetRepeatedEnumValue(msg, field, 0, enumVal) : refl->SetEnumValue(msg, field, enumVal);
+        break;
+    }
+    case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+        field->is_repeated() ? refl->SetRepeatedString(msg, field, 0, "b") : refl->SetString(msg, field, "b");
+        break;
+    default:
+        break;
+    }
+}
+
+void setRdfCountsForDeltaTest(RenderFrame* rdf, int rdfId) {
+    // The alive counts MUST match the list sizes, otherwise "ApplyRdfDelta" treats the delta as malformed.
+    rdf->set_id(rdfId);
+    rdf->set_npc_count(rdf->npcs_size());
+    rdf->set_bullet_count(rdf->bullets_size());
+    rdf->set_dynamic_trap_count(rdf->dynamic_traps_size());
+    rdf->set_trigger_count(rdf->triggers_size());
+    rdf->set_pickable_count(rdf->pickables_size());
+}
+
+bool runTestCase9(BackendBattle* reusedBattle, WsReq* /*initializerMapData*/) {
+    /*
+    Every leaf field of every entity type carried by "RenderFrameDelta" is changed one at a time, then the delta encoded by "EncodeRdfDelta" and applied by "ApplyRdfDelta" upon a copy of the base MUST reproduce the serialized bytes of the target -- a field missing in "isSameForDelta" or in "CopyXxx" fails here with its name printed.
+    */
+    std::ifstream pbDescFin(SERIALIZABLE_DATA_DESC_PATH, std::ios::in | std::ios::binary);
+    google::protobuf::FileDescriptorSet pbDescSet;
+    bool parsed = pbDescFin.is_open() && pbDescSet.ParseFromIstream(&pbDescFin);
+    pbDescFin.close();
+    if (!parsed) {
+        std::cerr << "Failed to open " << SERIALIZABLE_DATA_DESC_PATH << std::endl;
+        JPH_ASSERT(false);
+        return false;
+    }
+    google::protobuf::DescriptorPool pbDescPool;
+    for (auto& protoFile : pbDescSet.file()) {
+        pbDescPool.BuildFile(protoFile);
+    }
+    const google::protobuf::Descriptor* rdfDesc = pbDescPool.FindMessageTypeByName("jtshared.RenderFrame");
+    JPH_ASSERT(nullptr != rdfDesc);
+    google::protobuf::DynamicMessageFactory dynamicMsgFactory;
+    std::unique_ptr<google::protobuf::Message> baseDynamicRdf(dynamicMsgFactory.GetPrototype(rdfDesc)->New());
+    fillNonDefaultFields(baseDynamicRdf.get(), 0);
+
+    std::string bytesScratch;
+    RenderFrame* baseRdf = google::protobuf::Arena::Create<RenderFrame>(&pbTestCaseDataAllocator);
+    baseDynamicRdf->SerializeToString(&bytesScratch);
+    parsed = baseRdf->ParseFromString(bytesScratch);
+    JPH_ASSERT(parsed);
+    setRdfCountsForDeltaTest(baseRdf, 100);
+
+    RenderFrame* targetRdf = google::protobuf::Arena::Create<RenderFrame>(&pbTestCaseDataAllocator);
+    RenderFrame* holderRdf = google::protobuf::Arena::Create<RenderFrame>(&pbTestCaseDataAllocator);
+    RenderFrameDelta* delta = google::protobuf::Arena::Create<RenderFrameDelta>(&pbTestCaseDataAllocator);
+    std::string holderBytes, targetBytes;
+
+    // An unchanged entity MUST NOT be marked dirty.
+    targetRdf->CopyFrom(*baseRdf);
+    targetRdf->set_id(101);
+    bool encoded = reusedBattle->EncodeRdfDelta(baseRdf, targetRdf, delta);
+    JPH_ASSERT(encoded);
+    JPH_ASSERT(0 == delta->changed().players_size() && 0 == delta->changed().npcs_size() && 0 == delta->changed().bullets_size() && 0 == delta->changed().dynamic_traps_size() && 0 == delta->changed().triggers_size() && 0 == delta->changed().pickables_size());
+
+    int checkedEntityTypesCnt = 0, checkedLeavesCnt = 0;
+    for (int i = 0; i < rdfDesc->field_count(); i++) {
+        const google::protobuf::FieldDescriptor* entityListField = rdfDesc->field(i);
+        if (!entityListField->is_repeated() || google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE != entityListField->cpp_type()) continue;
+        ++checkedEntityTypesCnt;
+        PB_FIELD_PATH_T prefix = { entityListField };
+        std::vector<PB_FIELD_PATH_T> leafPaths;
+        collectLeafFieldPaths(entityListField->message_type(), 1, prefix, leafPaths);
+        for (auto& leafPath : leafPaths) {
+            std::unique_ptr<google::protobuf::Message> targetDynamicRdf(baseDynamicRdf->New());
+            targetDynamicRdf->CopyFrom(*baseDynamicRdf);
+            mutateLeafField(targetDynamicRdf.get(), leafPath);
+            targetDynamicRdf->SerializeToString(&bytesScratch);
+            targetRdf->Clear();
+            parsed = targetRdf->ParseFromString(bytesScratch);
+            JPH_ASSERT(parsed);
+            setRdfCountsForDeltaTest(targetRdf, 101);
+
+            delta->Clear();
+            encoded = reusedBattle->EncodeRdfDelta(baseRdf, targetRdf, delta);
+            holderRdf->CopyFrom(*baseRdf);
+            bool applied = reusedBattle->ApplyRdfDelta(*delta, holderRdf);
+            holderRdf->SerializeToString(&holderBytes);
+            targetRdf->SerializeToString(&targetBytes);
+            if (!encoded || !applied || holderBytes != targetBytes) {
+                std::cerr << "Failed TestCase9 at RenderFrame." << fieldPathToString(leafPath) << ", encoded=" << encoded << ", applied=" << applied << std::endl;
+                JPH_ASSERT(false);
+                return false;
+            }
+            ++checkedLeavesCnt;
+        }
+    }
+    JPH_ASSERT(6 == checkedEntityTypesCnt); // players, bullets, npcs, dynamic_traps, triggers, pickables
+
+    std::cout << "Passed TestCase9, checkedLeavesCnt=" << checkedLeavesCnt << "\n" << std::endl;
+    return true;
+}
+
 // Program entry point
 int main(int argc, char** argv)
 {
@@ -539,7 +912,7 @@ int main(int argc, char** argv)
     
     RegisterDebugCallback(DebugLogCb);
 
-    BackendBattle* battle = static_cast<BackendBattle*>(BACKEND_CreateBattle(2));
+    BackendBattle* battle = static_cast<BackendBattle*>(BACKEND_CreateBattle(2, 0));
     std::cout << "Created battle = " << battle << std::endl;
 
     auto startRdf = mockStartRdf(&pbTestCaseDataAllocator);
@@ -555,6 +928,9 @@ int main(int argc, char** argv)
     runTestCase4(battle, initializerMapData);
     runTestCase5(battle, initializerMapData);
     runTestCase6(battle, initializerMapData);
+    runTestCase7(battle, initializerMapData);
+    runTestCase8(battle, initializerMapData);
+    runTestCase9(battle, initializerMapData);
     
     initializerMapData->Clear();
     pbTestCaseDataAllocator.Reset();
@@ -6549,7 +6549,7 @@ bool runTestCase6(FrontendBattle* reusedBattle, std::vector<std::vector<float>>&
     
     reusedBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
-    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true));
+    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true, 0));
     
     referenceBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
@@ -6665,7 +6665,7 @@ bool runTestCase7(FrontendBattle* reusedBattle, std::vector<std::vector<float>>&
     initTest7Data(initializerMapData, hulls, theAllocator);
     reusedBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
-    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true));
+    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true, 0));
     referenceBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
     int outerTimerRdfId = globalPrimitiveConsts->starting_render_frame_id();
@@ -7029,7 +7029,7 @@ bool runTestCase11(FrontendBattle* reusedBattle, std::vector<std::vector<float>>
     initTest11Data(initializerMapData, hulls, theAllocator);
     reusedBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
-    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true));
+    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true, 0));
     referenceBattle->SetFrameLogEnabled(true);
     referenceBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
@@ -7614,7 +7614,7 @@ bool runTestCase18(FrontendBattle* reusedBattle, std::vector<std::vector<float>>
     initTest18Data(initializerMapData, hulls, theAllocator);
     reusedBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
-    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true));
+    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true, 0));
     referenceBattle->SetFrameLogEnabled(true);
     referenceBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
@@ -8016,7 +8016,7 @@ bool runTestCase23(FrontendBattle* reusedBattle, std::vector<std::vector<float>>
     initTest23Data(initializerMapData, hulls, theAllocator);
     reusedBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
-    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true));
+    FrontendBattle* referenceBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true, 0));
     referenceBattle->SetFrameLogEnabled(true);
     referenceBattle->ResetStartRdf(initializerMapData, inSingleJoinIndex, selfPlayerId, selfCmdAuthKey);
 
@@ -9045,7 +9045,7 @@ bool runTestCase34(FrontendBattle* reusedBattle, std::vector<std::vector<float>>
 }
 
 bool runTestCase35(std::vector<std::vector<float>>& hulls, int inSingleJoinIndex, google::protobuf::Arena* theAllocator) {
-    FrontendBattle* offlineBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, false));
+    FrontendBattle* offlineBattle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, false, 0));
     std::cout << "TestCase35/Created Offline battle = " << offlineBattle << std::endl;
 
     WsReq* initializerMapData = google::protobuf::Arena::Create<WsReq>(theAllocator);
@@ -10205,7 +10205,7 @@ int main(int argc, char** argv)
     
     RegisterDebugCallback(DebugLogCb);
 
-    FrontendBattle* battle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true));
+    FrontendBattle* battle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, true, 0));
     std::cout << "Created battle = " << battle << std::endl;
 
     int selfJoinIndex = 1;
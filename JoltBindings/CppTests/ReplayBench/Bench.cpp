@@ -0,0 +1,230 @@
+#include "DebugLog.h"
+
+#include "BackendBattle.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/util/delimited_message_util.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <filesystem>
+#include <map>
+
+/*
+[REMINDER] Usage
+
+    ReplayBench <startWsReq.pb> <frameLogs.bin> [repeats=1]
+
+- "startWsReq.pb" is a serialized "WsReq" as used by "BACKEND_ResetStartRdf", i.e. with "self_parsed_rdf" and the static map data.
+- "frameLogs.bin" is a sequence of length-delimited "FrameLog"s (e.g. by "MessageLite::SerializeDelimitedToOstream" in C++ or "IMessage.WriteDelimitedTo" in C#) collected by "APP_GetFrameLog". Only "actually_used_ifd_id" and "used_ifd_input_list" are required, the "rdf" is optional and only used for checksum verification. A later "FrameLog" overrides an earlier one of the same "actually_used_ifd_id" or "rdf.id", such that frontend logs containing rollback-chasing can be used as-is.
+
+The whole sequence is replayed by "BackendBattle::Step(rdfId, rdfId+1, virtualIfds)" one frame at a time (i.e. "BaseBattle::CalcSingleStep" without any rendering), then per-frame timings and the final checksum are reported. "PrimitiveConsts.pb" and "ConfigConsts.pb" are loaded from the folder of the executable, same as "BackendTest" and "FrontendTest".
+*/
+
+google::protobuf::Arena pbReplayDataAllocator;
+
+using namespace jtshared;
+using namespace std::filesystem;
+
+void DebugLogCb(const char* message, int color, int size) {
+    std::cout << message << std::endl;
+}
+
+bool readWholeFile(const std::string& filePath, std::vector<char>& outBytes) {
+    std::ifstream fin(filePath, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!fin.is_open()) {
+        return false;
+    }
+    std::streamsize size = fin.tellg();
+    fin.seekg(0, std::ios::beg);
+    outBytes.resize((size_t)size);
+    bool res = (0 == size || fin.read(outBytes.data(), size).good());
+    fin.close();
+    return res;
+}
+
+bool initConstsFromFile(const std::string& filePath, bool (*initFn)(char*, int)) {
+    std::vector<char> bytes;
+    if (!readWholeFile(filePath, bytes)) {
+        std::cerr << "Failed to open " << filePath << std::endl;
+        return false;
+    }
+    return initFn(bytes.data(), (int)bytes.size());
+}
+
+/*
+Collects the input lists into "outVirtualIfds.ifd_batch" (contiguous from "outVirtualIfds.st_ifd_id") and the recorded checksums by "rdfId", returns the largest "rdfId" that can be replayed.
+*/
+int loadFrameLogs(const std::vector<char>& bytes, const int playersCnt, DownsyncSnapshot* outVirtualIfds, std::map<int, uint64_t>& outRecordedChecksums) {
+    google::protobuf::io::ArrayInputStream rawIn(bytes.data(), (int)bytes.size());
+    std::map<int, const FrameLog*> ifdIdToFrameLog;
+    while (true) {
+        FrameLog* frameLog = google::protobuf::Arena::Create<FrameLog>(&pbReplayDataAllocator);
+        bool cleanEof = false;
+        if (!google::protobuf::util::ParseDelimitedFromZeroCopyStream(frameLog, &rawIn, &cleanEof)) {
+            if (!cleanEof) {
+                std::cerr << "Malformed FrameLog after " << ifdIdToFrameLog.size() << " distinct input frames, ignoring the rest" << std::endl;
+            }
+            break;
+        }
+        ifdIdToFrameLog[frameLog->actually_used_ifd_id()] = frameLog;
+        if (frameLog->has_rdf() && 0 != frameLog->rdf().checksum()) {
+            outRecordedChecksums[frameLog->rdf().id()] = frameLog->rdf().checksum();
+        }
+    }
+    if (ifdIdToFrameLog.empty()) {
+        return globalPrimitiveConsts->terminating_render_frame_id();
+    }
+
+    const int stIfdId = ifdIdToFrameLog.begin()->first;
+    const int edIfdId = ifdIdToFrameLog.rbegin()->first + 1;
+    outVirtualIfds->set_st_ifd_id(stIfdId);
+    int missingCnt = 0;
+    for (int ifdId = stIfdId; ifdId < edIfdId; ifdId++) {
+        InputFrameDownsync* ifd = outVirtualIfds->add_ifd_batch();
+        auto it = ifdIdToFrameLog.find(ifdId);
+        for (int i = 0; i < playersCnt; i++) {
+            if (it != ifdIdToFrameLog.end() && i < it->second->used_ifd_input_list_size()) {
+                ifd->add_input_list(it->second->used_ifd_input_list(i));
+            } else {
+                ifd->add_input_list(0);
+            }
+        }
+        if (it == ifdIdToFrameLog.end()) {
+            ++missingCnt;
+        }
+        ifd->set_confirmed_list((1ull << playersCnt) - 1);
+    }
+    if (0 < missingCnt) {
+        std::cerr << "[WARNING] " << missingCnt << " input frames within [" << stIfdId << ", " << edIfdId << ") are missing from the FrameLogs, replaced by no-op inputs" << std::endl;
+    }
+    return BaseBattle::ConvertToLastUsedRenderFrameId(edIfdId - 1) + 1;
+}
+
+int main(int argc, char** argv)
+{
+#ifndef NDEBUG
+    std::cout << "Starting in debug mode, timings are NOT representative" << std::endl;
+#else
+    std::cout << "Starting in release" << std::endl;
+#endif
+    if (3 > argc) {
+        std::cerr << "Usage: " << argv[0] << " <startWsReq.pb> <frameLogs.bin> [repeats=1]" << std::endl;
+        return 1;
+    }
+    const int repeats = (3 < argc ? std::max(1, atoi(argv[3])) : 1);
+
+    path exePath(argv[0]);
+    path executableFolder = exePath.parent_path();
+    if (!initConstsFromFile(executableFolder.string() + "/PrimitiveConsts.pb", PrimitiveConsts_Init)) {
+        exit(1);
+    }
+    if (!initConstsFromFile(executableFolder.string() + "/ConfigConsts.pb", ConfigConsts_Init)) {
+        exit(1);
+    }
+
+    std::vector<char> bytes;
+    if (!readWholeFile(argv[1], bytes)) {
+        std::cerr << "Failed to open " << argv[1] << std::endl;
+        exit(1);
+    }
+    WsReq* initializerMapData = google::protobuf::Arena::Create<WsReq>(&pbReplayDataAllocator);
+    if (!initializerMapData->ParseFromArray(bytes.data(), (int)bytes.size()) || !initializerMapData->has_self_parsed_rdf()) {
+        std::cerr << "Failed to parse a WsReq with self_parsed_rdf from " << argv[1] << std::endl;
+        exit(1);
+    }
+    const int playersCnt = initializerMapData->self_parsed_rdf().players_size();
+
+    if (!readWholeFile(argv[2], bytes)) {
+        std::cerr << "Failed to open " << argv[2] << std::endl;
+        exit(1);
+    }
+    DownsyncSnapshot* virtualIfds = google::protobuf::Arena::Create<DownsyncSnapshot>(&pbReplayDataAllocator);
+    std::map<int, uint64_t> recordedChecksums;
+    const int edRdfId = loadFrameLogs(bytes, playersCnt, virtualIfds, recordedChecksums);
+    std::cout << "Loaded " << virtualIfds->ifd_batch_size() << " input frames from st_ifd_id=" << virtualIfds->st_ifd_id() << ", " << recordedChecksums.size() << " recorded checksums" << std::endl;
+
+    JPH_Init(10*1024*1024);
+    RegisterDebugCallback(DebugLogCb);
+
+    BackendBattle* battle = static_cast<BackendBattle*>(BACKEND_CreateBattle(512, 0));
+
+    std::vector<int64_t> stepNanos;
+    int64_t totalNanos = 0;
+    int checksumMismatchCnt = 0, firstMismatchedRdfId = globalPrimitiveConsts->terminating_render_frame_id();
+    int lastRdfId = globalPrimitiveConsts->terminating_render_frame_id();
+    for (int r = 0; r < repeats; r++) {
+        battle->ResetStartRdf(initializerMapData);
+        const int stRdfId = battle->GetDynamicsRdfId();
+        if (virtualIfds->st_ifd_id() > BaseBattle::ConvertToDelayedInputFrameId(stRdfId)) {
+            std::cerr << "FrameLogs start at st_ifd_id=" << virtualIfds->st_ifd_id() << ", which is beyond the delayed input frame of the start rdfId=" << stRdfId << std::endl;
+            break;
+        }
+        stepNanos.reserve(stepNanos.size() + (edRdfId > stRdfId ? edRdfId - stRdfId : 0));
+        for (int rdfId = stRdfId; rdfId < edRdfId; rdfId++) {
+            auto t0 = std::chrono::steady_clock::now();
+            battle->Step(rdfId, rdfId + 1, virtualIfds);
+            auto t1 = std::chrono::steady_clock::now();
+            int64_t elapsedNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+            stepNanos.push_back(elapsedNanos);
+            totalNanos += elapsedNanos;
+            lastRdfId = rdfId + 1;
+
+            if (0 == r) {
+                auto it = recordedChecksums.find(lastRdfId);
+                uint64_t replayedChecksum = 0;
+                if (it != recordedChecksums.end() && APP_GetRdfChecksum(battle, lastRdfId, &replayedChecksum) && replayedChecksum != it->second) {
+                    if (0 == checksumMismatchCnt) {
+                        firstMismatchedRdfId = lastRdfId;
+                    }
+                    ++checksumMismatchCnt;
+                }
+            }
+        }
+    }
+
+    if (stepNanos.empty()) {
+        std::cerr << "Nothing replayed" << std::endl;
+    } else {
+        std::vector<int64_t> sortedNanos(stepNanos);
+        std::sort(sortedNanos.begin(), sortedNanos.end());
+        auto percentile = [&sortedNanos](double p) {
+            size_t idx = (size_t)(p * (sortedNanos.size() - 1));
+            return sortedNanos[idx] / 1000.0;
+        };
+        double meanMicros = totalNanos / 1000.0 / stepNanos.size();
+        double framesPerSec = stepNanos.size() / (totalNanos / 1e9);
+        uint64_t finalChecksum = 0;
+        APP_GetRdfChecksum(battle, lastRdfId, &finalChecksum);
+
+        std::cout << "Replayed " << stepNanos.size() << " frames (" << repeats << " repeat(s)), lastRdfId=" << lastRdfId << std::endl;
+        std::cout << "frames/sec per room=" << framesPerSec << std::endl;
+        std::cout << "step micros: mean=" << meanMicros << ", p50=" << percentile(0.50) << ", p90=" << percentile(0.90) << ", p99=" << percentile(0.99) << ", max=" << percentile(1.0) << std::endl;
+        std::cout << "final checksum=" << finalChecksum << std::endl;
+        std::cout << "checksum mismatches against recorded=" << checksumMismatchCnt;
+        if (0 < checksumMismatchCnt) {
+            std::cout << ", firstMismatchedRdfId=" << firstMismatchedRdfId;
+        }
+        std::cout << std::endl;
+    }
+
+    initializerMapData->Clear();
+    pbReplayDataAllocator.Reset();
+
+    bool destroyRes = APP_DestroyBattle(battle);
+    std::cout << "APP_DestroyBattle result=" << destroyRes << std::endl;
+
+    JPH_Shutdown();
+    return (0 < checksumMismatchCnt ? 2 : 0);
+}
+
+#ifdef _WIN32
+#include <windows.h>
+
+int APIENTRY WinMain(HINSTANCE hInstance,
+    HINSTANCE hPrevInstance,
+    LPSTR lpCmdLine, int nCmdShow)
+{
+    return main(__argc, __argv);
+}
+#endif
@@ -0,0 +1,68 @@
+set(REPLAY_BENCH_ROOT ${JOLT_BINDINGS_ROOT}/CppTests/ReplayBench)
+
+# Source files
+set(REPLAY_BENCH_SRC_FILES
+	${REPLAY_BENCH_ROOT}/Bench.cpp
+)
+
+add_executable(ReplayBench ${REPLAY_BENCH_SRC_FILES})
+#target_link_options(ReplayBench PRIVATE "/VERBOSE")
+
+target_compile_definitions(ReplayBench PRIVATE JPH_SHARED_LIBRARY) # [IMPORTANT] For correctly define the macro "JPH_EXPORT" as "__declspec(dllimport)"
+#target_compile_definitions(ReplayBench PRIVATE JPH_ENABLE_ASSERTS)
+target_link_libraries(ReplayBench LINK_PUBLIC ${TARGET_NAME})
+if(USE_STATIC_PB) 
+    target_link_libraries(ReplayBench PRIVATE 
+        protobuf::libprotobuf
+    )
+else()
+    target_link_libraries(${TARGET_NAME} PUBLIC 
+        utf8_range::utf8_validity
+    )
+    target_link_libraries(ReplayBench PUBLIC 
+        protobuf::libprotobuf
+    )
+endif()
+
+if (MSVC)
+    #set_property(DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR} PROPERTY VS_STARTUP_PROJECT ReplayBench)
+    target_link_options(ReplayBench PUBLIC "/SUBSYSTEM:CONSOLE")
+endif()
+
+target_include_directories(ReplayBench PUBLIC
+	$<BUILD_INTERFACE:${PHYSICS_REPO_ROOT}>
+    $<BUILD_INTERFACE:${JOLT_BINDINGS_ROOT}/joltc>
+    $<BUILD_INTERFACE:${PB_GEN_ROOT}>
+    $<INSTALL_INTERFACE:/include>)
+
+if (MSVC)
+else ()
+    set_target_properties(
+        ReplayBench
+        PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+        LIBRARY_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+        ARCHIVE_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+    )
+endif ()
+
+set(MY_RUNTIME_DEPS_DESTINATIONS "${OVERRIDE_BINARY_DESTINATION}") # [WARNING] Intentionally NOT installing to "UnityPackageOutput" folder.
+
+foreach (_rt_deps_destination ${MY_RUNTIME_DEPS_DESTINATIONS}) 
+    if (MSVC)
+        install(FILES $<TARGET_PDB_FILE:ReplayBench> DESTINATION ${_rt_deps_destination} OPTIONAL)
+    endif()
+
+    if (USE_STATIC_PB) 
+    else()
+        install(IMPORTED_RUNTIME_ARTIFACTS utf8_range::utf8_validity  
+            DESTINATION ${_rt_deps_destination} COMPONENT Dependencies
+        )
+        install(IMPORTED_RUNTIME_ARTIFACTS protobuf::libprotobuf  
+            DESTINATION ${_rt_deps_destination} COMPONENT Dependencies
+        )
+    endif()
+
+    install(FILES ${OVERRIDE_INSTALL_DESTINATION}/PrimitiveConsts.pb DESTINATION ${_rt_deps_destination} OPTIONAL)
+    install(FILES ${OVERRIDE_INSTALL_DESTINATION}/ConfigConsts.pb DESTINATION ${_rt_deps_destination} OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+set(RING_BUFFER_TEST_ROOT ${JOLT_BINDINGS_ROOT}/CppTests/RingBuffer)
+
+# Source files
+set(RING_BUFFER_TEST_SRC_FILES
+	${RING_BUFFER_TEST_ROOT}/Test.cpp
+    ${JOLT_BINDINGS_ROOT}/joltc/DebugLog.cpp
+)
+
+add_executable(RingBufferTest ${RING_BUFFER_TEST_SRC_FILES})
+
+if (MSVC)
+else ()
+    set_target_properties(
+        RingBufferTest
+        PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+        LIBRARY_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+        ARCHIVE_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+    )
+endif ()
+
+if (MSVC)
+    set_property(DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR} PROPERTY VS_STARTUP_PROJECT RingBufferTest)
+    target_link_options(RingBufferTest PUBLIC "/SUBSYSTEM:CONSOLE")
+
+	# Enable use of exceptions in MSVC's STL
+	target_compile_definitions(RingBufferTest PUBLIC $<$<BOOL:${MSVC}>:_HAS_EXCEPTIONS=1>)
+	target_compile_options(RingBufferTest PRIVATE /EHsc)
+endif()
+
+target_include_directories(RingBufferTest PUBLIC
+    $<BUILD_INTERFACE:${JOLT_BINDINGS_ROOT}/joltc>
+    $<BUILD_INTERFACE:${PB_GEN_ROOT}>
+    $<INSTALL_INTERFACE:/include>)
@@ -0,0 +1,189 @@
+#include "FrameRingBuffer.h"
+#include <iostream>
+#include <cassert>
+#include <set>
+#include <vector>
+
+// Tracks every element allocated by "DryPut()" and freed by the destructor, such that leaks and double frees are both detected.
+struct CountingAllocator {
+    std::set<int*> live;
+    int allocCnt = 0;
+    int freeCnt = 0;
+    int doubleFreeCnt = 0;
+};
+
+int* AllocCountedInt(CountingAllocator* allocator) {
+    int* ret = new int(-1);
+    allocator->live.insert(ret);
+    ++allocator->allocCnt;
+    return ret;
+}
+
+void FreeCountedInt(int* ele, CountingAllocator* allocator) {
+    if (0 == allocator->live.erase(ele)) {
+        ++allocator->doubleFreeCnt;
+        return;
+    }
+    ++allocator->freeCnt;
+    delete ele;
+}
+
+#define FRB_T FrameRingBuffer<int, CountingAllocator>
+
+void putFrame(FRB_T& frb) {
+    int frameId = frb.EdFrameId;
+    int* slot = frb.DryPut();
+    *slot = frameId;
+}
+
+void assertFramesIntact(FRB_T& frb) {
+    assert(frb.EdFrameId - frb.StFrameId == frb.Cnt);
+    for (int frameId = frb.StFrameId; frameId < frb.EdFrameId; ++frameId) {
+        int* ele = frb.GetByFrameId(frameId);
+        assert(nullptr != ele);
+        assert(frameId == *ele);
+    }
+}
+
+bool runTestCase1() {
+    // Reserve when wrapped, i.e. "St > Ed"
+    CountingAllocator allocator;
+    {
+        FRB_T frb(4, &allocator, AllocCountedInt, FreeCountedInt);
+        for (int i = 0; i < 6; ++i) {
+            putFrame(frb); // The last 2 puts evict frames 0 and 1
+        }
+        frb.Pop(); // Leaves an allocated idle slot behind
+        assert(3 == frb.St && 2 == frb.Ed && 3 == frb.Cnt);
+        assert(3 == frb.StFrameId && 6 == frb.EdFrameId);
+        assert(4 == allocator.allocCnt);
+
+        std::vector<int*> oldPtrs;
+        for (int frameId = frb.StFrameId; frameId < frb.EdFrameId; ++frameId) {
+            oldPtrs.push_back(frb.GetByFrameId(frameId));
+        }
+
+        assert(!frb.Reserve(4));
+        assert(!frb.Reserve(2));
+        bool reserved = frb.Reserve(8);
+        assert(reserved);
+        assert(8 == frb.N && 0 == frb.St && 3 == frb.Ed && 3 == frb.Cnt);
+        assert(3 == frb.StFrameId && 6 == frb.EdFrameId);
+        for (int frameId = frb.StFrameId; frameId < frb.EdFrameId; ++frameId) {
+            assert(oldPtrs[frameId - frb.StFrameId] == frb.GetByFrameId(frameId));
+        }
+        assertFramesIntact(frb);
+        assert(4 == allocator.allocCnt); // Reserving allocates nothing
+
+        // The idle slot is reused first, then the new slots are allocated lazily
+        putFrame(frb);
+        assert(4 == allocator.allocCnt);
+        for (int i = 0; i < 4; ++i) {
+            putFrame(frb);
+        }
+        assert(8 == allocator.allocCnt);
+        assert(8 == frb.Cnt && 3 == frb.StFrameId && 11 == frb.EdFrameId);
+        assertFramesIntact(frb);
+        for (int frameId = 3; frameId < 6; ++frameId) {
+            assert(oldPtrs[frameId - 3] == frb.GetByFrameId(frameId));
+        }
+
+        // Evicts the oldest once full again, without allocation
+        int* oldestPtr = frb.GetByFrameId(3);
+        int* evictedSlot = frb.DryPut();
+        assert(oldestPtr == evictedSlot);
+        *evictedSlot = 11;
+        assert(4 == frb.StFrameId && 12 == frb.EdFrameId);
+        assertFramesIntact(frb);
+        assert(8 == allocator.allocCnt);
+    }
+    assert(allocator.live.empty());
+    assert(allocator.allocCnt == allocator.freeCnt);
+    assert(0 == allocator.doubleFreeCnt);
+    std::cout << "Passed TestCase1" << std::endl;
+    return true;
+}
+
+bool runTestCase2() {
+    // Reserve when full, i.e. "Cnt == N"
+    CountingAllocator allocator;
+    {
+        FRB_T frb(4, &allocator, AllocCountedInt, FreeCountedInt);
+        for (int i = 0; i < 4; ++i) {
+            putFrame(frb);
+        }
+        assert(0 == frb.St && 4 == frb.Ed && 4 == frb.Cnt);
+
+        // Full and not wrapped
+        int* frame0Ptr = frb.GetByFrameId(0);
+        bool reserved = frb.Reserve(5);
+        assert(reserved);
+        assert(frame0Ptr == frb.GetByFrameId(0));
+        assertFramesIntact(frb);
+
+        for (int i = 0; i < 3; ++i) {
+            putFrame(frb); // The first put fills the new slot, the rest evict frames 0 and 1
+        }
+        assert(5 == allocator.allocCnt);
+        assert(5 == frb.Cnt && 2 == frb.StFrameId && 7 == frb.EdFrameId);
+        assert(frb.St == frb.Ed);
+
+        // Full and wrapped, i.e. "St == Ed"
+        std::vector<int*> oldPtrs;
+        for (int frameId = frb.StFrameId; frameId < frb.EdFrameId; ++frameId) {
+            oldPtrs.push_back(frb.GetByFrameId(frameId));
+        }
+        reserved = frb.Reserve(7);
+        assert(reserved);
+        assert(7 == frb.N && 0 == frb.St && 5 == frb.Ed && 5 == frb.Cnt);
+        assert(2 == frb.StFrameId && 7 == frb.EdFrameId);
+        for (int frameId = frb.StFrameId; frameId < frb.EdFrameId; ++frameId) {
+            assert(oldPtrs[frameId - frb.StFrameId] == frb.GetByFrameId(frameId));
+        }
+        assertFramesIntact(frb);
+
+        for (int i = 0; i < 2; ++i) {
+            int* slot = frb.DryPut();
+            for (int* oldPtr : oldPtrs) {
+                assert(oldPtr != slot); // New slots never alias live elements
+            }
+            *slot = frb.EdFrameId - 1;
+        }
+        assert(7 == allocator.allocCnt);
+        assert(7 == frb.Cnt && 2 == frb.StFrameId && 9 == frb.EdFrameId);
+        assertFramesIntact(frb);
+
+        // "PopTail" then "DryPut" keeps reusing the same slot
+        int* tailPtr = frb.GetByFrameId(8);
+        frb.PopTail();
+        int* slot = frb.DryPut();
+        assert(tailPtr == slot);
+        *slot = 8;
+        assertFramesIntact(frb);
+        assert(7 == allocator.allocCnt);
+    }
+    assert(allocator.live.empty());
+    assert(allocator.allocCnt == allocator.freeCnt);
+    assert(0 == allocator.doubleFreeCnt);
+    std::cout << "Passed TestCase2" << std::endl;
+    return true;
+}
+
+// Program entry point
+int main(int argc, char** argv)
+{
+    runTestCase1();
+    runTestCase2();
+	return 0;
+}
+
+#ifdef _WIN32
+#include <windows.h>
+
+int APIENTRY WinMain(HINSTANCE hInstance,
+    HINSTANCE hPrevInstance,
+    LPSTR lpCmdLine, int nCmdShow)
+{
+    return main(__argc, __argv);
+}
+#endif
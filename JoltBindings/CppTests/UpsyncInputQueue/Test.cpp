@@ -0,0 +1,102 @@
+#include "UpsyncInputQueue.h"
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <cassert>
+#include <sstream>
+
+bool runTestCase1() {
+    // Single-threaded, fills up the queue then drains it.
+    UpsyncInputQueue_ThreadSafe que(6);
+    assert(8 == que.GetCapacity());
+    for (int i = 0; i < 8; ++i) {
+        UpsyncInput single = { 1, i, (uint64_t)(i * 10), (0 == (i & 1)), false };
+        assert(que.Push_ThreadSafe(single));
+    }
+    UpsyncInput overflow = { 1, 8, 80, false, false };
+    assert(!que.Push_ThreadSafe(overflow));
+
+    UpsyncInput popped;
+    for (int i = 0; i < 8; ++i) {
+        assert(que.Pop_NotThreadSafe(popped));
+        assert(i == popped.ifdId);
+        assert((uint64_t)(i * 10) == popped.input);
+        assert((0 == (i & 1)) == popped.fromUdp);
+    }
+    assert(!que.Pop_NotThreadSafe(popped));
+
+    // Wraps around
+    assert(que.Push_ThreadSafe(overflow));
+    assert(que.Pop_NotThreadSafe(popped));
+    assert(8 == popped.ifdId);
+    std::cout << "Passed TestCase1" << std::endl;
+    return true;
+}
+
+bool runTestCase2() {
+    // Multiple producers with a single concurrent consumer, the per-producer order MUST be preserved and nothing is lost.
+    const int producersCnt = 4, perProducerCnt = 100000;
+    UpsyncInputQueue_ThreadSafe que(256);
+    std::atomic<int> pushFailureCnt = 0;
+
+    std::vector<std::thread> ths;
+    for (int p = 0; p < producersCnt; ++p) {
+        ths.emplace_back([&que, &pushFailureCnt, p, perProducerCnt]() {
+            for (int i = 0; i < perProducerCnt; ++i) {
+                UpsyncInput single = { (uint32_t)(p + 1), i, (uint64_t)i, true, false };
+                while (!que.Push_ThreadSafe(single)) {
+                    ++pushFailureCnt;
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> lastIfdIds(producersCnt, -1);
+    int poppedCnt = 0;
+    UpsyncInput popped;
+    while (poppedCnt < producersCnt * perProducerCnt) {
+        if (!que.Pop_NotThreadSafe(popped)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int arrIdx = popped.joinIndex - 1;
+        assert(0 <= arrIdx && arrIdx < producersCnt);
+        assert(lastIfdIds[arrIdx] + 1 == popped.ifdId);
+        assert((uint64_t)popped.ifdId == popped.input);
+        lastIfdIds[arrIdx] = popped.ifdId;
+        ++poppedCnt;
+    }
+
+    for (std::thread& th : ths) {
+        if (th.joinable()) {
+            th.join();
+        }
+    }
+    assert(!que.Pop_NotThreadSafe(popped));
+
+    std::ostringstream oss;
+    oss << "poppedCnt=" << poppedCnt << "\npushFailureCnt=" << pushFailureCnt;
+    std::cout << oss.str() << std::endl;
+    std::cout << "Passed TestCase2" << std::endl;
+    return true;
+}
+
+// Program entry point
+int main(int argc, char** argv)
+{
+    runTestCase1();
+    runTestCase2();
+	return 0;
+}
+
+#ifdef _WIN32
+#include <windows.h>
+
+int APIENTRY WinMain(HINSTANCE hInstance,
+    HINSTANCE hPrevInstance,
+    LPSTR lpCmdLine, int nCmdShow)
+{
+    return main(__argc, __argv);
+}
+#endif
@@ -0,0 +1,34 @@
+set(UPSYNC_INPUT_QUEUE_TEST_ROOT ${JOLT_BINDINGS_ROOT}/CppTests/UpsyncInputQueue)
+
+# Source files
+set(UPSYNC_INPUT_QUEUE_TEST_SRC_FILES
+	${UPSYNC_INPUT_QUEUE_TEST_ROOT}/Test.cpp
+    ${JOLT_BINDINGS_ROOT}/joltc/DebugLog.cpp
+)
+
+add_executable(UpsyncInputQueueTest ${UPSYNC_INPUT_QUEUE_TEST_SRC_FILES})
+
+if (MSVC)
+else ()
+    set_target_properties(
+        UpsyncInputQueueTest
+        PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+        LIBRARY_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+        ARCHIVE_OUTPUT_DIRECTORY "${OVERRIDE_BINARY_DESTINATION}"
+    )
+endif ()
+
+if (MSVC)
+    set_property(DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR} PROPERTY VS_STARTUP_PROJECT UpsyncInputQueueTest)
+    target_link_options(UpsyncInputQueueTest PUBLIC "/SUBSYSTEM:CONSOLE")
+
+	# Enable use of exceptions in MSVC's STL
+	target_compile_definitions(UpsyncInputQueueTest PUBLIC $<$<BOOL:${MSVC}>:_HAS_EXCEPTIONS=1>)
+	target_compile_options(UpsyncInputQueueTest PRIVATE /EHsc)
+endif()
+
+target_include_directories(UpsyncInputQueueTest PUBLIC
+    $<BUILD_INTERFACE:${JOLT_BINDINGS_ROOT}/joltc>
+    $<BUILD_INTERFACE:${PB_GEN_ROOT}>
+    $<INSTALL_INTERFACE:/include>)
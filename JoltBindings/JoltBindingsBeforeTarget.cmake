@@ -63,6 +63,9 @@ option(TRACK_BROADPHASE_STATS "Track BroadPhase Stats" OFF)
 # Setting to periodically trace NarrowPhase stats to help determine which collision queries could be optimized
 option(TRACK_NARROWPHASE_STATS "Track NarrowPhase Stats" OFF)
 
+# Setting to accumulate per-phase wall time of "BaseBattle::CalcSingleStep", readable by "APP_GetStepProfile". Zero cost when off.
+option(STEP_PROFILER "Per-phase step profiler of joltc" OFF)
+
 # Enable the debug renderer in the Debug and Release builds. Note that DEBUG_RENDERER_IN_DISTRIBUTION will override this setting.
 option(DEBUG_RENDERER_IN_DEBUG_AND_RELEASE "Enable debug renderer in Debug and Release builds" OFF)
 
@@ -211,10 +214,18 @@ set(JOLTC_SRC_FILES
     ${JOLTC_ROOT}/CollisionLayers.h
     ${JOLTC_ROOT}/PbConsts.h
     ${JOLTC_ROOT}/CppOnlyConsts.h
+    ${JOLTC_ROOT}/UdFlatMap.h
+    ${JOLTC_ROOT}/UdFlatMap.inl
+    ${JOLTC_ROOT}/StaticMapShapeCache.h
+    ${JOLTC_ROOT}/StaticMapShapeCache.cpp
+    ${JOLTC_ROOT}/StepProfiler.h
     ${JOLTC_ROOT}/BaseBattle.h
     ${JOLTC_ROOT}/BaseBattle.cpp
+    ${JOLTC_ROOT}/UpsyncInputQueue.h
     ${JOLTC_ROOT}/BackendBattle.h
     ${JOLTC_ROOT}/BackendBattle.cpp
+    ${JOLTC_ROOT}/BackendRoomHost.h
+    ${JOLTC_ROOT}/BackendRoomHost.cpp
     ${JOLTC_ROOT}/FrontendBattle.h
     ${JOLTC_ROOT}/FrontendBattle.cpp
     ${JOLTC_ROOT}/BaseBattleCollisionFilter.h
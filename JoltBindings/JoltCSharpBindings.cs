@@ -23,6 +23,21 @@ namespace JoltCSharp {
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool JPH_Shutdown(); // Destroys default allocators
 
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool JPH_InitSharedJobSystem(int nThreads); // Creates a process-wide job system pool borrowed by all battles created afterwards
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool JPH_SaveStaticMapCache([MarshalAs(UnmanagedType.LPStr)] string filePath); // Persists the process-wide cache of cooked static map shapes
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool JPH_LoadStaticMapCache([MarshalAs(UnmanagedType.LPStr)] string filePath); // Warms up the process-wide cache of cooked static map shapes
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void JPH_ClearStaticMapCache();
+
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern void APP_ClearBattle(UIntPtr inBattle);
 
@@ -46,10 +61,22 @@ namespace JoltCSharp {
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool APP_GetFrameLog(UIntPtr inBattle, int inRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit);
 
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool APP_GetStepProfile(UIntPtr inBattle, long* outStepCnt, long* outAccumNanos, long* outMaxNanos, int phaseCntLimit, int* outPhaseCnt, [MarshalAs(UnmanagedType.U1)] bool resetAfterRead);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool APP_GetRdfChecksum(UIntPtr inBattle, int inRdfId, ulong* outChecksum);
+
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool APP_SetFrameLogEnabled(UIntPtr inBattle, [MarshalAs(UnmanagedType.U1)] bool val);
 
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool APP_SetStaticBarrierMergeEnabled(UIntPtr inBattle, [MarshalAs(UnmanagedType.U1)] bool val); // Returns the old value, takes effect upon the next ResetStartRdf
+
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool APP_GetStepResult(UIntPtr inBattle, int inRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit);
@@ -112,7 +139,7 @@ namespace JoltCSharp {
         public static extern int APP_ConvertToLastUsedRenderFrameId(int inputFrameId);
 
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
-        public static extern UIntPtr FRONTEND_CreateBattle(int rdfBufferSize, [MarshalAs(UnmanagedType.U1)] bool isOnlineArenaMode);
+        public static extern UIntPtr FRONTEND_CreateBattle(int rdfBufferSize, [MarshalAs(UnmanagedType.U1)] bool isOnlineArenaMode, int nBytesForTempAllocator);
 
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         [return: MarshalAs(UnmanagedType.U1)]
@@ -134,6 +161,14 @@ namespace JoltCSharp {
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool FRONTEND_ChaseRolledBackRdfs(UIntPtr inBattle, int* outChaserRdfId, [MarshalAs(UnmanagedType.U1)] bool toTimerRdfId);
 
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool FRONTEND_ChaseRolledBackRdfsWithBudget(UIntPtr inBattle, int budgetMicros, int* outChaserRdfId, int* outChasedRdfCnt);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool FRONTEND_GetRollbackStats(UIntPtr inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit, [MarshalAs(UnmanagedType.U1)] bool resetAfterRead);
+
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool FRONTEND_GetRdfAndIfdIds(UIntPtr inBattle, int* outTimerRdfId, int* outChaserRdfId, int* outChaserRdfIdLowerBound, int* outLcacIfdId, int* outUdpLcacIfdId, int* outTimerRdfIdGenIfdId, int* outTimerRdfIdToUseIfdId); 
@@ -151,7 +186,7 @@ namespace JoltCSharp {
         public static extern bool FRONTEND_OnDownsyncSnapshotReceived(UIntPtr inBattle, char* inBytes, int inBytesCnt, int* outPostTimerRdfEvictedCnt, int* outPostTimerRdfDelayedIfdEvictedCnt, int* outChaserRdfId, int* outLcacIfdId, int* outUdpLcacIfdId, int* outMaxPlayerInputFrontId, int* outMinPlayerInputFrontId);
 
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
-        public static extern UIntPtr BACKEND_CreateBattle(int rdfBufferSize);
+        public static extern UIntPtr BACKEND_CreateBattle(int rdfBufferSize, int nBytesForTempAllocator);
 
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         [return: MarshalAs(UnmanagedType.U1)]
@@ -174,6 +209,55 @@ namespace JoltCSharp {
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern int BACKEND_GetDynamicsRdfId(UIntPtr inBattle);
 
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool BACKEND_TakeUnfitDownsyncSnapshot(UIntPtr inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool BACKEND_SetRefRdfDeltaEnabled(UIntPtr inBattle, [MarshalAs(UnmanagedType.U1)] bool val);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int BACKEND_GetFirstDesyncedRdfId(UIntPtr inBattle, uint joinIndex);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int BACKEND_SetIfdBufferSizeCap(UIntPtr inBattle, int cap);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool BACKEND_EnqueueUpsyncInput(UIntPtr inBattle, uint joinIndex, int ifdId, ulong input, [MarshalAs(UnmanagedType.U1)] bool fromUdp, [MarshalAs(UnmanagedType.U1)] bool fromTcp);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int BACKEND_DrainUpsyncInputs(UIntPtr inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern UIntPtr HOST_Create(int maxRoomsCnt, int nWorkers, int rdfBufferSize, int nBytesForTempAllocatorPerRoom, int downsyncBytesCntLimitPerRoom);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool HOST_Destroy(UIntPtr inHost);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int HOST_AddRoom(UIntPtr inHost, char* inBytes, int inBytesCnt);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern UIntPtr HOST_GetRoomBattle(UIntPtr inHost, int roomId);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool HOST_SubmitUpsync(UIntPtr inHost, int roomId, char* inBytes, int inBytesCnt, [MarshalAs(UnmanagedType.U1)] bool fromUdp, [MarshalAs(UnmanagedType.U1)] bool fromTcp);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool HOST_SubmitUpsyncInput(UIntPtr inHost, int roomId, uint joinIndex, int ifdId, ulong input, [MarshalAs(UnmanagedType.U1)] bool fromUdp, [MarshalAs(UnmanagedType.U1)] bool fromTcp);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int HOST_StepAll(UIntPtr inHost, [MarshalAs(UnmanagedType.U1)] bool withRefRdf);
+
+        [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool HOST_CollectDownsyncs(UIntPtr inHost, char* outBytesPreallocatedStart, long* outBytesCntLimit);
+
         //------------------------------------------------------------------------------------------------
         [DllImport(JOLT_LIB, CallingConvention = CallingConvention.Cdecl)]
         public static extern void RegisterDebugCallback(debugCallback cb);
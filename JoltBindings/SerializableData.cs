@@ -220,660 +220,677 @@ namespace jtshared {
             "CgtidG5fYl9sZXZlbBgEIAEoBBITCgtidG5fY19sZXZlbBgFIAEoBBITCgti",
             "dG5fZF9sZXZlbBgGIAEoBBITCgtidG5fZV9sZXZlbBgHIAEoBBITCgtidG5f",
             "Zl9sZXZlbBgIIAEoBBITCgtidG5fbF9sZXZlbBgJIAEoBBITCgtidG5fcl9s",
-            "ZXZlbBgKIAEoBCI1Cg5VcHN5bmNTbmFwc2hvdBIRCglzdF9pZmRfaWQYASAB",
-            "KAUSEAoIY21kX2xpc3QYAiADKAQi8QUKBVdzUmVxEg4KBnNlcV9ubxgBIAEo",
-            "DRISCgpqb2luX2luZGV4GAIgASgNEiAKA2FjdBgDIAEoDjITLmp0c2hhcmVk",
-            "LlVwc3luY0FjdBIQCghhdXRoX2tleRgEIAEoBRIxCg91cHN5bmNfc25hcHNo",
-            "b3QYBSABKAsyGC5qdHNoYXJlZC5VcHN5bmNTbmFwc2hvdBIuCg9zZWxmX3Bh",
-            "cnNlZF9yZGYYBiABKAsyFS5qdHNoYXJlZC5SZW5kZXJGcmFtZRIfChdiYXR0",
-            "bGVfZHVyYXRpb25fc2Vjb25kcxgHIAEoBRJAChNzZXJpYWxpemVkX2JhcnJp",
-            "ZXJzGAggAygLMiMuanRzaGFyZWQuU2VyaWFsaXplZEJhcnJpZXJDb2xsaWRl",
-            "chJUChxwcmVhbGxvY2F0ZV9ucGNfc3BlY2llc19kaWN0GAsgAygLMi4uanRz",
-            "aGFyZWQuV3NSZXEuUHJlYWxsb2NhdGVOcGNTcGVjaWVzRGljdEVudHJ5EkEK",
-            "GnRyYXBfY29uZmlnX2Zyb21fdGlsZV9saXN0GAwgAygLMh0uanRzaGFyZWQu",
-            "VHJhcENvbmZpZ0Zyb21UaWxlZBJHCh10cmlnZ2VyX2NvbmZpZ19mcm9tX3Rp",
-            "bGVfbGlzdBgNIAMoCzIgLmp0c2hhcmVkLlRyaWdnZXJDb25maWdGcm9tVGls",
-            "ZWQSSQoecGlja2FibGVfY29uZmlnX2Zyb21fdGlsZV9saXN0GA4gAygLMiEu",
-            "anRzaGFyZWQuUGlja2FibGVDb25maWdGcm9tVGlsZWQSGwoTZmFsbGVuX2Rl",
-            "YXRoX2hlaWdodBgPIAEoAhI+ChZiYXR0bGVfc3BlY2lmaWNfY29uZmlnGBAg",
-            "ASgLMh4uanRzaGFyZWQuQmF0dGxlU3BlY2lmaWNDb25maWcaQAoeUHJlYWxs",
-            "b2NhdGVOcGNTcGVjaWVzRGljdEVudHJ5EgsKA2tleRgBIAEoDRINCgV2YWx1",
-            "ZRgCIAEoDToCOAEi4QEKCVBhdHJvbEN1ZRIKCgJpZBgBIAEoBRIOCgZmbF9h",
-            "Y3QYAiABKAQSDgoGZnJfYWN0GAMgASgEEhkKEWZsX2NhcHR1cmVfZnJhbWVz",
-            "GAQgASgFEhkKEWZyX2NhcHR1cmVfZnJhbWVzGAUgASgFEg4KBmZkX2FjdBgG",
-            "IAEoBBIOCgZmdV9hY3QYByABKAQSGQoRZmRfY2FwdHVyZV9mcmFtZXMYCCAB",
-            "KAUSGQoRZnVfY2FwdHVyZV9mcmFtZXMYCSABKAUSHAoTY29sbGlzaW9uX3R5",
-            "cGVfbWFzaxiFCCABKAQihRcKDEJ1bGxldENvbmZpZxIWCg5zdGFydHVwX2Zy",
-            "YW1lcxgBIAEoBRIhChlzdGFydHVwX2ludmluc2libGVfZnJhbWVzGAIgASgF",
-            "EhwKFGNhbmNlbGxhYmxlX3N0X2ZyYW1lGAMgASgFEhwKFGNhbmNlbGxhYmxl",
-            "X2VkX2ZyYW1lGAQgASgFEhUKDWFjdGl2ZV9mcmFtZXMYBSABKAUSFwoPY29v",
-            "bGRvd25fZnJhbWVzGAYgASgFEhcKD2hpdF9zdHVuX2ZyYW1lcxgHIAEoBRIZ",
-            "ChFibG9ja19zdHVuX2ZyYW1lcxgIIAEoBRIWCg5wdXNoYmFja192ZWxfeBgJ",
-            "IAEoAhIWCg5wdXNoYmFja192ZWxfeRgKIAEoAhIOCgZkYW1hZ2UYCyABKAUS",
-            "FwoPc2VsZl9sb2NrX3ZlbF94GAwgASgCEhcKD3NlbGZfbG9ja192ZWxfeRgN",
-            "IAEoAhIjChtzZWxmX2xvY2tfdmVsX3lfd2hlbl9mbHlpbmcYDiABKAISFwoP",
-            "aGl0Ym94X29mZnNldF94GA8gASgCEhcKD2hpdGJveF9vZmZzZXRfeRgQIAEo",
-            "AhIaChJoaXRib3hfaGFsZl9zaXplX3gYESABKAISGgoSaGl0Ym94X2hhbGZf",
-            "c2l6ZV95GBIgASgCEiIKGm1lbGVlX2hpdF9zZWxmX3N0dW5fZnJhbWVzGBMg",
-            "ASgFEiYKHmFjdGl2ZV9hbmltX2xvb3BpbmdfcmRmX29mZnNldBgVIAEoBRIe",
-            "ChZ2YW5pc2hpbmdfYW5pbV9yZGZfY250GBcgASgFEikKIXZhbmlzaGluZ19h",
-            "bmltX2xvb3BpbmdfcmRmX29mZnNldBgYIAEoBRIYChBoaXRfYW5pbV9yZGZf",
-            "Y250GBogASgFEiQKBmJfdHlwZRgbIAEoDjIULmp0c2hhcmVkLkJ1bGxldFR5",
-            "cGUSJwoHbWhfdHlwZRgcIAEoDjIWLmp0c2hhcmVkLk11bHRpSGl0VHlwZRIi",
-            "ChpzaW11bHRhbmVvdXNfbXVsdGlfaGl0X2NudBgdIAEoDRINCgVzcGVlZBge",
-            "IAEoAhIYChBzcGVlZF9pZl9ub3RfaGl0GB8gASgCEhAKCGhhcmRuZXNzGCAg",
-            "ASgFEh0KFWhpdF9pbnZpbnNpYmxlX2ZyYW1lcxgjIAEoBRIUCgxwZXJwX2Fj",
-            "Y19tYWcYJSABKAUSIAoYZGVsYXlfc2VsZl92ZWxfdG9fYWN0aXZlGCYgASgI",
-            "EhwKFGhpdF9vbl9tdWx0aV9jb250YWN0GCcgASgIEhoKEm9taXRfc29mdF9w",
-            "dXNoYmFjaxgoIAEoCBIYChByZW1haW5zX3Vwb25faGl0GCkgASgIEiYKHnJl",
-            "bmRlcl9yb3RhdGlvbl9hbG9uZ192ZWxvY2l0eRgqIAEoCBIPCgdibG93X3Vw",
-            "GC4gASgIEhQKDHJlcGVhdF9xdW90YRgvIAEoBRIeChZtaF92YW5pc2hfb25f",
-            "bWVsZWVfaGl0GDAgASgIEh0KFW1oX3VwZGF0ZXNfb3JpZ2luX3BvcxgyIAEo",
-            "CBIWCg5iZWFtX2NvbGxpc2lvbhgzIAEoCBIQCghmb3JfYWxseRg0IAEoCBIZ",
-            "ChFoaXRib3hfc2l6ZV9pbmNfeBg1IAEoAhIZChFoaXRib3hfc2l6ZV9pbmNf",
-            "eRg2IAEoAhIWCg5hbGxvd3Nfd2Fsa2luZxg3IAEoCBIYChBhbGxvd3NfY3Jv",
-            "dWNoaW5nGDggASgIEhcKD2VsZW1lbnRhbF9hdHRycxg7IAEoDRIaChJiZWFt",
-            "X3Zpc3VhbF9zaXplX3kYQCABKAISIAoYdG91Y2hfaGl0X2JvbWJfY29sbGlz",
-            "aW9uGEEgASgIEh4KFmFpcl9yaWRpbmdfZ3JvdW5kX3dhdmUYQiABKAgSJQod",
-            "Z3JvdW5kX2ltcGFjdF9tZWxlZV9jb2xsaXNpb24YQyABKAgSIwobd2FsbF9p",
-            "bXBhY3RfbWVsZWVfY29sbGlzaW9uGEQgASgIEhgKEG1oX2luaGVyaXRzX3Nw",
-            "aW4YRSABKAgSJQoGaW5pdF9xGEYgASgLMhAuanRzaGFyZWQuUGJRdWF0SACI",
-            "AQESFQoIZnJpY3Rpb24YRyABKAJIAYgBARIYCgtyZXN0aXR1dGlvbhhIIAEo",
-            "AkgCiAEBEhsKDmdyYXZpdHlfZmFjdG9yGEkgASgCSAOIAQESEwoLbm9faGl0",
-            "X2FuaW0YSiABKAgSHwoDaWZjGEsgASgOMhIuanRzaGFyZWQuSWZhY2VDYXQS",
-            "KAogcmVmbGVjdF9maXJlYmFsbF94X2lmX25vdF9oYXJkZXIYTCABKAgSLQol",
-            "cmVqZWN0X3JlZmxlY3Rpb25fZnJvbV9hbm90aGVyX2J1bGxldBhNIAEoCBIg",
-            "Chhwcm92aWRlc194X2hhcmRfcHVzaGJhY2sYTiABKAgSJAoccHJvdmlkZXNf",
-            "eV9oYXJkX3B1c2hiYWNrX3RvcBhPIAEoCBInCh9wcm92aWRlc195X2hhcmRf",
-            "cHVzaGJhY2tfYm90dG9tGFAgASgIEiEKGWlnbm9yZV9zbG9wZV9kZWNlbGVy",
-            "YXRpb24YUSABKAgSIQoZcm90YXRlX29mZmVuZGVyX3dpdGhfc3BpbhhSIAEo",
-            "CBIgChhtaF9ub3RfdHJpZ2dlcl9vbl9jaF9oaXQYUyABKAgSKwojbWhfbm90",
-            "X3RyaWdnZXJfb25faGFyZGVyX2J1bGxldF9oaXQYVCABKAgSKwojbWhfbm90",
-            "X3RyaWdnZXJfb25faGFyZF9wdXNoYmFja19oaXQYVSABKAgSFgoOaG9wcGVy",
-            "X21pc3NpbGUYViABKAgSFgoOYmVhbV9yZW5kZXJpbmcYVyABKAgSKgoibWlz",
-            "c2lsZV9zZWFyY2hfaW50ZXJ2YWxfcG93Mk1pbnVzMRhYIAEoDRIvCid1c2Vf",
-            "Y2hfb2Zmc2V0X3JlZ2FyZGxlc3Nfb2ZfZW1pc3Npb25fbWgYWSABKAgSIQoZ",
-            "Z2F1Z2VfaW5jX3JlZHVjdGlvbl9yYXRpbxhdIAEoAhImCh5taF9pbmhlcml0",
-            "c19mcmFtZXNfaW5fYmxfc3RhdGUYXiABKAgSIwobZ3VhcmRfYnJlYWtlcl9l",
-            "eHRyYV9oaXRfY250GF8gASgFEhgKEGZpbmlzaGluZ19mcmFtZXMYYSABKAUS",
-            "Jwofbm9fdmFuaXNoX2FuaW1fb25faGFyZF9wdXNoYmFjaxhiIAEoCBIcChNj",
-            "b2xsaXNpb25fdHlwZV9tYXNrGIUIIAEoBBIWCg10YWtlc19ncmF2aXR5GIYI",
-            "IAEoCBIqCgtidWZmX2NvbmZpZxiHCCABKAsyFC5qdHNoYXJlZC5CdWZmQ29u",
-            "ZmlnEkIKDmNhbmNlbF90cmFuc2l0GIgIIAMoCzIpLmp0c2hhcmVkLkJ1bGxl",
-            "dENvbmZpZy5DYW5jZWxUcmFuc2l0RW50cnkSIAoXY2hhcmFjdGVyX2VtaXRf",
-            "c2Z4X25hbWUYgBAgASgJEh8KFmZpcmViYWxsX2VtaXRfc2Z4X25hbWUYgRAg",
-            "ASgJEhUKDGhpdF9zZnhfbmFtZRiCECABKAkSGAoPYWN0aXZlX3NmeF9uYW1l",
-            "GIMQIAEoCRIeChVoaXRfb25fZmxlc2hfc2Z4X25hbWUYhBAgASgJEh0KFGhp",
-            "dF9vbl9yb2NrX3NmeF9uYW1lGIUQIAEoCRIeChVoaXRfb25fbWV0YWxfc2Z4",
-            "X25hbWUYhhAgASgJEh0KFGhpdF9vbl93b29kX3NmeF9uYW1lGIcQIAEoCRIS",
-            "CglhbmltX25hbWUYiBAgASgJGjQKEkNhbmNlbFRyYW5zaXRFbnRyeRILCgNr",
-            "ZXkYASABKAUSDQoFdmFsdWUYAiABKA06AjgBQgkKB19pbml0X3FCCwoJX2Zy",
-            "aWN0aW9uQg4KDF9yZXN0aXR1dGlvbkIRCg9fZ3Jhdml0eV9mYWN0b3Ii4AQK",
-            "BkJ1bGxldBInCghibF9zdGF0ZRgBIAEoDjIVLmp0c2hhcmVkLkJ1bGxldFN0",
-            "YXRlEhoKEmZyYW1lc19pbl9ibF9zdGF0ZRgCIAEoBRIKCgJ1ZBgDIAEoBBIi",
-            "ChpvcmlnaW5hdGVkX3JlbmRlcl9mcmFtZV9pZBgEIAEoBRITCgtvZmZlbmRl",
-            "cl91ZBgFIAEoBBIJCgF4GAYgASgCEgkKAXkYByABKAISCQoBehgIIAEoAhIL",
-            "CgNxX3gYCSABKAISCwoDcV95GAogASgCEgsKA3FfehgLIAEoAhILCgNxX3cY",
-            "DCABKAISDQoFdmVsX3gYDSABKAISDQoFdmVsX3kYDiABKAISDQoFdmVsX3oY",
-            "DyABKAISFAoMb3JpZ2luYXRlZF94GBAgASgCEhQKDG9yaWdpbmF0ZWRfeRgR",
-            "IAEoAhIUCgxvcmlnaW5hdGVkX3oYEiABKAISGQoRcmVwZWF0X3F1b3RhX2xl",
-            "ZnQYEyABKAUSEQoJdGFyZ2V0X3VkGBUgASgEEhUKDWRhbWFnZV9kZWFsZWQY",
-            "FiABKAUSJgoKaGl0X29uX2lmYxgXIAEoDjISLmp0c2hhcmVkLklmYWNlQ2F0",
-            "EhgKEGFjdGl2ZV9za2lsbF9oaXQYGSABKAUSEAoIc2tpbGxfaWQYGiABKA0S",
-            "CgoCaWQYGyABKA0SDwoHdGVhbV9pZBgcIAEoBRIQCghmb3JfYWxseRgdIAEo",
-            "CBIUCgxncm91bmRfdmVsX3gYHiABKAISFAoMZ3JvdW5kX3ZlbF95GB8gASgC",
-            "EhQKDGdyb3VuZF92ZWxfehggIAEoAiK3BAoKVHJhcENvbmZpZxILCgN0cHQY",
-            "ASABKA0SFwoPZHlpbmdfYW5pbV9uYW1lGAIgASgJEhoKEmR5aW5nX2FuaW1f",
-            "cmRmX2NudBgDIAEoBRIPCgdibG93X3VwGAQgASgIEhYKDmNvbnRhY3RfZGFt",
-            "YWdlGAUgASgFEhcKD2hpdF9zdHVuX2ZyYW1lcxgGIAEoBRIdChVoaXRfaW52",
-            "aW5zaWJsZV9mcmFtZXMYByABKAUSFQoNZGVhY3RpdmF0YWJsZRgIIAEoCBIQ",
-            "CghoYXJkbmVzcxgJIAEoBRIhChlkZWFjdGl2YXRlX3Vwb25fdHJpZ2dlcmVk",
-            "GAogASgIEhgKEHN1cmZhY2VfZnJpY3Rpb24YCyABKAISFQoNdXNlX2tpbmVt",
-            "YXRpYxgMIAEoCBIVCg1hdGsxX3NraWxsX2lkGBcgASgNEh8KF2RlZmF1bHRf",
-            "Ym94X2hhbGZfc2l6ZV94GBogASgCEh8KF2RlZmF1bHRfYm94X2hhbGZfc2l6",
-            "ZV95GBsgASgCEhwKFGRlZmF1bHRfbGluZWFyX3NwZWVkGBwgASgCEh0KFWRl",
-            "ZmF1bHRfYW5ndWxhcl9zcGVlZBgdIAEoAhIiChpkZWZhdWx0X2Nvb2xkb3du",
-            "X3JkZl9jb3VudBgeIAEoBRIjCht1c2Vfb2JzdGFibGVfaW50ZXJmYWNlX2Jv",
-            "ZHkYHyABKAgSGwoTbm9feF9mbGlwX3JlbmRlcmluZxggIAEoCBINCgRuYW1l",
-            "GIAIIAEoCSKrBgoTVHJhcENvbmZpZ0Zyb21UaWxlZBIKCgJpZBgBIAEoDRIL",
-            "CgN0cHQYAiABKA0SDQoFcXVvdGEYAyABKAUSFwoPYm94X2hhbGZfc2l6ZV94",
-            "GAQgASgCEhcKD2JveF9oYWxmX3NpemVfeRgFIAEoAhIUCgxsaW5lYXJfc3Bl",
-            "ZWQYBiABKAISFQoNYW5ndWxhcl9zcGVlZBgHIAEoAhIOCgZpbml0X3gYCCAB",
-            "KAISDgoGaW5pdF95GAkgASgCEg4KBmluaXRfehgKIAEoAhIQCghpbml0X3Ff",
-            "eBgLIAEoAhIQCghpbml0X3FfeRgMIAEoAhIQCghpbml0X3FfehgNIAEoAhIQ",
-            "Cghpbml0X3FfdxgOIAEoAhISCgppbml0X3ZlbF94GA8gASgCEhIKCmluaXRf",
-            "dmVsX3kYECABKAISEgoKaW5pdF92ZWxfehgRIAEoAhIWCg5pbml0X2FuZ192",
-            "ZWxfeBgSIAEoAhIWCg5pbml0X2FuZ192ZWxfeRgTIAEoAhIWCg5pbml0X2Fu",
-            "Z192ZWxfehgUIAEoAhIaChJjb29sZG93bl9yZGZfY291bnQYFSABKAUSFQoN",
-            "c2xpZGVyX2F4aXNfeBgWIAEoAhIVCg1zbGlkZXJfYXhpc195GBcgASgCEhUK",
-            "DXNsaWRlcl9heGlzX3oYGCABKAISMwoMYmFycmllcl9hdHRyGBkgASgLMh0u",
-            "anRzaGFyZWQuQmFycmllckNvbGxpZGVyQXR0chIzCgVvb2libxgaIAEoDjIk",
-            "Lmp0c2hhcmVkLk92ZXJyaWRlT2JzSWZhY2VCb2R5T3B0aW9uEiAKGHN1YnNj",
-            "cmliZXNfdG9fdHJpZ2dlcl9pZBgbIAEoDRIVCgdsaW1pdF8xGIABIAEoAkgA",
-            "iAEBEhUKB2xpbWl0XzIYgQEgASgCSAGIAQESFQoHbGltaXRfMxiCASABKAJI",
-            "AogBARIVCgdsaW1pdF80GIMBIAEoAkgDiAEBEhgKD2luaXRfbm90X21vdmlu",
-            "ZxiABCABKAhCCgoIX2xpbWl0XzFCCgoIX2xpbWl0XzJCCgoIX2xpbWl0XzNC",
-            "CgoIX2xpbWl0XzQi7gEKE0JhcnJpZXJDb2xsaWRlckF0dHISHgoWcHJvdmlk",
-            "ZXNfaGFyZF9wdXNoYmFjaxgBIAEoCBIaChJwcm92aWRlc19zbGlwX2p1bXAY",
-            "AiABKAgSHwoXcHJvaGliaXRzX3dhbGxfZ3JhYmJpbmcYAyABKAgSIQoZb25s",
-            "eV9hbGxvd3NfYWxpZ25lZF92ZWxfeBgFIAEoBRIhChlvbmx5X2FsbG93c19h",
-            "bGlnbmVkX3ZlbF95GAYgASgFEhkKEXByb3ZpZGVzX3N0YWlyc19wGAcgASgI",
-            "EhkKEXByb3ZpZGVzX3N0YWlyc19uGAggASgIIqECCgRUcmFwEgoKAmlkGAEg",
-            "ASgNEgsKA3RwdBgCIAEoDRInCgp0cmFwX3N0YXRlGAQgASgOMhMuanRzaGFy",
-            "ZWQuVHJhcFN0YXRlEhwKFGZyYW1lc19pbl90cmFwX3N0YXRlGAUgASgFEgkK",
-            "AXgYDSABKAISCQoBeRgOIAEoAhIJCgF6GA8gASgCEgsKA3FfeBgQIAEoAhIL",
-            "CgNxX3kYESABKAISCwoDcV96GBIgASgCEgsKA3FfdxgTIAEoAhINCgV2ZWxf",
-            "eBgUIAEoAhINCgV2ZWxfeRgVIAEoAhINCgV2ZWxfehgWIAEoAhIRCglhbmdf",
-            "dmVsX3gYFyABKAISEQoJYW5nX3ZlbF95GBggASgCEhEKCWFuZ192ZWxfehgZ",
-            "IAEoAiJJCgtQZWVyVWRwQWRkchIKCgJpcBgBIAEoCRIMCgRwb3J0GAIgASgF",
-            "EhAKCGF1dGhfa2V5GAMgASgFEg4KBnNlcV9ubxgEIAEoDSI6CgxTdGVhbUJp",
-            "bmRpbmcSEwoLdWxfc3RlYW1faWQYASABKAQSFQoNY2hfc3BlY2llc19pZBgC",
-            "IAEoDSLBAwoKU3RlcFJlc3VsdBIoCgthaW1pbmdfcmF5cxgBIAMoCzITLmp0",
-            "c2hhcmVkLkFpbWluZ1JheRIYChBhaW1pbmdfcmF5X2NvdW50GAIgASgNEi0K",
-            "EmZ1bGZpbGxlZF90cmlnZ2VycxgDIAMoCzIRLmp0c2hhcmVkLlRyaWdnZXIS",
-            "TAoVZnVsZmlsbGVkX3RyaWdnZXJfaWRzGAQgAygLMi0uanRzaGFyZWQuU3Rl",
-            "cFJlc3VsdC5GdWxmaWxsZWRUcmlnZ2VySWRzRW50cnkSVwobZnVsZmlsbGVk",
-            "X3RyaWdnZXJfZ3JvdXBfaWRzGAUgAygLMjIuanRzaGFyZWQuU3RlcFJlc3Vs",
-            "dC5GdWxmaWxsZWRUcmlnZ2VyR3JvdXBJZHNFbnRyeRIcChRwcmVwYXJlZF90",
-            "cmlnZ2VyX3VkcxgGIAMoBBo6ChhGdWxmaWxsZWRUcmlnZ2VySWRzRW50cnkS",
-            "CwoDa2V5GAEgASgNEg0KBXZhbHVlGAIgASgIOgI4ARo/Ch1GdWxmaWxsZWRU",
-            "cmlnZ2VyR3JvdXBJZHNFbnRyeRILCgNrZXkYASABKA0SDQoFdmFsdWUYAiAB",
-            "KAg6AjgBIu4DCgtSZW5kZXJGcmFtZRIKCgJpZBgBIAEoBRIyCgdwbGF5ZXJz",
-            "GAIgAygLMiEuanRzaGFyZWQuUGxheWVyQ2hhcmFjdGVyRG93bnN5bmMSFwoP",
-            "Y291bnRkb3duX25hbm9zGAMgASgDEiEKB2J1bGxldHMYBCADKAsyEC5qdHNo",
-            "YXJlZC5CdWxsZXQSLAoEbnBjcxgFIAMoCzIeLmp0c2hhcmVkLk5wY0NoYXJh",
-            "Y3RlckRvd25zeW5jEiUKDWR5bmFtaWNfdHJhcHMYBiADKAsyDi5qdHNoYXJl",
-            "ZC5UcmFwEiMKCHRyaWdnZXJzGAcgAygLMhEuanRzaGFyZWQuVHJpZ2dlchIl",
-            "CglwaWNrYWJsZXMYCCADKAsyEi5qdHNoYXJlZC5QaWNrYWJsZRIZChFidWxs",
-            "ZXRfaWRfY291bnRlchgJIAEoDRIUCgxidWxsZXRfY291bnQYCiABKA0SFgoO",
-            "bnBjX2lkX2NvdW50ZXIYCyABKA0SEQoJbnBjX2NvdW50GAwgASgNEhUKDXRy",
-            "aWdnZXJfY291bnQYDSABKA0SGwoTcGlja2FibGVfaWRfY291bnRlchgPIAEo",
-            "DRIWCg5waWNrYWJsZV9jb3VudBgQIAEoDRIaChJkeW5hbWljX3RyYXBfY291",
-            "bnQYESABKA0ilwEKEUJhdHRsZVByZXBhcmVJbmZvEhIKCnN0YWdlX25hbWUY",
-            "ASABKAkSFQoNYm91bmRfcm9vbV9pZBgCIAEoBRIeChZiYXR0bGVfZHVyYXRp",
-            "b25fZnJhbWVzGAMgASgDEhsKE2JvdW5kX3Jvb21fY2FwYWNpdHkYBCABKAUS",
-            "GgoRZnJhbWVfbG9nX2VuYWJsZWQYgQggASgIInEKEklucHV0RnJhbWVEb3du",
-            "c3luYxITCgtpbnB1dF9jb3VudBgBIAEoDRISCgppbnB1dF9saXN0GAIgAygE",
-            "EhYKDmNvbmZpcm1lZF9saXN0GAMgASgEEhoKEnVkcF9jb25maXJtZWRfbGlz",
-            "dBgEIAEoBCK/BAoQRG93bnN5bmNTbmFwc2hvdBISCgpyZWZfcmRmX2lkGAEg",
-            "ASgFEiYKB3JlZl9yZGYYAiABKAsyFS5qdHNoYXJlZC5SZW5kZXJGcmFtZRIY",
-            "ChB1bmNvbmZpcm1lZF9tYXNrGAMgASgEEhEKCXN0X2lmZF9pZBgEIAEoBRIv",
-            "CglpZmRfYmF0Y2gYBSADKAsyHC5qdHNoYXJlZC5JbnB1dEZyYW1lRG93bnN5",
-            "bmMSIgoDYWN0GAcgASgOMhUuanRzaGFyZWQuRG93bnN5bmNBY3QSMQoMcHJl",
-            "cGFyZV9pbmZvGAggASgLMhsuanRzaGFyZWQuQmF0dGxlUHJlcGFyZUluZm8S",
-            "MgoTYXNzaWduZWRfdWRwX3R1bm5lbBgJIAEoCzIVLmp0c2hhcmVkLlBlZXJV",
-            "ZHBBZGRyEjEKEnBlZXJfdWRwX2FkZHJfbGlzdBgKIAMoCzIVLmp0c2hhcmVk",
-            "LlBlZXJVZHBBZGRyEh0KFXBhcnRpY2lwYW50X2NoYW5nZV9pZBgLIAEoBRIa",
-            "ChJpbmFjdGl2ZV9qb2luX21hc2sYDCABKAQSFwoPcGVlcl9qb2luX2luZGV4",
-            "GA0gASgNEhsKE3BlZXJfYnVsbGV0X3RlYW1faWQYDiABKAUSFwoPcGVlcl9z",
-            "cGVjaWVzX2lkGA8gASgNEjcKF3BlZXJfc3RlYW1fYmluZGluZ19saXN0GBAg",
-            "AygLMhYuanRzaGFyZWQuU3RlYW1CaW5kaW5nEhAKB2Vycl9tc2cYgAQgASgJ",
-            "IrYDCgVTa2lsbBIKCgJpZBgBIAEoDRIXCg9yZWNvdmVyeV9mcmFtZXMYAiAB",
-            "KAUSIAoYcmVjb3ZlcnlfZnJhbWVzX29uX2Jsb2NrGAMgASgFEh4KFnJlY292",
-            "ZXJ5X2ZyYW1lc19vbl9oaXQYBCABKAUSMgoPaW52b2NhdGlvbl90eXBlGAUg",
-            "ASgOMhkuanRzaGFyZWQuU2tpbGxJbnZvY2F0aW9uEjAKDmJvdW5kX2NoX3N0",
-            "YXRlGAYgASgOMhguanRzaGFyZWQuQ2hhcmFjdGVyU3RhdGUSNwoVYm91bmRf",
-            "Y2hfc3RhdGVfb25faGl0GAcgASgOMhguanRzaGFyZWQuQ2hhcmFjdGVyU3Rh",
-            "dGUSEAoIbXBfZGVsdGEYCCABKAUSGwoTYXRrMV9tYWdhemluZV9kZWx0YRgJ",
-            "IAEoBRIdChVzdXBlcl9hdGtfZ2F1Z2VfZGVsdGEYCiABKAUSJQoEaGl0cxiA",
-            "CCADKAsyFi5qdHNoYXJlZC5CdWxsZXRDb25maWcSMgoTc2VsZl9ub25fc3Rv",
-            "Y2tfYnVmZhiBCCABKAsyFC5qdHNoYXJlZC5CdWZmQ29uZmlnIvQCCghGcmFt",
-            "ZUxvZxIiCgNyZGYYASABKAsyFS5qdHNoYXJlZC5SZW5kZXJGcmFtZRIcChRh",
-            "Y3R1YWxseV91c2VkX2lmZF9pZBgCIAEoBRIbChN1c2VkX2lmZF9pbnB1dF9s",
-            "aXN0GAMgAygEEh8KF3VzZWRfaWZkX2NvbmZpcm1lZF9saXN0GAQgASgEEiMK",
-            "G3VzZWRfaWZkX3VkcF9jb25maXJtZWRfbGlzdBgFIAEoBBIUCgx0aW1lcl9y",
-            "ZGZfaWQYBiABKAUSEwoLbGNhY19pZmRfaWQYByABKAUSFQoNY2hhc2VyX3Jk",
-            "Zl9pZBgIIAEoBRIhChljaGFzZXJfcmRmX2lkX2xvd2VyX2JvdW5kGAkgASgF",
-            "EhgKEGNoYXNlcl9zdF9yZGZfaWQYCiABKAUSGAoQY2hhc2VyX2VkX3JkZl9p",
-            "ZBgLIAEoBRIqCiJjaGFzZXJfcmRmX2lkX2xvd2VyX2JvdW5kX3NuYXRjaGVk",
-            "GAwgASgIIkgKDEJhdHRsZVJlc3VsdBIZChF3aW5uZXJfam9pbl9pbmRleBgB",
-            "IAEoDRIdChV3aW5uZXJfYnVsbGV0X3RlYW1faWQYAiABKAUiyQEKDERlYnVm",
-            "ZkNvbmZpZxISCgpzcGVjaWVzX2lkGAEgASgNEisKCnN0b2NrX3R5cGUYAiAB",
-            "KA4yFy5qdHNoYXJlZC5CdWZmU3RvY2tUeXBlEg0KBXN0b2NrGAMgASgFEiIK",
-            "BHR5cGUYBCABKA4yFC5qdHNoYXJlZC5EZWJ1ZmZUeXBlEg8KB2Fycl9pZHgY",
-            "BSABKAUSGwoTaW1wYWN0X3Blcl9pbnRlcnZhbBgGIAEoBRIXCg9pbXBhY3Rf",
-            "aW50ZXJ2YWwYByABKAUi8QMKCkJ1ZmZDb25maWcSEgoKc3BlY2llc19pZBgB",
-            "IAEoDRIrCgpzdG9ja190eXBlGAIgASgOMhcuanRzaGFyZWQuQnVmZlN0b2Nr",
-            "VHlwZRINCgVzdG9jaxgDIAEoBRITCgtzcGVlZF9kZWx0YRgEIAEoAhIgChho",
-            "aXRib3hfaGFsZl9zaXplX3hfZGVsdGEYBSABKAISIAoYaGl0Ym94X2hhbGZf",
-            "c2l6ZV95X2RlbHRhGAYgASgCEhQKDGRhbWFnZV9kZWx0YRgHIAEoBRIiChpk",
-            "YW1hZ2VfZGVsdGFfYnlfcGVyY2VudGFnZRgIIAEoBRIgChhjaGFyYWN0ZXJf",
-            "aGFyZG5lc3NfZGVsdGEYCSABKAUSHAoUbWVsZWVfaGFyZG5lc3NfZGVsdGEY",
-            "CiABKAUSHwoXZmlyZWJhbGxfaGFyZG5lc3NfZGVsdGEYCyABKAUSEgoKaW52",
-            "aW5zaWJsZRgMIAEoCBIbChN4Zm9ybV9jaF9zcGVjaWVzX2lkGA0gASgNEhsK",
-            "E3JlcGVsX3NvZnRfcHVzaGJhY2sYDiABKAgSFAoMb21pdF9ncmF2aXR5GA8g",
-            "ASgIEhoKEmFzc29jaWF0ZWRfZGVidWZmcxgRIAMoDRIfChdjaGFyYWN0ZXJf",
-            "dmZ4X2FuaW1fbmFtZRgSIAEoCSKmAQoEQnVmZhISCgpzcGVjaWVzX2lkGAEg",
-            "ASgNEg0KBXN0b2NrGAIgASgFEiIKGm9yaWdpbmF0ZWRfcmVuZGVyX2ZyYW1l",
-            "X2lkGAMgASgFEhoKEm9yaWdfY2hfc3BlY2llc19pZBgEIAEoDRIgChhvcmln",
-            "X3JlcGVsX3NvZnRfcHVzaGJhY2sYBSABKAgSGQoRb3JpZ19vbWl0X2dyYXZp",
-            "dHkYBiABKAgiKwoGRGVidWZmEhIKCnNwZWNpZXNfaWQYASABKA0SDQoFc3Rv",
-            "Y2sYAiABKAUiTQoSQnVsbGV0SW1tdW5lUmVjb3JkEhEKCWJ1bGxldF9pZBgB",
-            "IAEoDRIkChxyZW1haW5pbmdfbGlmZXRpbWVfcmRmX2NvdW50GAIgASgFIqEB",
-            "ChNJbnZlbnRvcnlTbG90Q29uZmlnEjQKCnN0b2NrX3R5cGUYASABKA4yIC5q",
-            "dHNoYXJlZC5JbnZlbnRvcnlTbG90U3RvY2tUeXBlEg0KBXF1b3RhGAIgASgN",
-            "EhkKEWZyYW1lc190b19yZWNvdmVyGAMgASgFEhYKDmdhdWdlX3JlcXVpcmVk",
-            "GAQgASgFEhIKCmJhZGdlX25hbWUYQCABKAkingEKDUludmVudG9yeVNsb3QS",
-            "NAoKc3RvY2tfdHlwZRgBIAEoDjIgLmp0c2hhcmVkLkludmVudG9yeVNsb3RT",
-            "dG9ja1R5cGUSDQoFcXVvdGEYAiABKA0SGQoRZnJhbWVzX3RvX3JlY292ZXIY",
-            "AyABKAUSFQoNZ2F1Z2VfY2hhcmdlZBgEIAEoBRIWCg5hZGhvY19za2lsbF9p",
-            "ZBgFIAEoDSIlCg9CYXR0bGVFcXVpcG1lbnQSEgoKc3BlY2llc19pZBgBIAEo",
-            "DSLCAQoOUGxheWVyU2V0dGluZ3MSEgoKc2Z4X3ZvbHVtZRgBIAEoBRISCgpi",
-            "Z21fdm9sdW1lGAIgASgFEhUKDWJ0bl9hX2JpbmRpbmcYAyABKAQSFQoNYnRu",
-            "X2JfYmluZGluZxgEIAEoBBIVCg1idG5fY19iaW5kaW5nGAUgASgEEhUKDWJ0",
-            "bl9kX2JpbmRpbmcYBiABKAQSFQoNYnRuX2VfYmluZGluZxgHIAEoBBIVCg1i",
-            "dG5fZl9iaW5kaW5nGAggASgEIvQCChRQbGF5ZXJSZWdpb25Qcm9ncmVzcxIR",
-            "CglyZWdpb25faWQYASABKAUSHQoVY29tcGxldGVkX2xldmVsX2NvdW50GAIg",
-            "ASgFElkKFnJlbWFpbmluZ19kZXBlbmRlbmNpZXMYAyADKAsyOS5qdHNoYXJl",
-            "ZC5QbGF5ZXJSZWdpb25Qcm9ncmVzcy5SZW1haW5pbmdEZXBlbmRlbmNpZXNF",
-            "bnRyeRJVChRyZW1vdmVkX2RlcGVuZGVuY2llcxgEIAMoCzI3Lmp0c2hhcmVk",
-            "LlBsYXllclJlZ2lvblByb2dyZXNzLlJlbW92ZWREZXBlbmRlbmNpZXNFbnRy",
-            "eRo8ChpSZW1haW5pbmdEZXBlbmRlbmNpZXNFbnRyeRILCgNrZXkYASABKAUS",
-            "DQoFdmFsdWUYAiABKAg6AjgBGjoKGFJlbW92ZWREZXBlbmRlbmNpZXNFbnRy",
-            "eRILCgNrZXkYASABKAUSDQoFdmFsdWUYAiABKAg6AjgBItQEChNQbGF5ZXJM",
-            "ZXZlbFByb2dyZXNzEhEKCXJlZ2lvbl9pZBgBIAEoBRIQCghsZXZlbF9pZBgC",
-            "IAEoBRIVCg1oaWdoZXN0X3Njb3JlGAMgASgFEi0KJXNob3J0ZXN0X2Zpbmlz",
-            "aF90aW1lX2F0X2hpZ2hlc3Rfc2NvcmUYBCABKAUSLQolY2hhcmFjdGVyX3Nw",
-            "ZWNpZXNfaWRfYXRfaGlnaGVzdF9zY29yZRgFIAEoDRIcChRzaG9ydGVzdF9m",
-            "aW5pc2hfdGltZRgGIAEoBRIlCh1zY29yZV9hdF9zaG9ydGVzdF9maW5pc2hf",
-            "dGltZRgHIAEoBRI0CixjaGFyYWN0ZXJfc3BlY2llc19pZF9hdF9zaG9ydGVz",
-            "dF9maW5pc2hfdGltZRgIIAEoDRJYChZyZW1haW5pbmdfZGVwZW5kZW5jaWVz",
-            "GAkgAygLMjguanRzaGFyZWQuUGxheWVyTGV2ZWxQcm9ncmVzcy5SZW1haW5p",
-            "bmdEZXBlbmRlbmNpZXNFbnRyeRJUChRyZW1vdmVkX2RlcGVuZGVuY2llcxgK",
-            "IAMoCzI2Lmp0c2hhcmVkLlBsYXllckxldmVsUHJvZ3Jlc3MuUmVtb3ZlZERl",
-            "cGVuZGVuY2llc0VudHJ5GjwKGlJlbWFpbmluZ0RlcGVuZGVuY2llc0VudHJ5",
-            "EgsKA2tleRgBIAEoBRINCgV2YWx1ZRgCIAEoCDoCOAEaOgoYUmVtb3ZlZERl",
-            "cGVuZGVuY2llc0VudHJ5EgsKA2tleRgBIAEoBRINCgV2YWx1ZRgCIAEoCDoC",
-            "OAEi3AIKFlBsYXllckNoVW5sb2NrUHJvZ3Jlc3MSEgoKc3BlY2llc19pZBgB",
-            "IAEoDRJbChZyZW1haW5pbmdfZGVwZW5kZW5jaWVzGAIgAygLMjsuanRzaGFy",
-            "ZWQuUGxheWVyQ2hVbmxvY2tQcm9ncmVzcy5SZW1haW5pbmdEZXBlbmRlbmNp",
-            "ZXNFbnRyeRJXChRyZW1vdmVkX2RlcGVuZGVuY2llcxgDIAMoCzI5Lmp0c2hh",
-            "cmVkLlBsYXllckNoVW5sb2NrUHJvZ3Jlc3MuUmVtb3ZlZERlcGVuZGVuY2ll",
-            "c0VudHJ5GjwKGlJlbWFpbmluZ0RlcGVuZGVuY2llc0VudHJ5EgsKA2tleRgB",
-            "IAEoBRINCgV2YWx1ZRgCIAEoCDoCOAEaOgoYUmVtb3ZlZERlcGVuZGVuY2ll",
-            "c0VudHJ5EgsKA2tleRgBIAEoBRINCgV2YWx1ZRgCIAEoCDoCOAEirwcKE1Bs",
-            "YXllclN0b3J5UHJvZ3Jlc3MSUwoUcmVnaW9uX3Byb2dyZXNzX2RpY3QYASAD",
-            "KAsyNS5qdHNoYXJlZC5QbGF5ZXJTdG9yeVByb2dyZXNzLlJlZ2lvblByb2dy",
-            "ZXNzRGljdEVudHJ5ElEKE2xldmVsX3Byb2dyZXNzX2RpY3QYAiADKAsyNC5q",
-            "dHNoYXJlZC5QbGF5ZXJTdG9yeVByb2dyZXNzLkxldmVsUHJvZ3Jlc3NEaWN0",
-            "RW50cnkSGAoQY3Vyc29yX3JlZ2lvbl9pZBgDIAEoBRIXCg9jdXJzb3JfbGV2",
-            "ZWxfaWQYBCABKAUSMQoEdmlldxgFIAEoDjIjLmp0c2hhcmVkLlBsYXllclN0",
-            "b3J5TW9kZVNlbGVjdFZpZXcSGwoTc2F2ZWRfYXRfZ210X21pbGxpcxgGIAEo",
-            "BBJYChdjaF91bmxvY2tfcHJvZ3Jlc3NfZGljdBgHIAMoCzI3Lmp0c2hhcmVk",
-            "LlBsYXllclN0b3J5UHJvZ3Jlc3MuQ2hVbmxvY2tQcm9ncmVzc0RpY3RFbnRy",
-            "eRISCgpjb2luX2NvdW50GAggASgNEhwKFGRyYWdvbl9jcnlzdGFsX2NvdW50",
-            "GAkgASgNEjsKFnBsYXllcl9sb3VuZ2VfcG9zaXRpb24YCiABKAsyGy5qdHNo",
-            "YXJlZC5DaGFyYWN0ZXJEb3duc3luYxJVChVmaW5pc2hlZF9zdG9yeV9wb2lu",
-            "dHMYCyADKAsyNi5qdHNoYXJlZC5QbGF5ZXJTdG9yeVByb2dyZXNzLkZpbmlz",
-            "aGVkU3RvcnlQb2ludHNFbnRyeRpZChdSZWdpb25Qcm9ncmVzc0RpY3RFbnRy",
-            "eRILCgNrZXkYASABKAUSLQoFdmFsdWUYAiABKAsyHi5qdHNoYXJlZC5QbGF5",
-            "ZXJSZWdpb25Qcm9ncmVzczoCOAEaVwoWTGV2ZWxQcm9ncmVzc0RpY3RFbnRy",
-            "eRILCgNrZXkYASABKAUSLAoFdmFsdWUYAiABKAsyHS5qdHNoYXJlZC5QbGF5",
-            "ZXJMZXZlbFByb2dyZXNzOgI4ARpdChlDaFVubG9ja1Byb2dyZXNzRGljdEVu",
-            "dHJ5EgsKA2tleRgBIAEoDRIvCgV2YWx1ZRgCIAEoCzIgLmp0c2hhcmVkLlBs",
-            "YXllckNoVW5sb2NrUHJvZ3Jlc3M6AjgBGjoKGEZpbmlzaGVkU3RvcnlQb2lu",
-            "dHNFbnRyeRILCgNrZXkYASABKAkSDQoFdmFsdWUYAiABKAg6AjgBIooCChlQ",
-            "bGF5ZXJPbmxpbmVBcmVuYVByb2dyZXNzEhsKE3NhdmVkX2F0X2dtdF9taWxs",
-            "aXMYASABKAQSEQoJcGxheWVyX2lkGAIgASgJEl4KF2NoX3VubG9ja19wcm9n",
-            "cmVzc19kaWN0GAMgAygLMj0uanRzaGFyZWQuUGxheWVyT25saW5lQXJlbmFQ",
-            "cm9ncmVzcy5DaFVubG9ja1Byb2dyZXNzRGljdEVudHJ5Gl0KGUNoVW5sb2Nr",
-            "UHJvZ3Jlc3NEaWN0RW50cnkSCwoDa2V5GAEgASgNEi8KBXZhbHVlGAIgASgL",
-            "MiAuanRzaGFyZWQuUGxheWVyQ2hVbmxvY2tQcm9ncmVzczoCOAEibgoUU3Rv",
-            "cnlQb2ludERpYWxvZ0xpbmUSEwoLbmFycmF0b3JfdWQYASABKAQSGwoTbmFy",
-            "cmF0b3Jfc3BlY2llc19pZBgCIAEoDRIPCgdjb250ZW50GAMgASgJEhMKC2Rv",
-            "d25fb3Jfbm90GAQgASgIImAKDlN0b3J5UG9pbnRTdGVwEi0KBWxpbmVzGAEg",
-            "AygLMh4uanRzaGFyZWQuU3RvcnlQb2ludERpYWxvZ0xpbmUSHwoXbm9uY3Ry",
-            "bF9hbGl2ZV9yZGZfY291bnQYAiABKAUicAoKU3RvcnlQb2ludBInCgVzdGVw",
-            "cxgBIAMoCzIYLmp0c2hhcmVkLlN0b3J5UG9pbnRTdGVwEg8KB25vbmN0cmwY",
-            "AiABKAgSEQoJb25jZV9vbmx5GAMgASgIEhUKDWN1dHNjZW5lX25hbWUYBCAB",
-            "KAkizgEKGVNlcmlhbGl6YWJsZUNvbnZleFBvbHlnb24SIAoGYW5jaG9yGAEg",
-            "ASgLMhAuanRzaGFyZWQuUGJWZWMyEiAKBnBvaW50cxgCIAMoCzIQLmp0c2hh",
-            "cmVkLlBiVmVjMhIOCgZpc19ib3gYAyABKAgSGQoRaXNfcGFyYWxsZWxlcGlw",
-            "ZWQYBCABKAgSDwoHYm94X3FfeBgFIAEoAhIPCgdib3hfcV95GAYgASgCEg8K",
-            "B2JveF9xX3oYByABKAISDwoHYm94X3FfdxgIIAEoAiJ+ChlTZXJpYWxpemVk",
-            "QmFycmllckNvbGxpZGVyEisKBGF0dHIYASABKAsyHS5qdHNoYXJlZC5CYXJy",
-            "aWVyQ29sbGlkZXJBdHRyEjQKB3BvbHlnb24YAiABKAsyIy5qdHNoYXJlZC5T",
-            "ZXJpYWxpemFibGVDb252ZXhQb2x5Z29uInoKDlBpY2thYmxlQ29uZmlnEhMK",
-            "C3BpY2t1cF90eXBlGAEgASgNEhUKDXRha2VzX2dyYXZpdHkYAiABKAgSGAoQ",
-            "YWN0aXZlX2FuaW1fbmFtZRgDIAEoCRIQCghhbW91bnRfMRgEIAEoBRIQCghh",
-            "bW91bnRfMhgFIAEoBSLEAQoXUGlja2FibGVDb25maWdGcm9tVGlsZWQSEwoL",
-            "cGlja3VwX3R5cGUYASABKA0SEwoLcmVjdXJfcXVvdGEYAiABKAUSKQohbGlm",
-            "ZXRpbWVfcmRmX2NvdW50X3Blcl9vY2N1cnJlbmNlGAMgASgNEiIKGnN0b2Nr",
-            "X3F1b3RhX3Blcl9vY2N1cnJlbmNlGAQgASgNEhcKD2JveF9oYWxmX3NpemVf",
-            "eBgFIAEoAhIXCg9ib3hfaGFsZl9zaXplX3kYBiABKAIimQIKCFBpY2thYmxl",
-            "EgoKAmlkGAEgASgNEhMKC3BpY2t1cF90eXBlGAIgASgNEikKCHBrX3N0YXRl",
-            "GAMgASgOMhcuanRzaGFyZWQuUGlja2FibGVTdGF0ZRIaChJmcmFtZXNfaW5f",
-            "cGtfc3RhdGUYBCABKAUSCQoBeBgFIAEoAhIJCgF5GAYgASgCEgkKAXoYByAB",
-            "KAISDQoFdmVsX3gYCCABKAISDQoFdmVsX3kYCSABKAISDQoFdmVsX3oYCiAB",
-            "KAISJAoccmVtYWluaW5nX2xpZmV0aW1lX3JkZl9jb3VudBgLIAEoBRIdChVy",
-            "ZW1haW5pbmdfcmVjdXJfcXVvdGEYDCABKAUSEgoJcGlja2VyX3VkGIAEIAEo",
-            "BCI2ChFJbmplY3RlZENtZENvbmZpZxIVCg1jdXRvZmZfcmRmX2lkGAEgASgF",
-            "EgoKAm9wGAIgASgEIl4KFkNoYXJhY3RlclNwYXduZXJDb25maWcSFQoNY3V0",
-            "b2ZmX3JkZl9pZBgBIAEoBRIXCg9zcGVjaWVzX2lkX2xpc3QYAiADKA0SFAoM",
-            "aW5pdF9vcF9saXN0GAMgAygEIl4KFVBpY2thYmxlU3Bhd25lckNvbmZpZxIV",
-            "Cg1jdXRvZmZfcmRmX2lkGAEgASgFEhgKEHBpY2t1cF90eXBlX2xpc3QYAiAD",
-            "KA0SFAoMaW5pdF9vcF9saXN0GAMgAygEIioKDVRyaWdnZXJDb25maWcSCwoD",
-            "dHJ0GAEgASgNEgwKBG5hbWUYAiABKAkikwcKFlRyaWdnZXJDb25maWdGcm9t",
-            "VGlsZWQSCgoCaWQYASABKA0SCwoDdHJ0GAIgASgNEhYKDmRlbGF5ZWRfZnJh",
-            "bWVzGAMgASgFEhcKD3JlY292ZXJ5X2ZyYW1lcxgEIAEoBRIWCg5idWxsZXRf",
-            "dGVhbV9pZBgFIAEoBRIgChhzdWJfY3ljbGVfdHJpZ2dlcl9mcmFtZXMYBiAB",
-            "KAUSFwoPc3ViX2N5Y2xlX3F1b3RhGAcgASgFEg0KBXF1b3RhGAggASgFEhcK",
-            "D2JveF9oYWxmX3NpemVfeBgJIAEoAhIXCg9ib3hfaGFsZl9zaXplX3kYCiAB",
-            "KAISFQoNbmV3X3Jldml2YWxfeBgLIAEoAhIVCg1uZXdfcmV2aXZhbF95GAwg",
-            "ASgCEhAKCGluaXRfcV94GA0gASgCEhAKCGluaXRfcV95GA4gASgCEhAKCGlu",
-            "aXRfcV96GA8gASgCEhAKCGluaXRfcV93GBAgASgCEiYKHnB1Ymxpc2hpbmdf",
-            "bWFza191cG9uX2V4aGF1c3RlZBgRIAEoBBIvCidwdWJsaXNoaW5nX3RvX3Ry",
-            "aWdnZXJfaWRfdXBvbl9leGhhdXN0ZWQYEiABKA0SHAoUZm9yY2VfY3RybF9y",
-            "ZGZfY291bnQYEyABKAUSFgoOZm9yY2VfY3RybF9jbWQYFCABKAQSDwoHdG9w",
-            "b19sdhgVIAEoDRIoCiBjYWNoZWRfc3ViX2N5Y2xlX21hc2tfdG9fZnVsZmls",
-            "bBgWIAEoBBIaChFpc19zdG9yeV9yZWFkeV9nbxiABCABKAgSDwoGYmdtX2lk",
-            "GIEEIAEoBRIaChFpc19ib3NzX3NhdmVwb2ludBiCBCABKAgSTwoQYm9zc19z",
-            "cGVjaWVzX3NldBiDBCADKAsyNC5qdHNoYXJlZC5UcmlnZ2VyQ29uZmlnRnJv",
-            "bVRpbGVkLkJvc3NTcGVjaWVzU2V0RW50cnkSRQoaY2hhcmFjdGVyX3NwYXdu",
-            "ZXJfdGltZV9zZXEYgAggAygLMiAuanRzaGFyZWQuQ2hhcmFjdGVyU3Bhd25l",
-            "ckNvbmZpZxJDChlwaWNrYWJsZV9zcGF3bmVyX3RpbWVfc2VxGIEIIAMoCzIf",
-            "Lmp0c2hhcmVkLlBpY2thYmxlU3Bhd25lckNvbmZpZxo1ChNCb3NzU3BlY2ll",
-            "c1NldEVudHJ5EgsKA2tleRgBIAEoDRINCgV2YWx1ZRgCIAEoCDoCOAEiugMK",
-            "B1RyaWdnZXISCgoCaWQYASABKA0SEAoIZ3JvdXBfaWQYAiABKA0SFgoOZnJh",
-            "bWVzX3RvX2ZpcmUYAyABKAUSGQoRZnJhbWVzX3RvX3JlY292ZXIYBCABKAUS",
-            "DQoFcXVvdGEYBSABKAUSFgoOYnVsbGV0X3RlYW1faWQYBiABKAUSFwoPc3Vi",
-            "X2N5Y2xlX2luZGV4GAkgASgFEiUKBXN0YXRlGAogASgOMhYuanRzaGFyZWQu",
-            "VHJpZ2dlclN0YXRlEhcKD2ZyYW1lc19pbl9zdGF0ZRgLIAEoBRIJCgF4GAwg",
-            "ASgCEgkKAXkYDSABKAISCQoBehgOIAEoAhIiChptYWluX2N5Y2xlX21hc2tf",
-            "dG9fZnVsZmlsbBgPIAEoBBIhChlzdWJfY3ljbGVfbWFza190b19mdWxmaWxs",
-            "GBAgASgEEiIKGnN1Yl9jeWNsZV9nZW5fbWFza19jb3VudGVyGBMgASgEEhMK",
-            "C29mZmVuZGVyX3VkGBQgASgEEh8KF29mZmVuZGVyX2J1bGxldF90ZWFtX2lk",
-            "GBUgASgFEgsKA3RydBgWIAEoDRIPCgd0b3BvX2x2GBcgASgNInQKDlBsYXll",
-            "ck1ldGFJbmZvEhEKCXBsYXllcl9pZBgBIAEoCRISCgpqb2luX2luZGV4GAIg",
-            "ASgNEhYKDmJ1bGxldF90ZWFtX2lkGAMgASgFEhIKCnNwZWNpZXNfaWQYBCAB",
-            "KA0SDwoHcm9vbV9pZBgFIAEoBSJzChFScGNFbmRwb2ludEhvbGRlchIKCgJp",
-            "ZBgBIAEoDRIaChJleHRlcm5hbF9hZGRyX2hvc3QYAiABKAkSGgoSZXh0ZXJu",
-            "YWxfYWRkcl9wb3J0GAMgASgNEhoKEmludGVybmFsX2FkZHJfaG9zdBgEIAEo",
-            "CSLkAwoPQ2hTcGVjaWVzQ29uc3RzEhEKCWJsYWRlZ2lybBgBIAEoDRIUCgxi",
-            "b3VudHlodW50ZXIYAiABKA0SEwoLYmxhY2tzYWJlcjEYAyABKA0SFQoNYmxh",
-            "Y2tzaG9vdGVyMRgEIAEoDRIVCg1ibGFja3Rocm93ZXIxGAUgASgNEhQKDGhl",
-            "YWRxdWFydGVyMRgGIAEoDRITCgtibGFja3NhYmVyMhgHIAEoDRIVCg1ibGFj",
-            "a3Nob290ZXIyGAggASgNEhQKDHNoaWVsZGd1YXJkMRgJIAEoDRIUCgxzaGll",
-            "bGRndWFyZDIYCiABKA0SEwoLcmlkZXJndWFyZDEYCyABKA0SDAoEYmF0MRgM",
-            "IAEoDRINCgV3b2xmMRgNIAEoDRISCgp3b2x2ZXJpbmUxGA4gASgNEhoKEnBh",
-            "cmlzX3BvbGljZV9jaGllZhgPIAEoDRISCgpwb2xpY2VtYW4xGBAgASgNEhIK",
-            "CnBvbGljZW1hbjIYESABKA0SFAoMcG9saWNld29tYW4xGBIgASgNEg0KBG5v",
-            "bmUYgBAgASgNEiIKGWJsYWNrc2FiZXJfdGVzdF9ub192aXNpb24YgRAgASgN",
-            "EiQKG2JsYWNrc2FiZXJfdGVzdF93aXRoX3Zpc2lvbhiCECABKA0imwEKCVRy",
-            "YXBUeXBlcxIYChBzbGlkaW5nX3BsYXRmb3JtGAEgASgNEhkKEXJvdGF0aW5n",
-            "X3BsYXRmb3JtGAIgASgNEhUKDWNvbnZleW9yX2JlbHQYAyABKA0SFAoMZmFs",
-            "bGluZ19yb2NrGAQgASgNEg4KBnNwcmluZxgFIAEoDRINCgVicmljaxgGIAEo",
-            "DRINCgRub25lGIAQIAEoDSLzAQoMVHJpZ2dlclR5cGVzEg8KB3ZpY3RvcnkY",
-            "ASABKA0SFQoNYnlfaW5pdF9kZWxheRgCIAEoDRITCgtieV9tb3ZlbWVudBgD",
-            "IAEoDRIRCglieV9hdHRhY2sYBCABKA0SFAoMYnlfcGF0dGVybl9mGAUgASgN",
-            "Eh0KFWluZGlfd2F2ZV9ucGNfc3Bhd25lchgGIAEoDRIiChppbmRpX3dhdmVf",
-            "cGlja2FibGVfc3Bhd25lchgHIAEoDRIXCg9zeW5jX3dhdmVfZ3JvdXAYCCAB",
-            "KA0SEgoKc2F2ZV9wb2ludBgJIAEoDRINCgRub25lGIAQIAEoDSK5AQoNUGlj",
-            "a2FibGVUeXBlcxIQCghocF9zbWFsbBgBIAEoDRIQCghtcF9zbWFsbBgCIAEo",
-            "DRIaChJpbnZfY19yZWZpbGxfc21hbGwYAyABKA0SGgoSaW52X2RfcmVmaWxs",
-            "X3NtYWxsGAQgASgNEhcKD3ZlaGljbGVfc2VkYW5fMRgFIAEoDRIMCgRjb2lu",
-            "GAYgASgNEhYKDmRyYWdvbl9jcnlzdGFsGAcgASgNEg0KBG5vbmUYgBAgASgN",
-            "InMKC0F0a0VsZVR5cGVzEgwKBGZpcmUYASABKA0SDQoFd2F0ZXIYAiABKA0S",
-            "DwoHdGh1bmRlchgDIAEoDRIMCgRyb2NrGAQgASgNEgwKBHdpbmQYBSABKA0S",
-            "CwoDaWNlGAYgASgNEg0KBG5vbmUYgBAgASgNInoKDURlYnVmZlNwZWNpZXMS",
-            "FAoMc2hvcnRfZnJvemVuGAEgASgNEhcKD3Nob3J0X3BhcmFseXplZBgCIAEo",
-            "DRITCgtsb25nX2Zyb3plbhgDIAEoDRIWCg5sb25nX3BhcmFseXplZBgEIAEo",
-            "DRINCgRub25lGIAQIAEoDSLRMwoPUHJpbWl0aXZlQ29uc3RzEhsKE2JhdHRs",
-            "ZV9keW5hbWljc19mcHMYASABKAUSMgoqZGVmYXVsdF90aW1lb3V0X2Zvcl9s",
-            "YXN0X2FsbF9jb25maXJtZWRfaWZkGAIgASgFEhQKDHJvb21faWRfbm9uZRgD",
-            "IAEoBRIdChVyb29tX3N0YXRlX2ltcG9zc2libGUYBCABKAUSFwoPcm9vbV9z",
-            "dGF0ZV9pZGxlGAUgASgFEhoKEnJvb21fc3RhdGVfd2FpdGluZxgGIAEoBRIa",
-            "ChJyb29tX3N0YXRlX3ByZXBhcmUYByABKAUSHAoUcm9vbV9zdGF0ZV9pbl9i",
-            "YXR0bGUYCCABKAUSIAoYcm9vbV9zdGF0ZV9pbl9zZXR0bGVtZW50GAkgASgF",
-            "EhoKEnJvb21fc3RhdGVfc3RvcHBlZBgKIAEoBRIwCihyb29tX3N0YXRlX2Zy",
-            "b250ZW5kX2F3YWl0aW5nX2F1dG9fcmVqb2luGAsgASgFEjIKKnJvb21fc3Rh",
-            "dGVfZnJvbnRlbmRfYXdhaXRpbmdfbWFudWFsX3Jlam9pbhgMIAEoBRIlCh1y",
-            "b29tX3N0YXRlX2Zyb250ZW5kX3Jlam9pbmluZxgNIAEoBRImCh5wbGF5ZXJf",
-            "YmF0dGxlX3N0YXRlX2ltcG9zc2libGUYDiABKAUSPQo1cGxheWVyX2JhdHRs",
-            "ZV9zdGF0ZV9hZGRlZF9wZW5kaW5nX2JhdHRsZV9jb2xsaWRlcl9hY2sYDyAB",
-            "KAUSOAowcGxheWVyX2JhdHRsZV9zdGF0ZV9yZWFkZGVkX3BlbmRpbmdfZm9y",
-            "Y2VfcmVzeW5jGBAgASgFEiIKGnBsYXllcl9iYXR0bGVfc3RhdGVfYWN0aXZl",
-            "GBEgASgFEigKIHBsYXllcl9iYXR0bGVfc3RhdGVfZGlzY29ubmVjdGVkGBIg",
-            "ASgFEiAKGHBsYXllcl9iYXR0bGVfc3RhdGVfbG9zdBgTIAEoBRIwCihwbGF5",
-            "ZXJfYmF0dGxlX3N0YXRlX2V4cGVsbGVkX2R1cmluZ19nYW1lGBQgASgFEjEK",
-            "KXBsYXllcl9iYXR0bGVfc3RhdGVfZXhwZWxsZWRfaW5fZGlzbWlzc2FsGBUg",
-            "ASgFEioKInVwc3luY19tc2dfYWN0X3BsYXllcl9jb2xsaWRlcl9hY2sYFiAB",
-            "KAUSIQoZdXBzeW5jX21zZ19hY3RfcGxheWVyX2NtZBgXIAEoBRIzCit1cHN5",
-            "bmNfbXNnX2FjdF9ob2xlcHVuY2hfYmFja2VuZF91ZHBfdHVubmVsGBggASgF",
-            "Ei4KJnVwc3luY19tc2dfYWN0X2hvbGVwdW5jaF9wZWVyX3VkcF9hZGRyGBkg",
-            "ASgFEi0KJWRvd25zeW5jX21zZ19hY3RfYmF0dGxlX2NvbGxpZGVyX2luZm8Y",
-            "GiABKAUSJAocZG93bnN5bmNfbXNnX2FjdF9pbnB1dF9iYXRjaBgbIAEoBRIn",
-            "Ch9kb3duc3luY19tc2dfYWN0X2JhdHRsZV9zdG9wcGVkGBwgASgFEiYKHmRv",
-            "d25zeW5jX21zZ19hY3RfZm9yY2VkX3Jlc3luYxgdIAEoBRIpCiFkb3duc3lu",
-            "Y19tc2dfYWN0X3BlZXJfaW5wdXRfYmF0Y2gYHiABKAUSJgoeZG93bnN5bmNf",
-            "bXNnX2FjdF9wZWVyX3VkcF9hZGRyGB8gASgFEi4KJmRvd25zeW5jX21zZ19h",
-            "Y3RfYmF0dGxlX3JlYWR5X3RvX3N0YXJ0GCAgASgFEiUKHWRvd25zeW5jX21z",
-            "Z19hY3RfYmF0dGxlX3N0YXJ0GCEgASgFEiwKJGRvd25zeW5jX21zZ19hY3Rf",
-            "cGxheWVyX2Rpc2Nvbm5lY3RlZBgiIAEoBRIxCilkb3duc3luY19tc2dfYWN0",
-            "X3BsYXllcl9yZWFkZGVkX2FuZF9hY2tlZBgjIAEoBRIvCidkb3duc3luY19t",
-            "c2dfYWN0X3BsYXllcl9hZGRlZF9hbmRfYWNrZWQYJCABKAUSHgoWZG93bnN5",
-            "bmNfbXNnX3dzX2Nsb3NlZBglIAEoBRIcChRkb3duc3luY19tc2dfd3Nfb3Bl",
-            "bhgmIAEoBRIgChhtYWdpY19qb2luX2luZGV4X2ludmFsaWQYJyABKA0SJwof",
-            "bWFnaWNfam9pbl9pbmRleF9zcnZfdWRwX3R1bm5lbBgoIAEoDRIcChRtYWdp",
-            "Y19xdW90YV9pbmZpbml0ZRgpIAEoBRIzCittYWdpY19sYXN0X3NlbnRfaW5w",
-            "dXRfZnJhbWVfaWRfbm9ybWFsX2FkZGVkGCsgASgFEi4KJm1hZ2ljX2xhc3Rf",
-            "c2VudF9pbnB1dF9mcmFtZV9pZF9yZWFkZGVkGCwgASgFEhUKDWJnbV9ub19j",
-            "aGFuZ2UYLSABKAUSIQoZaW52YWxpZF9kZWZhdWx0X3BsYXllcl9pZBguIAEo",
-            "CRIhChllc3RpbWF0ZWRfc2Vjb25kc19wZXJfcmRmGC8gASgCEh8KF21heF9i",
-            "dG5faG9sZGluZ19yZGZfY250GDAgASgFEhoKEm1heF9mbHlpbmdfcmRmX2Nu",
-            "dBgxIAEoBRIuCiZtYXhfcmV2ZXJzZV9wdXNoYmFja19mcmFtZXNfdG9fcmVj",
-            "b3ZlchgyIAEoBRIuCiZkZWZhdWx0X3NsaXBfanVtcF9ncmFjZV9wZXJpb2Rf",
-            "cmRmX2NudBgzIAEoBRIpCiFkZWZhdWx0X21pbl9zcGVlZF9mb3JfcmVzdGl0",
-            "dXRpb24YNCABKAISIwobc3BlZWRfbm90X2hpdF9ub3Rfc3BlY2lmaWVkGDUg",
-            "ASgFEiUKHWRlZmF1bHRfcHJlYWxsb2NfbnBjX2NhcGFjaXR5GDYgASgFEigK",
-            "IGRlZmF1bHRfcHJlYWxsb2NfYnVsbGV0X2NhcGFjaXR5GDcgASgFEiYKHmRl",
-            "ZmF1bHRfcHJlYWxsb2NfdHJhcF9jYXBhY2l0eRg4IAEoBRIpCiFkZWZhdWx0",
-            "X3ByZWFsbG9jX3RyaWdnZXJfY2FwYWNpdHkYOSABKAUSKgoiZGVmYXVsdF9w",
-            "cmVhbGxvY19waWNrYWJsZV9jYXBhY2l0eRg6IAEoBRIrCiNkZWZhdWx0X3Bl",
-            "cl9jaGFyYWN0ZXJfYnVmZl9jYXBhY2l0eRg7IAEoBRItCiVkZWZhdWx0X3Bl",
-            "cl9jaGFyYWN0ZXJfZGVidWZmX2NhcGFjaXR5GDwgASgFEjAKKGRlZmF1bHRf",
-            "cGVyX2NoYXJhY3Rlcl9pbnZlbnRvcnlfY2FwYWNpdHkYPSABKAUSOwozZGVm",
-            "YXVsdF9wZXJfY2hhcmFjdGVyX2ltbXVuZV9idWxsZXRfcmVjb3JkX2NhcGFj",
-            "aXR5GD4gASgFEhEKCWdyYXZpdHlfeRg/IAEoAhIeChZncmF2aXR5X3lfanVt",
-            "cF9ob2xkaW5nGEAgASgCEikKIWRlZmF1bHRfcGF0cm9sX2N1ZV93YWl2aW5n",
-            "X2ZyYW1lcxhBIAEoBRIYChBub19wYXRyb2xfY3VlX2lkGEIgASgFEikKIXN0",
-            "aWNrX3RvX2dyb3VuZF9jb3JyZWN0aW9uX2xlbmd0aBhDIAEoAhIsCiRkZWZh",
-            "dWx0X3BpY2thYmxlX2h1cnRib3hfaGFsZl9zaXplX3gYRCABKAISLAokZGVm",
-            "YXVsdF9waWNrYWJsZV9odXJ0Ym94X2hhbGZfc2l6ZV95GEUgASgCEjEKKWRl",
-            "ZmF1bHRfcGlja2FibGVfZGlzYXBwZWFyaW5nX2FuaW1fZnJhbWVzGEYgASgF",
-            "Ei0KJWRlZmF1bHRfcGlja2FibGVfY29uc3VtZWRfYW5pbV9mcmFtZXMYRyAB",
-            "KAUSJQodZGVmYXVsdF9waWNrYWJsZV9yaXNpbmdfdmVsX3kYSCABKAISJwof",
-            "ZGVmYXVsdF9waWNrYWJsZV9zdGFydHVwX2ZyYW1lcxhJIAEoBRIpCiFkZWZh",
-            "dWx0X3BpY2thYmxlX2xpZmV0aW1lX3JkZl9jbnQYSiABKAUSIQoZZGVmYXVs",
-            "dF9ibG9ja19zdHVuX2ZyYW1lcxhMIAEoBRIpCiFkZWZhdWx0X2Jsb3dudXBf",
-            "ZnJhbWVzX2Zvcl9mbHlpbmcYTSABKAUSIAoYZGVmYXVsdF9nYXVnZV9pbmNf",
-            "YnlfaGl0GE4gASgFEjAKKGRlZmF1bHRfZnJhbWVzX2RlbGF5ZWRfb2ZfYm9z",
-            "c19zYXZlcG9pbnQYTyABKAUSGgoSaW5wdXRfc2NhbGVfZnJhbWVzGFAgASgF",
-            "EhMKC2lucHV0X3NjYWxlGFEgASgFEhoKEmlucHV0X2RlbGF5X2ZyYW1lcxhS",
-            "IAEoBRIpCiFkZWZhdWx0X2JhY2tlbmRfaW5wdXRfYnVmZmVyX3NpemUYUyAB",
-            "KAUSLAokbWF4X2NoYXNpbmdfcmVuZGVyX2ZyYW1lc19wZXJfdXBkYXRlGFQg",
-            "ASgFEiIKGm1hZ2ljX2ZyYW1lc190b19iZV9vbl93YWxsGFUgASgFEisKI21h",
-            "Z2ljX2ZyYW1lc190b19iZV9vbl93YWxsX2Fpcl9qdW1wGFYgASgFEh8KF2R5",
-            "aW5nX2ZyYW1lc190b19yZWNvdmVyGFcgASgFEiEKGXBhcnJpZWRfZnJhbWVz",
-            "X3RvX3JlY292ZXIYWCABKAUSKwojcGFycmllZF9mcmFtZXNfdG9fc3RhcnRf",
-            "Y2FuY2VsbGFibGUYWSABKAUSEAoIbm9fc2tpbGwYWiABKA0SFAoMbm9fc2tp",
-            "bGxfaGl0GFsgASgFEiIKGnVwc3luY19zdF9pZmRfaWRfdG9sZXJhbmNlGF0g",
-            "ASgNEhMKC25vX2xvY2tfdmVsGF4gASgCEiwKJGNyb3VjaF9mb3JjaW5nX2Nl",
-            "aWxpbmdfZG90X3RocmVzaG9sZBhfIAEoAhIjCht0ZXJtaW5hdGluZ19yZW5k",
-            "ZXJfZnJhbWVfaWQYYCABKAUSIgoadGVybWluYXRpbmdfaW5wdXRfZnJhbWVf",
-            "aWQYYSABKAUSIAoYdGVybWluYXRpbmdfY2hhcmFjdGVyX2lkGGIgASgNEhsK",
-            "E3Rlcm1pbmF0aW5nX3RyYXBfaWQYYyABKA0SHgoWdGVybWluYXRpbmdfdHJp",
-            "Z2dlcl9pZBhkIAEoDRIkChx0ZXJtaW5hdGluZ190cmlnZ2VyX2dyb3VwX2lk",
-            "GGUgASgNEh8KF3Rlcm1pbmF0aW5nX3BpY2thYmxlX2lkGGYgASgNEh0KFXRl",
-            "cm1pbmF0aW5nX2J1bGxldF9pZBhnIAEoDRIiChp0ZXJtaW5hdGluZ19idWxs",
-            "ZXRfdGVhbV9pZBhoIAEoBRIjCht0ZXJtaW5hdGluZ19idWZmX3NwZWNpZXNf",
-            "aWQYaSABKA0SJQoddGVybWluYXRpbmdfZGVidWZmX3NwZWNpZXNfaWQYaiAB",
-            "KA0SKQohdGVybWluYXRpbmdfY29uc3VtYWJsZV9zcGVjaWVzX2lkGGsgASgN",
-            "EiMKG2Zyb250ZW5kX3dzX3JlY3ZfYnl0ZWxlbmd0aBhsIAEoBRIiChpiYWNr",
-            "ZW5kX3dzX3JlY3ZfYnl0ZWxlbmd0aBhtIAEoBRIiChpqYW1tZWRfYnRuX2hv",
-            "bGRpbmdfcmRmX2NudBhuIAEoBRIpCiFidG5fYl9ob2xkaW5nX3JkZl9jbnRf",
-            "dGhyZXNob2xkXzIYbyABKAUSKQohYnRuX2JfaG9sZGluZ19yZGZfY250X3Ro",
-            "cmVzaG9sZF8xGHAgASgFEigKIGp1bXBfaG9sZGluZ19yZGZfY250X3RocmVz",
-            "aG9sZF8xGHEgASgFEigKIGp1bXBfaG9sZGluZ19pZmRfY250X3RocmVzaG9s",
-            "ZF8xGHIgASgFEigKIGp1bXBfaG9sZGluZ19yZGZfY250X3RocmVzaG9sZF8y",
-            "GHMgASgFEigKIGp1bXBfaG9sZGluZ19pZmRfY250X3RocmVzaG9sZF8yGHQg",
-            "ASgFEigKIGluX2Fpcl9kYXNoX2dyYWNlX3BlcmlvZF9yZGZfY250GHUgASgF",
-            "EigKIGluX2Fpcl9qdW1wX2dyYWNlX3BlcmlvZF9yZGZfY250GHYgASgFEikK",
-            "IWJ0bl9lX2hvbGRpbmdfcmRmX2NudF90aHJlc2hvbGRfMRh3IAEoBRIpCiFi",
-            "dG5fZV9ob2xkaW5nX2lmZF9jbnRfdGhyZXNob2xkXzEYeCABKAUSHwoXcGF0",
-            "dGVybl9pZF91bmFibGVfdG9fb3AYeSABKAUSGAoQcGF0dGVybl9pZF9ub19v",
-            "cBh6IAEoBRIRCglwYXR0ZXJuX2IYeyABKAUSFAoMcGF0dGVybl91cF9iGHwg",
-            "ASgFEhYKDnBhdHRlcm5fZG93bl9iGH0gASgFEhYKDnBhdHRlcm5faG9sZF9i",
-            "GH4gASgFEhYKDnBhdHRlcm5fZG93bl9hGH8gASgFEhsKEnBhdHRlcm5fcmVs",
-            "ZWFzZWRfYhiAASABKAUSEgoJcGF0dGVybl9lGIEBIAEoBRIYCg9wYXR0ZXJu",
-            "X2Zyb250X2UYggEgASgFEhcKDnBhdHRlcm5fYmFja19lGIMBIAEoBRIVCgxw",
-            "YXR0ZXJuX3VwX2UYhAEgASgFEhcKDnBhdHRlcm5fZG93bl9lGIUBIAEoBRIX",
-            "Cg5wYXR0ZXJuX2hvbGRfZRiGASABKAUSGQoQcGF0dGVybl9lX2hvbGRfYhiH",
-            "ASABKAUSHwoWcGF0dGVybl9mcm9udF9lX2hvbGRfYhiIASABKAUSHgoVcGF0",
-            "dGVybl9iYWNrX2VfaG9sZF9iGIkBIAEoBRIcChNwYXR0ZXJuX3VwX2VfaG9s",
-            "ZF9iGIoBIAEoBRIeChVwYXR0ZXJuX2Rvd25fZV9ob2xkX2IYiwEgASgFEh4K",
-            "FXBhdHRlcm5faG9sZF9lX2hvbGRfYhiMASABKAUSIQoYcGF0dGVybl9pbnZl",
-            "bnRvcnlfc2xvdF9jGI0BIAEoBRIhChhwYXR0ZXJuX2ludmVudG9yeV9zbG90",
-            "X2QYjgEgASgFEiIKGXBhdHRlcm5faW52ZW50b3J5X3Nsb3RfYmMYjwEgASgF",
-            "EiYKHXBhdHRlcm5faG9sZF9pbnZlbnRvcnlfc2xvdF9jGJABIAEoBRImCh1w",
-            "YXR0ZXJuX2hvbGRfaW52ZW50b3J5X3Nsb3RfZBiRASABKAUSEgoJcGF0dGVy",
-            "bl9mGJIBIAEoBRISCglwYXR0ZXJuX2wYkwEgASgFEhIKCXBhdHRlcm5fchiU",
-            "ASABKAUSIwoaZGVmYXVsdF9haXJfbGluZWFyX2RhbXBpbmcYlQEgASgCEhkK",
-            "EGJhdW1nYXJ0ZV9mYWN0b3IYlgEgASgCEhkKEHBlbmV0cmF0aW9uX3Nsb3AY",
-            "lwEgASgCEiEKGG1heF9wZW5ldHJhdGlvbl9kaXN0YW5jZRiYASABKAISIwoa",
-            "ZWxlX3dlYWtuZXNzX2RlZmF1bHRfeWllbGQYmgEgASgCEiUKHGVsZV9yZXNp",
-            "c3RhbmNlX2RlZmF1bHRfeWllbGQYmwEgASgCEiEKGHN0YXJ0aW5nX3JlbmRl",
-            "cl9mcmFtZV9pZBicASABKAUSIAoXc3RhcnRpbmdfaW5wdXRfZnJhbWVfaWQY",
-            "nQEgASgFEhwKE2RlZmF1bHRfY2hfZnJpY3Rpb24YngEgASgCEh8KFmRlZmF1",
-            "bHRfY2hfcmVzdGl0dXRpb24YnwEgASgCEiMKGmdyb3VuZF9kYXNoaW5nX2No",
-            "X2ZyaWN0aW9uGKABIAEoAhIeChVhbnRpX3B1c2hfY2hfZnJpY3Rpb24YoQEg",
-            "ASgCEiEKGHdhbGtzdG9wcGluZ19jaF9mcmljdGlvbhiiASABKAISIQoYZmFs",
-            "bHN0b3BwaW5nX2NoX2ZyaWN0aW9uGKMBIAEoAhIhChhkZWZhdWx0X2JhcnJp",
-            "ZXJfZnJpY3Rpb24YpAEgASgCEiQKG2RlZmF1bHRfYmFycmllcl9yZXN0aXR1",
-            "dGlvbhilASABKAISIAoXZGVmYXVsdF9idWxsZXRfZnJpY3Rpb24YpgEgASgC",
-            "EiMKGmRlZmF1bHRfYnVsbGV0X3Jlc3RpdHV0aW9uGKcBIAEoAhIiChlzdGFp",
-            "cnNfcF90ZXJyYWluX3ByaW9yaXR5GKgBIAEoAhInCh5yZWd1bGFyX3Nsb3Bl",
-            "X3RlcnJhaW5fcHJpb3JpdHkYqQEgASgCEh0KFHNwX2F0a19sb29rdXBfZnJh",
-            "bWVzGIAIIAEoBRIjChpkZWJ1ZmZfYXJyYXlfaWR4X2VsZW1lbnRhbBiBCCAB",
-            "KAUSJwoedGVybWluYXRpbmdfbG93ZXJfcGFydF9yZGZfY250GIIIIAEoBRIj",
-            "ChpkZWZhdWx0X3RyX3JlY292ZXJ5X2ZyYW1lcxiDCCABKAUSLQokZGVmYXVs",
-            "dF9mbGVlaW5nX2dyYWNlX3BlcmlvZF9yZGZfY250GIQIIAEoBRInCh5kZWZh",
-            "dWx0X2ZyYW1lc190b19zaG93X2RhbWFnZWQYhQggASgFEikKIGRlZmF1bHRf",
-            "ZnJhbWVzX3RvX2NvbnRpbnVlX2NvbWJvGIYIIAEoBRIuCgpjaF9zcGVjaWVz",
-            "GIAQIAEoCzIZLmp0c2hhcmVkLkNoU3BlY2llc0NvbnN0cxIiCgR0cHRzGIEQ",
-            "IAEoCzITLmp0c2hhcmVkLlRyYXBUeXBlcxIlCgR0cnRzGIIQIAEoCzIWLmp0",
-            "c2hhcmVkLlRyaWdnZXJUeXBlcxImCgRwa3RzGIMQIAEoCzIXLmp0c2hhcmVk",
-            "LlBpY2thYmxlVHlwZXMSJQoFZWxldHMYhBAgASgLMhUuanRzaGFyZWQuQXRr",
-            "RWxlVHlwZXMSMAoOZGVidWZmX3NwZWNpZXMYhRAgASgLMhcuanRzaGFyZWQu",
-            "RGVidWZmU3BlY2llcyKKAQoJQWltaW5nUmF5EhMKC29mZmVuZGVyX3VkGAEg",
-            "ASgEEhQKDG9mZmVuZGVyX3VkdBgCIAEoBBIMCgRzdF94GAMgASgCEgwKBHN0",
-            "X3kYBCABKAISDAoEc3RfehgFIAEoAhIMCgRlZF94GAYgASgCEgwKBGVkX3kY",
-            "ByABKAISDAoEZWRfehgIIAEoAiKDCAoMQ29uZmlnQ29uc3RzEkcKEWNoYXJh",
-            "Y3Rlcl9jb25maWdzGAEgAygLMiwuanRzaGFyZWQuQ29uZmlnQ29uc3RzLkNo",
-            "YXJhY3RlckNvbmZpZ3NFbnRyeRI/Cg1za2lsbF9jb25maWdzGAIgAygLMigu",
-            "anRzaGFyZWQuQ29uZmlnQ29uc3RzLlNraWxsQ29uZmlnc0VudHJ5Ej0KDGJ1",
-            "ZmZfY29uZmlncxgDIAMoCzInLmp0c2hhcmVkLkNvbmZpZ0NvbnN0cy5CdWZm",
-            "Q29uZmlnc0VudHJ5EkEKDmRlYnVmZl9jb25maWdzGAQgAygLMikuanRzaGFy",
-            "ZWQuQ29uZmlnQ29uc3RzLkRlYnVmZkNvbmZpZ3NFbnRyeRI9Cgx0cmFwX2Nv",
-            "bmZpZ3MYBSADKAsyJy5qdHNoYXJlZC5Db25maWdDb25zdHMuVHJhcENvbmZp",
-            "Z3NFbnRyeRJDCg90cmlnZ2VyX2NvbmZpZ3MYBiADKAsyKi5qdHNoYXJlZC5D",
-            "b25maWdDb25zdHMuVHJpZ2dlckNvbmZpZ3NFbnRyeRJFChBwaWNrYWJsZV9j",
-            "b25maWdzGAcgAygLMisuanRzaGFyZWQuQ29uZmlnQ29uc3RzLlBpY2thYmxl",
-            "Q29uZmlnc0VudHJ5GlIKFUNoYXJhY3RlckNvbmZpZ3NFbnRyeRILCgNrZXkY",
-            "ASABKA0SKAoFdmFsdWUYAiABKAsyGS5qdHNoYXJlZC5DaGFyYWN0ZXJDb25m",
-            "aWc6AjgBGkQKEVNraWxsQ29uZmlnc0VudHJ5EgsKA2tleRgBIAEoDRIeCgV2",
-            "YWx1ZRgCIAEoCzIPLmp0c2hhcmVkLlNraWxsOgI4ARpIChBCdWZmQ29uZmln",
-            "c0VudHJ5EgsKA2tleRgBIAEoDRIjCgV2YWx1ZRgCIAEoCzIULmp0c2hhcmVk",
-            "LkJ1ZmZDb25maWc6AjgBGkwKEkRlYnVmZkNvbmZpZ3NFbnRyeRILCgNrZXkY",
-            "ASABKA0SJQoFdmFsdWUYAiABKAsyFi5qdHNoYXJlZC5EZWJ1ZmZDb25maWc6",
-            "AjgBGkgKEFRyYXBDb25maWdzRW50cnkSCwoDa2V5GAEgASgNEiMKBXZhbHVl",
-            "GAIgASgLMhQuanRzaGFyZWQuVHJhcENvbmZpZzoCOAEaTgoTVHJpZ2dlckNv",
-            "bmZpZ3NFbnRyeRILCgNrZXkYASABKA0SJgoFdmFsdWUYAiABKAsyFy5qdHNo",
-            "YXJlZC5UcmlnZ2VyQ29uZmlnOgI4ARpQChRQaWNrYWJsZUNvbmZpZ3NFbnRy",
-            "eRILCgNrZXkYASABKA0SJwoFdmFsdWUYAiABKAsyGC5qdHNoYXJlZC5QaWNr",
-            "YWJsZUNvbmZpZzoCOAEqNAoUQm94SW50ZXJwb2xhdGlvblR5cGUSCwoHVXNl",
-            "UHJldhAAEg8KC0ludGVycG9sYXRlEAEqVQoISWZhY2VDYXQSCQoFRU1QVFkQ",
-            "ABIJCgVGTEVTSBABEgkKBU1FVEFMEAISCQoFRkxVSUQQAxIICgRST0NLEAQS",
-            "CQoFR1JBU1MQBRIICgRXT09EEAYqPgoLQnVsbGV0U3RhdGUSCwoHU3RhcnRV",
-            "cBAAEgoKBkFjdGl2ZRABEg0KCVZhbmlzaGluZxACEgcKA0hpdBADKtkICg5D",
-            "aGFyYWN0ZXJTdGF0ZRISCg5JbnZhbGlkQ2hTdGF0ZRAAEgkKBUlkbGUxEAES",
-            "CwoHV2Fsa2luZxACEg4KClR1cm5Bcm91bmQQAxIKCgZBdGtlZDEQBBIUChBJ",
-            "bkFpcklkbGUxTm9KdW1wEAUSFAoQSW5BaXJJZGxlMUJ5SnVtcBAGEhQKEElu",
-            "QWlySWRsZTJCeUp1bXAQBxIYChRJbkFpcklkbGUxQnlXYWxsSnVtcBAIEg8K",
-            "C0luQWlyQXRrZWQxEAkSDAoIQmxvd25VcDEQChIMCghMYXlEb3duMRALEgoK",
-            "BkdldFVwMRAMEgkKBUR5aW5nEA0SCwoHRGFzaGluZxAOEgsKB1NsaWRpbmcQ",
-            "DxIKCgZEaW1tZWQQEBIUChBUcmFuc2Zvcm1pbmdJbnRvEBESDwoLQmFja0Rh",
-            "c2hpbmcQEhIQCgxJbkFpcldhbGtpbmcQExIdChlUcmFuc2Zvcm1pbmdJbnRv",
-            "RnJvbURlYXRoEBQSEAoMRmFsbFN0b3BwaW5nEBUSCwoHUGFycmllZBAXEgsK",
-            "B0F3YWtpbmcQGBIQCgxHcm91bmREb2RnZWQQGRIPCgtCYWNrV2Fsa2luZxAa",
-            "EhAKDEluQWlyRGFzaGluZxAbEhQKEEluQWlyQmFja0Rhc2hpbmcQHBITCg9J",
-            "bkFpclR1cm5Bcm91bmQQHRIYChRJbkFpcklkbGUxQnlTbGlwSnVtcBAeEhAK",
-            "C09uV2FsbElkbGUxEIABEhAKC0Nyb3VjaElkbGUxEIACEg8KCkNyb3VjaEF0",
-            "azEQgQISEgoNQ3JvdWNoV2Fsa2luZxCCAhIRCgxDcm91Y2hBdGtlZDEQgwIS",
-            "CQoERGVmMRCEAhIPCgpEZWYxQXRrZWQxEIUCEg8KCkRlZjFCcm9rZW4QhgIS",
-            "CQoEQXRrMRCACBIJCgRBdGsyEIEIEgkKBEF0azMQgggSCQoEQXRrNBCDCBIJ",
-            "CgRBdGs1EIQIEgkKBEF0azYQhQgSCQoEQXRrNxCGCBISCg1BdGs3X0NoYXJn",
-            "aW5nEIcIEhcKEkF0azdfQ2hhcmdlUmVsZWFzZRCICBIJCgRBdGs4EIkIEg4K",
-            "CUluQWlyQXRrMRCAEBIOCglJbkFpckF0azIQgRASDgoJSW5BaXJBdGs2EIIQ",
-            "EhAKC1dhbGtpbmdBdGsxEIMQEhAKC1dhbGtpbmdBdGs0EIQQEhUKEEluQWly",
-            "V2Fsa2luZ0F0azEQhRASFQoQSW5BaXJXYWxraW5nQXRrNBCGEBIPCgpPbldh",
-            "bGxBdGsxEIAYEhIKDUF0azFfQ2hhcmdpbmcQgRgSGQoUV2Fsa2luZ0F0azFf",
-            "Q2hhcmdpbmcQghgSHgoZSW5BaXJXYWxraW5nQXRrMV9DaGFyZ2luZxCDGBIX",
-            "ChJJbkFpckF0azFfQ2hhcmdpbmcQhBgSGAoTT25XYWxsQXRrMV9DaGFyZ2lu",
-            "ZxCFGBIYChNDcm91Y2hBdGsxX0NoYXJnaW5nEIYYKuEBCgdOcGNHb2FsEgkK",
-            "BU5JZGxlEAASDwoLTkZvbGxvd0FsbHkQARILCgdOUGF0cm9sEAISEQoNTkh1",
-            "bnRUaGVuSWRsZRADEhMKD05IdW50VGhlblBhdHJvbBAEEhcKE05IdW50VGhl",
-            "bkZvbGxvd0FsbHkQBRIeChpOSWRsZUlmR29IdW50aW5nVGhlblBhdHJvbBAG",
-            "Eg8KC05QYXRoUGF0cm9sEAcSFwoTTkh1bnRUaGVuUGF0aFBhdHJvbBAIEiIK",
-            "Hk5JZGxlSWZHb0h1bnRpbmdUaGVuUGF0aFBhdHJvbBAJKl8KCVRyYXBTdGF0",
-            "ZRIKCgZUcElkbGUQABINCglUcFdhbGtpbmcQARIKCgZUcEF0azEQAhIMCghU",
-            "cEF0a2VkMRADEhEKDVRwRGVhY3RpdmF0ZWQQBBIKCgZUcERlYWQQBSrdAQoM",
-            "VHJpZ2dlclN0YXRlEgsKB1RyUmVhZHkQABITCg9UclN1YkN5Y2xlUmVhZHkQ",
-            "ARIZChVUclN1YkN5Y2xlQ29vbGluZ0Rvd24QAhIYChRUclN1YkN5Y2xlQ29v",
-            "bGVkRG93bhADEhcKE1RyU3ViQ3ljbGVFeGhhdXN0ZWQQBBIRCg1UckNvb2xp",
-            "bmdEb3duEAUSEAoMVHJDb29sZWREb3duEAYSDwoLVHJFeGhhdXN0ZWQQBxIK",
-            "CgZUckRlYWQQCBIbChdUckV4aGF1c3RlZFlldExpc3RlbmluZxAJKjwKDVBp",
-            "Y2thYmxlU3RhdGUSCQoFUElkbGUQABIRCg1QRGlzYXBwZWFyaW5nEAESDQoJ",
-            "UENvbnN1bWVkEAIqSwoZU3BlY2lhbE1vdmVPdmVycmlkZVN0YXR1cxIMCghT",
-            "bXVzS2VlcBAAEg4KClNtdXNMb2NrZWQQARIQCgxTbXVzVW5sb2NrZWQQAiqH",
-            "AQoKQnVsbGV0VHlwZRIQCgxVbmRldGVybWluZWQQABIJCgVNZWxlZRABEhcK",
-            "E01lY2hhbmljYWxDYXJ0cmlkZ2UQAhIeChpNZWNoYW5pY2FsQm91bmNlclNw",
-            "aGVyaWNhbBADEhMKD01hZ2ljYWxGaXJlYmFsbBAEEg4KCkdyb3VuZFdhdmUQ",
-            "BSrmAQoMTXVsdGlIaXRUeXBlEggKBE5vbmUQABIQCgxGcm9tRW1pc3Npb24Q",
-            "ARIWChJGcm9tRmlyc3RIaXRBY3R1YWwQAhIWChJGcm9tRmlyc3RIaXRBbnl3",
-            "YXkQAxIVChFGcm9tUHJldkhpdEFjdHVhbBAEEhUKEUZyb21QcmV2SGl0QW55",
-            "d2F5EAUSGwoXRnJvbVZpc2lvblNlZWtPckRlZmF1bHQQBhIjCh9Gcm9tUHJl",
-            "dkhpdEFjdHVhbE9yQWN0aXZlVGltZVVwEAcSGgoWRnJvbUVtaXNzaW9uSnVz",
-            "dEFjdGl2ZRAIKjIKD1NraWxsSW52b2NhdGlvbhIOCgpSaXNpbmdFZGdlEAAS",
-            "DwoLRmFsbGluZ0VkZ2UQASosCg9WZnhEdXJhdGlvblR5cGUSCgoGT25lT2Zm",
-            "EAASDQoJUmVwZWF0aW5nEAEqNwoNVmZ4TW90aW9uVHlwZRIMCghOb01vdGlv",
-            "bhAAEgsKB0Ryb3BwZWQQARILCgdUcmFjaW5nEAIqSgoaT3ZlcnJpZGVPYnNJ",
-            "ZmFjZUJvZHlPcHRpb24SDQoJT09JQk9LZWVwEAASDQoJT09JQk9UcnVlEAES",
-            "DgoKT09JQk9GYWxzZRACKoEBCglVcHN5bmNBY3QSCwoHVUFfTk9ORRAAEgoK",
-            "BlVBX0NNRBABEhYKElVBX1NFTEZfUEFSU0VEX1JERhACEiMKH1VBX0hPTEVQ",
-            "VU5DSF9CQUNLRU5EX1VEUF9UVU5ORUwQAxIeChpVQV9IT0xFUFVOQ0hfUEVF",
-            "Ul9VRFBfQUREUhAEKv8DCgtEb3duc3luY0FjdBILCgdEQV9OT05FEAASDgoK",
-            "REFfUkVHVUxBUhABEhUKEURBX0JBVFRMRV9QUkVQQVJFEAISHAoYREFfQkFU",
-            "VExFX1JFQURZX1RPX1NUQVJUEAMSFQoRREFfQkFUVExFX1NUQVJURUQQBBIV",
-            "ChFEQV9CQVRUTEVfU1RPUFBFRBAFEhsKF0RBX0JBVFRMRV9QRUVSX1VEUF9B",
-            "RERSEAYSHwobREFfQkFUVExFX1BFRVJfRElTQ09OTkVDVEVEEAcSGQoVREFf",
-            "QkFUVExFX1BFRVJfSk9JTkVEEAgSGwoXREFfQkFUVExFX1BFRVJfUkVKT0lO",
-            "RUQQCRIpCiVEQV9GQUlMRURfVE9fSk9JTl9CQVRUTEVfTk9UX0pPSU5BQkxF",
-            "EAoSJQohREFfRkFJTEVEX1RPX0pPSU5fQUxSRUFEWV9JTl9ST09NEAsSLQop",
-            "REFfRkFJTEVEX1RPX1JFSk9JTl9CQVRUTEVfTk9UX1JFSk9JTkFCTEUQDBIp",
-            "CiVEQV9GQUlMRURfVE9fUkVKT0lOX05PVF9GT1VORF9JTl9ST09NEA0SLAoo",
-            "REFfRkFJTEVEX1RPX1JFSk9JTl9QTEFZRVJfU1RBVEVfSU5WQUxJRBAOEg4K",
-            "CkRBX1dTX09QRU4QQBIQCgxEQV9XU19DTE9TRUQQQSoxCg1CdWZmU3RvY2tU",
-            "eXBlEgoKBk5vbmVCZhAAEgkKBVRpbWVkEAESCQoFUXVvdGEQAipxCgpEZWJ1",
-            "ZmZUeXBlEgsKB05vbmVEYmYQABIRCg1TcGVlZERvd25Pbmx5EAESEQoNQ29s",
-            "ZFNwZWVkRG93bhACEhYKElBvc2l0aW9uTG9ja2VkT25seRADEhgKFEZyb3pl",
-            "blBvc2l0aW9uTG9ja2VkEAQqhAEKFkludmVudG9yeVNsb3RTdG9ja1R5cGUS",
-            "CgoGTm9uZUl2EAASCwoHRHVtbXlJdhABEgwKCFBvY2tldEl2EAISCwoHVGlt",
-            "ZWRJdhADEgsKB1F1b3RhSXYQBBITCg9UaW1lZE1hZ2F6aW5lSXYQBRIUChBH",
-            "YXVnZWRNYWdhemluZUl2EAYqPAoZUGxheWVyU3RvcnlNb2RlU2VsZWN0Vmll",
-            "dxIICgROT05FEAASCgoGUkVHSU9OEAESCQoFTEVWRUwQAio1ChBGaW5pc2hl",
-            "ZEx2T3B0aW9uEg0KCUJPU1NfT05MWRAAEhIKDlNUT1JZX0FORF9CT1NTEAFC",
-            "EEgD+AEBqgIIanRzaGFyZWRiBnByb3RvMw=="));
+            "ZXZlbBgKIAEoBCJ6Cg5VcHN5bmNTbmFwc2hvdBIRCglzdF9pZmRfaWQYASAB",
+            "KAUSEAoIY21kX2xpc3QYAiADKAQSGAoQYWNrZWRfcmVmX3JkZl9pZBgDIAEo",
+            "BRIXCg9jaGVja3N1bV9yZGZfaWQYBCABKAUSEAoIY2hlY2tzdW0YBSABKAQi",
+            "8QUKBVdzUmVxEg4KBnNlcV9ubxgBIAEoDRISCgpqb2luX2luZGV4GAIgASgN",
+            "EiAKA2FjdBgDIAEoDjITLmp0c2hhcmVkLlVwc3luY0FjdBIQCghhdXRoX2tl",
+            "eRgEIAEoBRIxCg91cHN5bmNfc25hcHNob3QYBSABKAsyGC5qdHNoYXJlZC5V",
+            "cHN5bmNTbmFwc2hvdBIuCg9zZWxmX3BhcnNlZF9yZGYYBiABKAsyFS5qdHNo",
+            "YXJlZC5SZW5kZXJGcmFtZRIfChdiYXR0bGVfZHVyYXRpb25fc2Vjb25kcxgH",
+            "IAEoBRJAChNzZXJpYWxpemVkX2JhcnJpZXJzGAggAygLMiMuanRzaGFyZWQu",
+            "U2VyaWFsaXplZEJhcnJpZXJDb2xsaWRlchJUChxwcmVhbGxvY2F0ZV9ucGNf",
+            "c3BlY2llc19kaWN0GAsgAygLMi4uanRzaGFyZWQuV3NSZXEuUHJlYWxsb2Nh",
+            "dGVOcGNTcGVjaWVzRGljdEVudHJ5EkEKGnRyYXBfY29uZmlnX2Zyb21fdGls",
+            "ZV9saXN0GAwgAygLMh0uanRzaGFyZWQuVHJhcENvbmZpZ0Zyb21UaWxlZBJH",
+            "Ch10cmlnZ2VyX2NvbmZpZ19mcm9tX3RpbGVfbGlzdBgNIAMoCzIgLmp0c2hh",
+            "cmVkLlRyaWdnZXJDb25maWdGcm9tVGlsZWQSSQoecGlja2FibGVfY29uZmln",
+            "X2Zyb21fdGlsZV9saXN0GA4gAygLMiEuanRzaGFyZWQuUGlja2FibGVDb25m",
+            "aWdGcm9tVGlsZWQSGwoTZmFsbGVuX2RlYXRoX2hlaWdodBgPIAEoAhI+ChZi",
+            "YXR0bGVfc3BlY2lmaWNfY29uZmlnGBAgASgLMh4uanRzaGFyZWQuQmF0dGxl",
+            "U3BlY2lmaWNDb25maWcaQAoeUHJlYWxsb2NhdGVOcGNTcGVjaWVzRGljdEVu",
+            "dHJ5EgsKA2tleRgBIAEoDRINCgV2YWx1ZRgCIAEoDToCOAEi4QEKCVBhdHJv",
+            "bEN1ZRIKCgJpZBgBIAEoBRIOCgZmbF9hY3QYAiABKAQSDgoGZnJfYWN0GAMg",
+            "ASgEEhkKEWZsX2NhcHR1cmVfZnJhbWVzGAQgASgFEhkKEWZyX2NhcHR1cmVf",
+            "ZnJhbWVzGAUgASgFEg4KBmZkX2FjdBgGIAEoBBIOCgZmdV9hY3QYByABKAQS",
+            "GQoRZmRfY2FwdHVyZV9mcmFtZXMYCCABKAUSGQoRZnVfY2FwdHVyZV9mcmFt",
+            "ZXMYCSABKAUSHAoTY29sbGlzaW9uX3R5cGVfbWFzaxiFCCABKAQihRcKDEJ1",
+            "bGxldENvbmZpZxIWCg5zdGFydHVwX2ZyYW1lcxgBIAEoBRIhChlzdGFydHVw",
+            "X2ludmluc2libGVfZnJhbWVzGAIgASgFEhwKFGNhbmNlbGxhYmxlX3N0X2Zy",
+            "YW1lGAMgASgFEhwKFGNhbmNlbGxhYmxlX2VkX2ZyYW1lGAQgASgFEhUKDWFj",
+            "dGl2ZV9mcmFtZXMYBSABKAUSFwoPY29vbGRvd25fZnJhbWVzGAYgASgFEhcK",
+            "D2hpdF9zdHVuX2ZyYW1lcxgHIAEoBRIZChFibG9ja19zdHVuX2ZyYW1lcxgI",
+            "IAEoBRIWCg5wdXNoYmFja192ZWxfeBgJIAEoAhIWCg5wdXNoYmFja192ZWxf",
+            "eRgKIAEoAhIOCgZkYW1hZ2UYCyABKAUSFwoPc2VsZl9sb2NrX3ZlbF94GAwg",
+            "ASgCEhcKD3NlbGZfbG9ja192ZWxfeRgNIAEoAhIjChtzZWxmX2xvY2tfdmVs",
+            "X3lfd2hlbl9mbHlpbmcYDiABKAISFwoPaGl0Ym94X29mZnNldF94GA8gASgC",
+            "EhcKD2hpdGJveF9vZmZzZXRfeRgQIAEoAhIaChJoaXRib3hfaGFsZl9zaXpl",
+            "X3gYESABKAISGgoSaGl0Ym94X2hhbGZfc2l6ZV95GBIgASgCEiIKGm1lbGVl",
+            "X2hpdF9zZWxmX3N0dW5fZnJhbWVzGBMgASgFEiYKHmFjdGl2ZV9hbmltX2xv",
+            "b3BpbmdfcmRmX29mZnNldBgVIAEoBRIeChZ2YW5pc2hpbmdfYW5pbV9yZGZf",
+            "Y250GBcgASgFEikKIXZhbmlzaGluZ19hbmltX2xvb3BpbmdfcmRmX29mZnNl",
+            "dBgYIAEoBRIYChBoaXRfYW5pbV9yZGZfY250GBogASgFEiQKBmJfdHlwZRgb",
+            "IAEoDjIULmp0c2hhcmVkLkJ1bGxldFR5cGUSJwoHbWhfdHlwZRgcIAEoDjIW",
+            "Lmp0c2hhcmVkLk11bHRpSGl0VHlwZRIiChpzaW11bHRhbmVvdXNfbXVsdGlf",
+            "aGl0X2NudBgdIAEoDRINCgVzcGVlZBgeIAEoAhIYChBzcGVlZF9pZl9ub3Rf",
+            "aGl0GB8gASgCEhAKCGhhcmRuZXNzGCAgASgFEh0KFWhpdF9pbnZpbnNpYmxl",
+            "X2ZyYW1lcxgjIAEoBRIUCgxwZXJwX2FjY19tYWcYJSABKAUSIAoYZGVsYXlf",
+            "c2VsZl92ZWxfdG9fYWN0aXZlGCYgASgIEhwKFGhpdF9vbl9tdWx0aV9jb250",
+            "YWN0GCcgASgIEhoKEm9taXRfc29mdF9wdXNoYmFjaxgoIAEoCBIYChByZW1h",
+            "aW5zX3Vwb25faGl0GCkgASgIEiYKHnJlbmRlcl9yb3RhdGlvbl9hbG9uZ192",
+            "ZWxvY2l0eRgqIAEoCBIPCgdibG93X3VwGC4gASgIEhQKDHJlcGVhdF9xdW90",
+            "YRgvIAEoBRIeChZtaF92YW5pc2hfb25fbWVsZWVfaGl0GDAgASgIEh0KFW1o",
+            "X3VwZGF0ZXNfb3JpZ2luX3BvcxgyIAEoCBIWCg5iZWFtX2NvbGxpc2lvbhgz",
+            "IAEoCBIQCghmb3JfYWxseRg0IAEoCBIZChFoaXRib3hfc2l6ZV9pbmNfeBg1",
+            "IAEoAhIZChFoaXRib3hfc2l6ZV9pbmNfeRg2IAEoAhIWCg5hbGxvd3Nfd2Fs",
+            "a2luZxg3IAEoCBIYChBhbGxvd3NfY3JvdWNoaW5nGDggASgIEhcKD2VsZW1l",
+            "bnRhbF9hdHRycxg7IAEoDRIaChJiZWFtX3Zpc3VhbF9zaXplX3kYQCABKAIS",
+            "IAoYdG91Y2hfaGl0X2JvbWJfY29sbGlzaW9uGEEgASgIEh4KFmFpcl9yaWRp",
+            "bmdfZ3JvdW5kX3dhdmUYQiABKAgSJQodZ3JvdW5kX2ltcGFjdF9tZWxlZV9j",
+            "b2xsaXNpb24YQyABKAgSIwobd2FsbF9pbXBhY3RfbWVsZWVfY29sbGlzaW9u",
+            "GEQgASgIEhgKEG1oX2luaGVyaXRzX3NwaW4YRSABKAgSJQoGaW5pdF9xGEYg",
+            "ASgLMhAuanRzaGFyZWQuUGJRdWF0SACIAQESFQoIZnJpY3Rpb24YRyABKAJI",
+            "AYgBARIYCgtyZXN0aXR1dGlvbhhIIAEoAkgCiAEBEhsKDmdyYXZpdHlfZmFj",
+            "dG9yGEkgASgCSAOIAQESEwoLbm9faGl0X2FuaW0YSiABKAgSHwoDaWZjGEsg",
+            "ASgOMhIuanRzaGFyZWQuSWZhY2VDYXQSKAogcmVmbGVjdF9maXJlYmFsbF94",
+            "X2lmX25vdF9oYXJkZXIYTCABKAgSLQolcmVqZWN0X3JlZmxlY3Rpb25fZnJv",
+            "bV9hbm90aGVyX2J1bGxldBhNIAEoCBIgChhwcm92aWRlc194X2hhcmRfcHVz",
+            "aGJhY2sYTiABKAgSJAoccHJvdmlkZXNfeV9oYXJkX3B1c2hiYWNrX3RvcBhP",
+            "IAEoCBInCh9wcm92aWRlc195X2hhcmRfcHVzaGJhY2tfYm90dG9tGFAgASgI",
+            "EiEKGWlnbm9yZV9zbG9wZV9kZWNlbGVyYXRpb24YUSABKAgSIQoZcm90YXRl",
+            "X29mZmVuZGVyX3dpdGhfc3BpbhhSIAEoCBIgChhtaF9ub3RfdHJpZ2dlcl9v",
+            "bl9jaF9oaXQYUyABKAgSKwojbWhfbm90X3RyaWdnZXJfb25faGFyZGVyX2J1",
+            "bGxldF9oaXQYVCABKAgSKwojbWhfbm90X3RyaWdnZXJfb25faGFyZF9wdXNo",
+            "YmFja19oaXQYVSABKAgSFgoOaG9wcGVyX21pc3NpbGUYViABKAgSFgoOYmVh",
+            "bV9yZW5kZXJpbmcYVyABKAgSKgoibWlzc2lsZV9zZWFyY2hfaW50ZXJ2YWxf",
+            "cG93Mk1pbnVzMRhYIAEoDRIvCid1c2VfY2hfb2Zmc2V0X3JlZ2FyZGxlc3Nf",
+            "b2ZfZW1pc3Npb25fbWgYWSABKAgSIQoZZ2F1Z2VfaW5jX3JlZHVjdGlvbl9y",
+            "YXRpbxhdIAEoAhImCh5taF9pbmhlcml0c19mcmFtZXNfaW5fYmxfc3RhdGUY",
+            "XiABKAgSIwobZ3VhcmRfYnJlYWtlcl9leHRyYV9oaXRfY250GF8gASgFEhgK",
+            "EGZpbmlzaGluZ19mcmFtZXMYYSABKAUSJwofbm9fdmFuaXNoX2FuaW1fb25f",
+            "aGFyZF9wdXNoYmFjaxhiIAEoCBIcChNjb2xsaXNpb25fdHlwZV9tYXNrGIUI",
+            "IAEoBBIWCg10YWtlc19ncmF2aXR5GIYIIAEoCBIqCgtidWZmX2NvbmZpZxiH",
+            "CCABKAsyFC5qdHNoYXJlZC5CdWZmQ29uZmlnEkIKDmNhbmNlbF90cmFuc2l0",
+            "GIgIIAMoCzIpLmp0c2hhcmVkLkJ1bGxldENvbmZpZy5DYW5jZWxUcmFuc2l0",
+            "RW50cnkSIAoXY2hhcmFjdGVyX2VtaXRfc2Z4X25hbWUYgBAgASgJEh8KFmZp",
+            "cmViYWxsX2VtaXRfc2Z4X25hbWUYgRAgASgJEhUKDGhpdF9zZnhfbmFtZRiC",
+            "ECABKAkSGAoPYWN0aXZlX3NmeF9uYW1lGIMQIAEoCRIeChVoaXRfb25fZmxl",
+            "c2hfc2Z4X25hbWUYhBAgASgJEh0KFGhpdF9vbl9yb2NrX3NmeF9uYW1lGIUQ",
+            "IAEoCRIeChVoaXRfb25fbWV0YWxfc2Z4X25hbWUYhhAgASgJEh0KFGhpdF9v",
+            "bl93b29kX3NmeF9uYW1lGIcQIAEoCRISCglhbmltX25hbWUYiBAgASgJGjQK",
+            "EkNhbmNlbFRyYW5zaXRFbnRyeRILCgNrZXkYASABKAUSDQoFdmFsdWUYAiAB",
+            "KA06AjgBQgkKB19pbml0X3FCCwoJX2ZyaWN0aW9uQg4KDF9yZXN0aXR1dGlv",
+            "bkIRCg9fZ3Jhdml0eV9mYWN0b3Ii4AQKBkJ1bGxldBInCghibF9zdGF0ZRgB",
+            "IAEoDjIVLmp0c2hhcmVkLkJ1bGxldFN0YXRlEhoKEmZyYW1lc19pbl9ibF9z",
+            "dGF0ZRgCIAEoBRIKCgJ1ZBgDIAEoBBIiChpvcmlnaW5hdGVkX3JlbmRlcl9m",
+            "cmFtZV9pZBgEIAEoBRITCgtvZmZlbmRlcl91ZBgFIAEoBBIJCgF4GAYgASgC",
+            "EgkKAXkYByABKAISCQoBehgIIAEoAhILCgNxX3gYCSABKAISCwoDcV95GAog",
+            "ASgCEgsKA3FfehgLIAEoAhILCgNxX3cYDCABKAISDQoFdmVsX3gYDSABKAIS",
+            "DQoFdmVsX3kYDiABKAISDQoFdmVsX3oYDyABKAISFAoMb3JpZ2luYXRlZF94",
+            "GBAgASgCEhQKDG9yaWdpbmF0ZWRfeRgRIAEoAhIUCgxvcmlnaW5hdGVkX3oY",
+            "EiABKAISGQoRcmVwZWF0X3F1b3RhX2xlZnQYEyABKAUSEQoJdGFyZ2V0X3Vk",
+            "GBUgASgEEhUKDWRhbWFnZV9kZWFsZWQYFiABKAUSJgoKaGl0X29uX2lmYxgX",
+            "IAEoDjISLmp0c2hhcmVkLklmYWNlQ2F0EhgKEGFjdGl2ZV9za2lsbF9oaXQY",
+            "GSABKAUSEAoIc2tpbGxfaWQYGiABKA0SCgoCaWQYGyABKA0SDwoHdGVhbV9p",
+            "ZBgcIAEoBRIQCghmb3JfYWxseRgdIAEoCBIUCgxncm91bmRfdmVsX3gYHiAB",
+            "KAISFAoMZ3JvdW5kX3ZlbF95GB8gASgCEhQKDGdyb3VuZF92ZWxfehggIAEo",
+            "AiK3BAoKVHJhcENvbmZpZxILCgN0cHQYASABKA0SFwoPZHlpbmdfYW5pbV9u",
+            "YW1lGAIgASgJEhoKEmR5aW5nX2FuaW1fcmRmX2NudBgDIAEoBRIPCgdibG93",
+            "X3VwGAQgASgIEhYKDmNvbnRhY3RfZGFtYWdlGAUgASgFEhcKD2hpdF9zdHVu",
+            "X2ZyYW1lcxgGIAEoBRIdChVoaXRfaW52aW5zaWJsZV9mcmFtZXMYByABKAUS",
+            "FQoNZGVhY3RpdmF0YWJsZRgIIAEoCBIQCghoYXJkbmVzcxgJIAEoBRIhChlk",
+            "ZWFjdGl2YXRlX3Vwb25fdHJpZ2dlcmVkGAogASgIEhgKEHN1cmZhY2VfZnJp",
+            "Y3Rpb24YCyABKAISFQoNdXNlX2tpbmVtYXRpYxgMIAEoCBIVCg1hdGsxX3Nr",
+            "aWxsX2lkGBcgASgNEh8KF2RlZmF1bHRfYm94X2hhbGZfc2l6ZV94GBogASgC",
+            "Eh8KF2RlZmF1bHRfYm94X2hhbGZfc2l6ZV95GBsgASgCEhwKFGRlZmF1bHRf",
+            "bGluZWFyX3NwZWVkGBwgASgCEh0KFWRlZmF1bHRfYW5ndWxhcl9zcGVlZBgd",
+            "IAEoAhIiChpkZWZhdWx0X2Nvb2xkb3duX3JkZl9jb3VudBgeIAEoBRIjCht1",
+            "c2Vfb2JzdGFibGVfaW50ZXJmYWNlX2JvZHkYHyABKAgSGwoTbm9feF9mbGlw",
+            "X3JlbmRlcmluZxggIAEoCBINCgRuYW1lGIAIIAEoCSKrBgoTVHJhcENvbmZp",
+            "Z0Zyb21UaWxlZBIKCgJpZBgBIAEoDRILCgN0cHQYAiABKA0SDQoFcXVvdGEY",
+            "AyABKAUSFwoPYm94X2hhbGZfc2l6ZV94GAQgASgCEhcKD2JveF9oYWxmX3Np",
+            "emVfeRgFIAEoAhIUCgxsaW5lYXJfc3BlZWQYBiABKAISFQoNYW5ndWxhcl9z",
+            "cGVlZBgHIAEoAhIOCgZpbml0X3gYCCABKAISDgoGaW5pdF95GAkgASgCEg4K",
+            "BmluaXRfehgKIAEoAhIQCghpbml0X3FfeBgLIAEoAhIQCghpbml0X3FfeRgM",
+            "IAEoAhIQCghpbml0X3FfehgNIAEoAhIQCghpbml0X3FfdxgOIAEoAhISCgpp",
+            "bml0X3ZlbF94GA8gASgCEhIKCmluaXRfdmVsX3kYECABKAISEgoKaW5pdF92",
+            "ZWxfehgRIAEoAhIWCg5pbml0X2FuZ192ZWxfeBgSIAEoAhIWCg5pbml0X2Fu",
+            "Z192ZWxfeRgTIAEoAhIWCg5pbml0X2FuZ192ZWxfehgUIAEoAhIaChJjb29s",
+            "ZG93bl9yZGZfY291bnQYFSABKAUSFQoNc2xpZGVyX2F4aXNfeBgWIAEoAhIV",
+            "Cg1zbGlkZXJfYXhpc195GBcgASgCEhUKDXNsaWRlcl9heGlzX3oYGCABKAIS",
+            "MwoMYmFycmllcl9hdHRyGBkgASgLMh0uanRzaGFyZWQuQmFycmllckNvbGxp",
+            "ZGVyQXR0chIzCgVvb2libxgaIAEoDjIkLmp0c2hhcmVkLk92ZXJyaWRlT2Jz",
+            "SWZhY2VCb2R5T3B0aW9uEiAKGHN1YnNjcmliZXNfdG9fdHJpZ2dlcl9pZBgb",
+            "IAEoDRIVCgdsaW1pdF8xGIABIAEoAkgAiAEBEhUKB2xpbWl0XzIYgQEgASgC",
+            "SAGIAQESFQoHbGltaXRfMxiCASABKAJIAogBARIVCgdsaW1pdF80GIMBIAEo",
+            "AkgDiAEBEhgKD2luaXRfbm90X21vdmluZxiABCABKAhCCgoIX2xpbWl0XzFC",
+            "CgoIX2xpbWl0XzJCCgoIX2xpbWl0XzNCCgoIX2xpbWl0XzQi7gEKE0JhcnJp",
+            "ZXJDb2xsaWRlckF0dHISHgoWcHJvdmlkZXNfaGFyZF9wdXNoYmFjaxgBIAEo",
+            "CBIaChJwcm92aWRlc19zbGlwX2p1bXAYAiABKAgSHwoXcHJvaGliaXRzX3dh",
+            "bGxfZ3JhYmJpbmcYAyABKAgSIQoZb25seV9hbGxvd3NfYWxpZ25lZF92ZWxf",
+            "eBgFIAEoBRIhChlvbmx5X2FsbG93c19hbGlnbmVkX3ZlbF95GAYgASgFEhkK",
+            "EXByb3ZpZGVzX3N0YWlyc19wGAcgASgIEhkKEXByb3ZpZGVzX3N0YWlyc19u",
+            "GAggASgIIqECCgRUcmFwEgoKAmlkGAEgASgNEgsKA3RwdBgCIAEoDRInCgp0",
+            "cmFwX3N0YXRlGAQgASgOMhMuanRzaGFyZWQuVHJhcFN0YXRlEhwKFGZyYW1l",
+            "c19pbl90cmFwX3N0YXRlGAUgASgFEgkKAXgYDSABKAISCQoBeRgOIAEoAhIJ",
+            "CgF6GA8gASgCEgsKA3FfeBgQIAEoAhILCgNxX3kYESABKAISCwoDcV96GBIg",
+            "ASgCEgsKA3FfdxgTIAEoAhINCgV2ZWxfeBgUIAEoAhINCgV2ZWxfeRgVIAEo",
+            "AhINCgV2ZWxfehgWIAEoAhIRCglhbmdfdmVsX3gYFyABKAISEQoJYW5nX3Zl",
+            "bF95GBggASgCEhEKCWFuZ192ZWxfehgZIAEoAiJJCgtQZWVyVWRwQWRkchIK",
+            "CgJpcBgBIAEoCRIMCgRwb3J0GAIgASgFEhAKCGF1dGhfa2V5GAMgASgFEg4K",
+            "BnNlcV9ubxgEIAEoDSI6CgxTdGVhbUJpbmRpbmcSEwoLdWxfc3RlYW1faWQY",
+            "ASABKAQSFQoNY2hfc3BlY2llc19pZBgCIAEoDSLBAwoKU3RlcFJlc3VsdBIo",
+            "CgthaW1pbmdfcmF5cxgBIAMoCzITLmp0c2hhcmVkLkFpbWluZ1JheRIYChBh",
+            "aW1pbmdfcmF5X2NvdW50GAIgASgNEi0KEmZ1bGZpbGxlZF90cmlnZ2VycxgD",
+            "IAMoCzIRLmp0c2hhcmVkLlRyaWdnZXISTAoVZnVsZmlsbGVkX3RyaWdnZXJf",
+            "aWRzGAQgAygLMi0uanRzaGFyZWQuU3RlcFJlc3VsdC5GdWxmaWxsZWRUcmln",
+            "Z2VySWRzRW50cnkSVwobZnVsZmlsbGVkX3RyaWdnZXJfZ3JvdXBfaWRzGAUg",
+            "AygLMjIuanRzaGFyZWQuU3RlcFJlc3VsdC5GdWxmaWxsZWRUcmlnZ2VyR3Jv",
+            "dXBJZHNFbnRyeRIcChRwcmVwYXJlZF90cmlnZ2VyX3VkcxgGIAMoBBo6ChhG",
+            "dWxmaWxsZWRUcmlnZ2VySWRzRW50cnkSCwoDa2V5GAEgASgNEg0KBXZhbHVl",
+            "GAIgASgIOgI4ARo/Ch1GdWxmaWxsZWRUcmlnZ2VyR3JvdXBJZHNFbnRyeRIL",
+            "CgNrZXkYASABKA0SDQoFdmFsdWUYAiABKAg6AjgBIoAECgtSZW5kZXJGcmFt",
+            "ZRIKCgJpZBgBIAEoBRIyCgdwbGF5ZXJzGAIgAygLMiEuanRzaGFyZWQuUGxh",
+            "eWVyQ2hhcmFjdGVyRG93bnN5bmMSFwoPY291bnRkb3duX25hbm9zGAMgASgD",
+            "EiEKB2J1bGxldHMYBCADKAsyEC5qdHNoYXJlZC5CdWxsZXQSLAoEbnBjcxgF",
+            "IAMoCzIeLmp0c2hhcmVkLk5wY0NoYXJhY3RlckRvd25zeW5jEiUKDWR5bmFt",
+            "aWNfdHJhcHMYBiADKAsyDi5qdHNoYXJlZC5UcmFwEiMKCHRyaWdnZXJzGAcg",
+            "AygLMhEuanRzaGFyZWQuVHJpZ2dlchIlCglwaWNrYWJsZXMYCCADKAsyEi5q",
+            "dHNoYXJlZC5QaWNrYWJsZRIZChFidWxsZXRfaWRfY291bnRlchgJIAEoDRIU",
+            "CgxidWxsZXRfY291bnQYCiABKA0SFgoObnBjX2lkX2NvdW50ZXIYCyABKA0S",
+            "EQoJbnBjX2NvdW50GAwgASgNEhUKDXRyaWdnZXJfY291bnQYDSABKA0SGwoT",
+            "cGlja2FibGVfaWRfY291bnRlchgPIAEoDRIWCg5waWNrYWJsZV9jb3VudBgQ",
+            "IAEoDRIaChJkeW5hbWljX3RyYXBfY291bnQYESABKA0SEAoIY2hlY2tzdW0Y",
+            "EiABKAQilwEKEUJhdHRsZVByZXBhcmVJbmZvEhIKCnN0YWdlX25hbWUYASAB",
+            "KAkSFQoNYm91bmRfcm9vbV9pZBgCIAEoBRIeChZiYXR0bGVfZHVyYXRpb25f",
+            "ZnJhbWVzGAMgASgDEhsKE2JvdW5kX3Jvb21fY2FwYWNpdHkYBCABKAUSGgoR",
+            "ZnJhbWVfbG9nX2VuYWJsZWQYgQggASgIInEKEklucHV0RnJhbWVEb3duc3lu",
+            "YxITCgtpbnB1dF9jb3VudBgBIAEoDRISCgppbnB1dF9saXN0GAIgAygEEhYK",
+            "DmNvbmZpcm1lZF9saXN0GAMgASgEEhoKEnVkcF9jb25maXJtZWRfbGlzdBgE",
+            "IAEoBCL3AQoQUmVuZGVyRnJhbWVEZWx0YRITCgtiYXNlX3JkZl9pZBgBIAEo",
+            "BRImCgdjaGFuZ2VkGAIgASgLMhUuanRzaGFyZWQuUmVuZGVyRnJhbWUSGQoR",
+            "cGxheWVyX2RpcnR5X21hc2sYAyADKAQSFgoObnBjX2RpcnR5X21hc2sYBCAD",
+            "KAQSGQoRYnVsbGV0X2RpcnR5X21hc2sYBSADKAQSHwoXZHluYW1pY190cmFw",
+            "X2RpcnR5X21hc2sYBiADKAQSGgoSdHJpZ2dlcl9kaXJ0eV9tYXNrGAcgAygE",
+            "EhsKE3BpY2thYmxlX2RpcnR5X21hc2sYCCADKAQi8gQKEERvd25zeW5jU25h",
+            "cHNob3QSEgoKcmVmX3JkZl9pZBgBIAEoBRImCgdyZWZfcmRmGAIgASgLMhUu",
+            "anRzaGFyZWQuUmVuZGVyRnJhbWUSMQoNcmVmX3JkZl9kZWx0YRgRIAEoCzIa",
+            "Lmp0c2hhcmVkLlJlbmRlckZyYW1lRGVsdGESGAoQdW5jb25maXJtZWRfbWFz",
+            "axgDIAEoBBIRCglzdF9pZmRfaWQYBCABKAUSLwoJaWZkX2JhdGNoGAUgAygL",
+            "MhwuanRzaGFyZWQuSW5wdXRGcmFtZURvd25zeW5jEiIKA2FjdBgHIAEoDjIV",
+            "Lmp0c2hhcmVkLkRvd25zeW5jQWN0EjEKDHByZXBhcmVfaW5mbxgIIAEoCzIb",
+            "Lmp0c2hhcmVkLkJhdHRsZVByZXBhcmVJbmZvEjIKE2Fzc2lnbmVkX3VkcF90",
+            "dW5uZWwYCSABKAsyFS5qdHNoYXJlZC5QZWVyVWRwQWRkchIxChJwZWVyX3Vk",
+            "cF9hZGRyX2xpc3QYCiADKAsyFS5qdHNoYXJlZC5QZWVyVWRwQWRkchIdChVw",
+            "YXJ0aWNpcGFudF9jaGFuZ2VfaWQYCyABKAUSGgoSaW5hY3RpdmVfam9pbl9t",
+            "YXNrGAwgASgEEhcKD3BlZXJfam9pbl9pbmRleBgNIAEoDRIbChNwZWVyX2J1",
+            "bGxldF90ZWFtX2lkGA4gASgFEhcKD3BlZXJfc3BlY2llc19pZBgPIAEoDRI3",
+            "ChdwZWVyX3N0ZWFtX2JpbmRpbmdfbGlzdBgQIAMoCzIWLmp0c2hhcmVkLlN0",
+            "ZWFtQmluZGluZxIQCgdlcnJfbXNnGIAEIAEoCSK2AwoFU2tpbGwSCgoCaWQY",
+            "ASABKA0SFwoPcmVjb3ZlcnlfZnJhbWVzGAIgASgFEiAKGHJlY292ZXJ5X2Zy",
+            "YW1lc19vbl9ibG9jaxgDIAEoBRIeChZyZWNvdmVyeV9mcmFtZXNfb25faGl0",
+            "GAQgASgFEjIKD2ludm9jYXRpb25fdHlwZRgFIAEoDjIZLmp0c2hhcmVkLlNr",
+            "aWxsSW52b2NhdGlvbhIwCg5ib3VuZF9jaF9zdGF0ZRgGIAEoDjIYLmp0c2hh",
+            "cmVkLkNoYXJhY3RlclN0YXRlEjcKFWJvdW5kX2NoX3N0YXRlX29uX2hpdBgH",
+            "IAEoDjIYLmp0c2hhcmVkLkNoYXJhY3RlclN0YXRlEhAKCG1wX2RlbHRhGAgg",
+            "ASgFEhsKE2F0azFfbWFnYXppbmVfZGVsdGEYCSABKAUSHQoVc3VwZXJfYXRr",
+            "X2dhdWdlX2RlbHRhGAogASgFEiUKBGhpdHMYgAggAygLMhYuanRzaGFyZWQu",
+            "QnVsbGV0Q29uZmlnEjIKE3NlbGZfbm9uX3N0b2NrX2J1ZmYYgQggASgLMhQu",
+            "anRzaGFyZWQuQnVmZkNvbmZpZyL0AgoIRnJhbWVMb2cSIgoDcmRmGAEgASgL",
+            "MhUuanRzaGFyZWQuUmVuZGVyRnJhbWUSHAoUYWN0dWFsbHlfdXNlZF9pZmRf",
+            "aWQYAiABKAUSGwoTdXNlZF9pZmRfaW5wdXRfbGlzdBgDIAMoBBIfChd1c2Vk",
+            "X2lmZF9jb25maXJtZWRfbGlzdBgEIAEoBBIjCht1c2VkX2lmZF91ZHBfY29u",
+            "ZmlybWVkX2xpc3QYBSABKAQSFAoMdGltZXJfcmRmX2lkGAYgASgFEhMKC2xj",
+            "YWNfaWZkX2lkGAcgASgFEhUKDWNoYXNlcl9yZGZfaWQYCCABKAUSIQoZY2hh",
+            "c2VyX3JkZl9pZF9sb3dlcl9ib3VuZBgJIAEoBRIYChBjaGFzZXJfc3RfcmRm",
+            "X2lkGAogASgFEhgKEGNoYXNlcl9lZF9yZGZfaWQYCyABKAUSKgoiY2hhc2Vy",
+            "X3JkZl9pZF9sb3dlcl9ib3VuZF9zbmF0Y2hlZBgMIAEoCCL0AgoNUm9sbGJh",
+            "Y2tTdGF0cxIUCgxyb2xsYmFja19jbnQYASABKAUSGgoSbWF4X3JvbGxiYWNr",
+            "X2RlcHRoGAIgASgFEiAKGHJvbGxiYWNrX2RlcHRoX2hpc3RvZ3JhbRgDIAMo",
+            "BRIeChZyb2xsYmFja19mcm9tX3NlbGZfY250GAQgASgFEh0KFXJvbGxiYWNr",
+            "X2Zyb21fdWRwX2NudBgFIAEoBRIwCihyb2xsYmFja19mcm9tX3JlZ3VsYXRl",
+            "X2JlZm9yZV9yZW5kZXJfY250GAYgASgFEhsKE3Jlc2ltdWxhdGVkX3JkZl9j",
+            "bnQYByABKAMSFgoOY2hhc2luZ19taWNyb3MYCCABKAMSFgoOZWxhcHNlZF9t",
+            "aWNyb3MYCSABKAMSJgoecHJlZGljdGVkX2lucHV0X2NudF9wZXJfcGxheWVy",
+            "GAogAygFEikKIW1pc3ByZWRpY3RlZF9pbnB1dF9jbnRfcGVyX3BsYXllchgL",
+            "IAMoBSJICgxCYXR0bGVSZXN1bHQSGQoRd2lubmVyX2pvaW5faW5kZXgYASAB",
+            "KA0SHQoVd2lubmVyX2J1bGxldF90ZWFtX2lkGAIgASgFIskBCgxEZWJ1ZmZD",
+            "b25maWcSEgoKc3BlY2llc19pZBgBIAEoDRIrCgpzdG9ja190eXBlGAIgASgO",
+            "MhcuanRzaGFyZWQuQnVmZlN0b2NrVHlwZRINCgVzdG9jaxgDIAEoBRIiCgR0",
+            "eXBlGAQgASgOMhQuanRzaGFyZWQuRGVidWZmVHlwZRIPCgdhcnJfaWR4GAUg",
+            "ASgFEhsKE2ltcGFjdF9wZXJfaW50ZXJ2YWwYBiABKAUSFwoPaW1wYWN0X2lu",
+            "dGVydmFsGAcgASgFIvEDCgpCdWZmQ29uZmlnEhIKCnNwZWNpZXNfaWQYASAB",
+            "KA0SKwoKc3RvY2tfdHlwZRgCIAEoDjIXLmp0c2hhcmVkLkJ1ZmZTdG9ja1R5",
+            "cGUSDQoFc3RvY2sYAyABKAUSEwoLc3BlZWRfZGVsdGEYBCABKAISIAoYaGl0",
+            "Ym94X2hhbGZfc2l6ZV94X2RlbHRhGAUgASgCEiAKGGhpdGJveF9oYWxmX3Np",
+            "emVfeV9kZWx0YRgGIAEoAhIUCgxkYW1hZ2VfZGVsdGEYByABKAUSIgoaZGFt",
+            "YWdlX2RlbHRhX2J5X3BlcmNlbnRhZ2UYCCABKAUSIAoYY2hhcmFjdGVyX2hh",
+            "cmRuZXNzX2RlbHRhGAkgASgFEhwKFG1lbGVlX2hhcmRuZXNzX2RlbHRhGAog",
+            "ASgFEh8KF2ZpcmViYWxsX2hhcmRuZXNzX2RlbHRhGAsgASgFEhIKCmludmlu",
+            "c2libGUYDCABKAgSGwoTeGZvcm1fY2hfc3BlY2llc19pZBgNIAEoDRIbChNy",
+            "ZXBlbF9zb2Z0X3B1c2hiYWNrGA4gASgIEhQKDG9taXRfZ3Jhdml0eRgPIAEo",
+            "CBIaChJhc3NvY2lhdGVkX2RlYnVmZnMYESADKA0SHwoXY2hhcmFjdGVyX3Zm",
+            "eF9hbmltX25hbWUYEiABKAkipgEKBEJ1ZmYSEgoKc3BlY2llc19pZBgBIAEo",
+            "DRINCgVzdG9jaxgCIAEoBRIiChpvcmlnaW5hdGVkX3JlbmRlcl9mcmFtZV9p",
+            "ZBgDIAEoBRIaChJvcmlnX2NoX3NwZWNpZXNfaWQYBCABKA0SIAoYb3JpZ19y",
+            "ZXBlbF9zb2Z0X3B1c2hiYWNrGAUgASgIEhkKEW9yaWdfb21pdF9ncmF2aXR5",
+            "GAYgASgIIisKBkRlYnVmZhISCgpzcGVjaWVzX2lkGAEgASgNEg0KBXN0b2Nr",
+            "GAIgASgFIk0KEkJ1bGxldEltbXVuZVJlY29yZBIRCglidWxsZXRfaWQYASAB",
+            "KA0SJAoccmVtYWluaW5nX2xpZmV0aW1lX3JkZl9jb3VudBgCIAEoBSKhAQoT",
+            "SW52ZW50b3J5U2xvdENvbmZpZxI0CgpzdG9ja190eXBlGAEgASgOMiAuanRz",
+            "aGFyZWQuSW52ZW50b3J5U2xvdFN0b2NrVHlwZRINCgVxdW90YRgCIAEoDRIZ",
+            "ChFmcmFtZXNfdG9fcmVjb3ZlchgDIAEoBRIWCg5nYXVnZV9yZXF1aXJlZBgE",
+            "IAEoBRISCgpiYWRnZV9uYW1lGEAgASgJIp4BCg1JbnZlbnRvcnlTbG90EjQK",
+            "CnN0b2NrX3R5cGUYASABKA4yIC5qdHNoYXJlZC5JbnZlbnRvcnlTbG90U3Rv",
+            "Y2tUeXBlEg0KBXF1b3RhGAIgASgNEhkKEWZyYW1lc190b19yZWNvdmVyGAMg",
+            "ASgFEhUKDWdhdWdlX2NoYXJnZWQYBCABKAUSFgoOYWRob2Nfc2tpbGxfaWQY",
+            "BSABKA0iJQoPQmF0dGxlRXF1aXBtZW50EhIKCnNwZWNpZXNfaWQYASABKA0i",
+            "wgEKDlBsYXllclNldHRpbmdzEhIKCnNmeF92b2x1bWUYASABKAUSEgoKYmdt",
+            "X3ZvbHVtZRgCIAEoBRIVCg1idG5fYV9iaW5kaW5nGAMgASgEEhUKDWJ0bl9i",
+            "X2JpbmRpbmcYBCABKAQSFQoNYnRuX2NfYmluZGluZxgFIAEoBBIVCg1idG5f",
+            "ZF9iaW5kaW5nGAYgASgEEhUKDWJ0bl9lX2JpbmRpbmcYByABKAQSFQoNYnRu",
+            "X2ZfYmluZGluZxgIIAEoBCL0AgoUUGxheWVyUmVnaW9uUHJvZ3Jlc3MSEQoJ",
+            "cmVnaW9uX2lkGAEgASgFEh0KFWNvbXBsZXRlZF9sZXZlbF9jb3VudBgCIAEo",
+            "BRJZChZyZW1haW5pbmdfZGVwZW5kZW5jaWVzGAMgAygLMjkuanRzaGFyZWQu",
+            "UGxheWVyUmVnaW9uUHJvZ3Jlc3MuUmVtYWluaW5nRGVwZW5kZW5jaWVzRW50",
+            "cnkSVQoUcmVtb3ZlZF9kZXBlbmRlbmNpZXMYBCADKAsyNy5qdHNoYXJlZC5Q",
+            "bGF5ZXJSZWdpb25Qcm9ncmVzcy5SZW1vdmVkRGVwZW5kZW5jaWVzRW50cnka",
+            "PAoaUmVtYWluaW5nRGVwZW5kZW5jaWVzRW50cnkSCwoDa2V5GAEgASgFEg0K",
+            "BXZhbHVlGAIgASgIOgI4ARo6ChhSZW1vdmVkRGVwZW5kZW5jaWVzRW50cnkS",
+            "CwoDa2V5GAEgASgFEg0KBXZhbHVlGAIgASgIOgI4ASLUBAoTUGxheWVyTGV2",
+            "ZWxQcm9ncmVzcxIRCglyZWdpb25faWQYASABKAUSEAoIbGV2ZWxfaWQYAiAB",
+            "KAUSFQoNaGlnaGVzdF9zY29yZRgDIAEoBRItCiVzaG9ydGVzdF9maW5pc2hf",
+            "dGltZV9hdF9oaWdoZXN0X3Njb3JlGAQgASgFEi0KJWNoYXJhY3Rlcl9zcGVj",
+            "aWVzX2lkX2F0X2hpZ2hlc3Rfc2NvcmUYBSABKA0SHAoUc2hvcnRlc3RfZmlu",
+            "aXNoX3RpbWUYBiABKAUSJQodc2NvcmVfYXRfc2hvcnRlc3RfZmluaXNoX3Rp",
+            "bWUYByABKAUSNAosY2hhcmFjdGVyX3NwZWNpZXNfaWRfYXRfc2hvcnRlc3Rf",
+            "ZmluaXNoX3RpbWUYCCABKA0SWAoWcmVtYWluaW5nX2RlcGVuZGVuY2llcxgJ",
+            "IAMoCzI4Lmp0c2hhcmVkLlBsYXllckxldmVsUHJvZ3Jlc3MuUmVtYWluaW5n",
+            "RGVwZW5kZW5jaWVzRW50cnkSVAoUcmVtb3ZlZF9kZXBlbmRlbmNpZXMYCiAD",
+            "KAsyNi5qdHNoYXJlZC5QbGF5ZXJMZXZlbFByb2dyZXNzLlJlbW92ZWREZXBl",
+            "bmRlbmNpZXNFbnRyeRo8ChpSZW1haW5pbmdEZXBlbmRlbmNpZXNFbnRyeRIL",
+            "CgNrZXkYASABKAUSDQoFdmFsdWUYAiABKAg6AjgBGjoKGFJlbW92ZWREZXBl",
+            "bmRlbmNpZXNFbnRyeRILCgNrZXkYASABKAUSDQoFdmFsdWUYAiABKAg6AjgB",
+            "ItwCChZQbGF5ZXJDaFVubG9ja1Byb2dyZXNzEhIKCnNwZWNpZXNfaWQYASAB",
+            "KA0SWwoWcmVtYWluaW5nX2RlcGVuZGVuY2llcxgCIAMoCzI7Lmp0c2hhcmVk",
+            "LlBsYXllckNoVW5sb2NrUHJvZ3Jlc3MuUmVtYWluaW5nRGVwZW5kZW5jaWVz",
+            "RW50cnkSVwoUcmVtb3ZlZF9kZXBlbmRlbmNpZXMYAyADKAsyOS5qdHNoYXJl",
+            "ZC5QbGF5ZXJDaFVubG9ja1Byb2dyZXNzLlJlbW92ZWREZXBlbmRlbmNpZXNF",
+            "bnRyeRo8ChpSZW1haW5pbmdEZXBlbmRlbmNpZXNFbnRyeRILCgNrZXkYASAB",
+            "KAUSDQoFdmFsdWUYAiABKAg6AjgBGjoKGFJlbW92ZWREZXBlbmRlbmNpZXNF",
+            "bnRyeRILCgNrZXkYASABKAUSDQoFdmFsdWUYAiABKAg6AjgBIq8HChNQbGF5",
+            "ZXJTdG9yeVByb2dyZXNzElMKFHJlZ2lvbl9wcm9ncmVzc19kaWN0GAEgAygL",
+            "MjUuanRzaGFyZWQuUGxheWVyU3RvcnlQcm9ncmVzcy5SZWdpb25Qcm9ncmVz",
+            "c0RpY3RFbnRyeRJRChNsZXZlbF9wcm9ncmVzc19kaWN0GAIgAygLMjQuanRz",
+            "aGFyZWQuUGxheWVyU3RvcnlQcm9ncmVzcy5MZXZlbFByb2dyZXNzRGljdEVu",
+            "dHJ5EhgKEGN1cnNvcl9yZWdpb25faWQYAyABKAUSFwoPY3Vyc29yX2xldmVs",
+            "X2lkGAQgASgFEjEKBHZpZXcYBSABKA4yIy5qdHNoYXJlZC5QbGF5ZXJTdG9y",
+            "eU1vZGVTZWxlY3RWaWV3EhsKE3NhdmVkX2F0X2dtdF9taWxsaXMYBiABKAQS",
+            "WAoXY2hfdW5sb2NrX3Byb2dyZXNzX2RpY3QYByADKAsyNy5qdHNoYXJlZC5Q",
+            "bGF5ZXJTdG9yeVByb2dyZXNzLkNoVW5sb2NrUHJvZ3Jlc3NEaWN0RW50cnkS",
+            "EgoKY29pbl9jb3VudBgIIAEoDRIcChRkcmFnb25fY3J5c3RhbF9jb3VudBgJ",
+            "IAEoDRI7ChZwbGF5ZXJfbG91bmdlX3Bvc2l0aW9uGAogASgLMhsuanRzaGFy",
+            "ZWQuQ2hhcmFjdGVyRG93bnN5bmMSVQoVZmluaXNoZWRfc3RvcnlfcG9pbnRz",
+            "GAsgAygLMjYuanRzaGFyZWQuUGxheWVyU3RvcnlQcm9ncmVzcy5GaW5pc2hl",
+            "ZFN0b3J5UG9pbnRzRW50cnkaWQoXUmVnaW9uUHJvZ3Jlc3NEaWN0RW50cnkS",
+            "CwoDa2V5GAEgASgFEi0KBXZhbHVlGAIgASgLMh4uanRzaGFyZWQuUGxheWVy",
+            "UmVnaW9uUHJvZ3Jlc3M6AjgBGlcKFkxldmVsUHJvZ3Jlc3NEaWN0RW50cnkS",
+            "CwoDa2V5GAEgASgFEiwKBXZhbHVlGAIgASgLMh0uanRzaGFyZWQuUGxheWVy",
+            "TGV2ZWxQcm9ncmVzczoCOAEaXQoZQ2hVbmxvY2tQcm9ncmVzc0RpY3RFbnRy",
+            "eRILCgNrZXkYASABKA0SLwoFdmFsdWUYAiABKAsyIC5qdHNoYXJlZC5QbGF5",
+            "ZXJDaFVubG9ja1Byb2dyZXNzOgI4ARo6ChhGaW5pc2hlZFN0b3J5UG9pbnRz",
+            "RW50cnkSCwoDa2V5GAEgASgJEg0KBXZhbHVlGAIgASgIOgI4ASKKAgoZUGxh",
+            "eWVyT25saW5lQXJlbmFQcm9ncmVzcxIbChNzYXZlZF9hdF9nbXRfbWlsbGlz",
+            "GAEgASgEEhEKCXBsYXllcl9pZBgCIAEoCRJeChdjaF91bmxvY2tfcHJvZ3Jl",
+            "c3NfZGljdBgDIAMoCzI9Lmp0c2hhcmVkLlBsYXllck9ubGluZUFyZW5hUHJv",
+            "Z3Jlc3MuQ2hVbmxvY2tQcm9ncmVzc0RpY3RFbnRyeRpdChlDaFVubG9ja1By",
+            "b2dyZXNzRGljdEVudHJ5EgsKA2tleRgBIAEoDRIvCgV2YWx1ZRgCIAEoCzIg",
+            "Lmp0c2hhcmVkLlBsYXllckNoVW5sb2NrUHJvZ3Jlc3M6AjgBIm4KFFN0b3J5",
+            "UG9pbnREaWFsb2dMaW5lEhMKC25hcnJhdG9yX3VkGAEgASgEEhsKE25hcnJh",
+            "dG9yX3NwZWNpZXNfaWQYAiABKA0SDwoHY29udGVudBgDIAEoCRITCgtkb3du",
+            "X29yX25vdBgEIAEoCCJgCg5TdG9yeVBvaW50U3RlcBItCgVsaW5lcxgBIAMo",
+            "CzIeLmp0c2hhcmVkLlN0b3J5UG9pbnREaWFsb2dMaW5lEh8KF25vbmN0cmxf",
+            "YWxpdmVfcmRmX2NvdW50GAIgASgFInAKClN0b3J5UG9pbnQSJwoFc3RlcHMY",
+            "ASADKAsyGC5qdHNoYXJlZC5TdG9yeVBvaW50U3RlcBIPCgdub25jdHJsGAIg",
+            "ASgIEhEKCW9uY2Vfb25seRgDIAEoCBIVCg1jdXRzY2VuZV9uYW1lGAQgASgJ",
+            "Is4BChlTZXJpYWxpemFibGVDb252ZXhQb2x5Z29uEiAKBmFuY2hvchgBIAEo",
+            "CzIQLmp0c2hhcmVkLlBiVmVjMhIgCgZwb2ludHMYAiADKAsyEC5qdHNoYXJl",
+            "ZC5QYlZlYzISDgoGaXNfYm94GAMgASgIEhkKEWlzX3BhcmFsbGVsZXBpcGVk",
+            "GAQgASgIEg8KB2JveF9xX3gYBSABKAISDwoHYm94X3FfeRgGIAEoAhIPCgdi",
+            "b3hfcV96GAcgASgCEg8KB2JveF9xX3cYCCABKAIifgoZU2VyaWFsaXplZEJh",
+            "cnJpZXJDb2xsaWRlchIrCgRhdHRyGAEgASgLMh0uanRzaGFyZWQuQmFycmll",
+            "ckNvbGxpZGVyQXR0chI0Cgdwb2x5Z29uGAIgASgLMiMuanRzaGFyZWQuU2Vy",
+            "aWFsaXphYmxlQ29udmV4UG9seWdvbiJ6Cg5QaWNrYWJsZUNvbmZpZxITCgtw",
+            "aWNrdXBfdHlwZRgBIAEoDRIVCg10YWtlc19ncmF2aXR5GAIgASgIEhgKEGFj",
+            "dGl2ZV9hbmltX25hbWUYAyABKAkSEAoIYW1vdW50XzEYBCABKAUSEAoIYW1v",
+            "dW50XzIYBSABKAUixAEKF1BpY2thYmxlQ29uZmlnRnJvbVRpbGVkEhMKC3Bp",
+            "Y2t1cF90eXBlGAEgASgNEhMKC3JlY3VyX3F1b3RhGAIgASgFEikKIWxpZmV0",
+            "aW1lX3JkZl9jb3VudF9wZXJfb2NjdXJyZW5jZRgDIAEoDRIiChpzdG9ja19x",
+            "dW90YV9wZXJfb2NjdXJyZW5jZRgEIAEoDRIXCg9ib3hfaGFsZl9zaXplX3gY",
+            "BSABKAISFwoPYm94X2hhbGZfc2l6ZV95GAYgASgCIpkCCghQaWNrYWJsZRIK",
+            "CgJpZBgBIAEoDRITCgtwaWNrdXBfdHlwZRgCIAEoDRIpCghwa19zdGF0ZRgD",
+            "IAEoDjIXLmp0c2hhcmVkLlBpY2thYmxlU3RhdGUSGgoSZnJhbWVzX2luX3Br",
+            "X3N0YXRlGAQgASgFEgkKAXgYBSABKAISCQoBeRgGIAEoAhIJCgF6GAcgASgC",
+            "Eg0KBXZlbF94GAggASgCEg0KBXZlbF95GAkgASgCEg0KBXZlbF96GAogASgC",
+            "EiQKHHJlbWFpbmluZ19saWZldGltZV9yZGZfY291bnQYCyABKAUSHQoVcmVt",
+            "YWluaW5nX3JlY3VyX3F1b3RhGAwgASgFEhIKCXBpY2tlcl91ZBiABCABKAQi",
+            "NgoRSW5qZWN0ZWRDbWRDb25maWcSFQoNY3V0b2ZmX3JkZl9pZBgBIAEoBRIK",
+            "CgJvcBgCIAEoBCJeChZDaGFyYWN0ZXJTcGF3bmVyQ29uZmlnEhUKDWN1dG9m",
+            "Zl9yZGZfaWQYASABKAUSFwoPc3BlY2llc19pZF9saXN0GAIgAygNEhQKDGlu",
+            "aXRfb3BfbGlzdBgDIAMoBCJeChVQaWNrYWJsZVNwYXduZXJDb25maWcSFQoN",
+            "Y3V0b2ZmX3JkZl9pZBgBIAEoBRIYChBwaWNrdXBfdHlwZV9saXN0GAIgAygN",
+            "EhQKDGluaXRfb3BfbGlzdBgDIAMoBCIqCg1UcmlnZ2VyQ29uZmlnEgsKA3Ry",
+            "dBgBIAEoDRIMCgRuYW1lGAIgASgJIpMHChZUcmlnZ2VyQ29uZmlnRnJvbVRp",
+            "bGVkEgoKAmlkGAEgASgNEgsKA3RydBgCIAEoDRIWCg5kZWxheWVkX2ZyYW1l",
+            "cxgDIAEoBRIXCg9yZWNvdmVyeV9mcmFtZXMYBCABKAUSFgoOYnVsbGV0X3Rl",
+            "YW1faWQYBSABKAUSIAoYc3ViX2N5Y2xlX3RyaWdnZXJfZnJhbWVzGAYgASgF",
+            "EhcKD3N1Yl9jeWNsZV9xdW90YRgHIAEoBRINCgVxdW90YRgIIAEoBRIXCg9i",
+            "b3hfaGFsZl9zaXplX3gYCSABKAISFwoPYm94X2hhbGZfc2l6ZV95GAogASgC",
+            "EhUKDW5ld19yZXZpdmFsX3gYCyABKAISFQoNbmV3X3Jldml2YWxfeRgMIAEo",
+            "AhIQCghpbml0X3FfeBgNIAEoAhIQCghpbml0X3FfeRgOIAEoAhIQCghpbml0",
+            "X3FfehgPIAEoAhIQCghpbml0X3FfdxgQIAEoAhImCh5wdWJsaXNoaW5nX21h",
+            "c2tfdXBvbl9leGhhdXN0ZWQYESABKAQSLwoncHVibGlzaGluZ190b190cmln",
+            "Z2VyX2lkX3Vwb25fZXhoYXVzdGVkGBIgASgNEhwKFGZvcmNlX2N0cmxfcmRm",
+            "X2NvdW50GBMgASgFEhYKDmZvcmNlX2N0cmxfY21kGBQgASgEEg8KB3RvcG9f",
+            "bHYYFSABKA0SKAogY2FjaGVkX3N1Yl9jeWNsZV9tYXNrX3RvX2Z1bGZpbGwY",
+            "FiABKAQSGgoRaXNfc3RvcnlfcmVhZHlfZ28YgAQgASgIEg8KBmJnbV9pZBiB",
+            "BCABKAUSGgoRaXNfYm9zc19zYXZlcG9pbnQYggQgASgIEk8KEGJvc3Nfc3Bl",
+            "Y2llc19zZXQYgwQgAygLMjQuanRzaGFyZWQuVHJpZ2dlckNvbmZpZ0Zyb21U",
+            "aWxlZC5Cb3NzU3BlY2llc1NldEVudHJ5EkUKGmNoYXJhY3Rlcl9zcGF3bmVy",
+            "X3RpbWVfc2VxGIAIIAMoCzIgLmp0c2hhcmVkLkNoYXJhY3RlclNwYXduZXJD",
+            "b25maWcSQwoZcGlja2FibGVfc3Bhd25lcl90aW1lX3NlcRiBCCADKAsyHy5q",
+            "dHNoYXJlZC5QaWNrYWJsZVNwYXduZXJDb25maWcaNQoTQm9zc1NwZWNpZXNT",
+            "ZXRFbnRyeRILCgNrZXkYASABKA0SDQoFdmFsdWUYAiABKAg6AjgBIroDCgdU",
+            "cmlnZ2VyEgoKAmlkGAEgASgNEhAKCGdyb3VwX2lkGAIgASgNEhYKDmZyYW1l",
+            "c190b19maXJlGAMgASgFEhkKEWZyYW1lc190b19yZWNvdmVyGAQgASgFEg0K",
+            "BXF1b3RhGAUgASgFEhYKDmJ1bGxldF90ZWFtX2lkGAYgASgFEhcKD3N1Yl9j",
+            "eWNsZV9pbmRleBgJIAEoBRIlCgVzdGF0ZRgKIAEoDjIWLmp0c2hhcmVkLlRy",
+            "aWdnZXJTdGF0ZRIXCg9mcmFtZXNfaW5fc3RhdGUYCyABKAUSCQoBeBgMIAEo",
+            "AhIJCgF5GA0gASgCEgkKAXoYDiABKAISIgoabWFpbl9jeWNsZV9tYXNrX3Rv",
+            "X2Z1bGZpbGwYDyABKAQSIQoZc3ViX2N5Y2xlX21hc2tfdG9fZnVsZmlsbBgQ",
+            "IAEoBBIiChpzdWJfY3ljbGVfZ2VuX21hc2tfY291bnRlchgTIAEoBBITCgtv",
+            "ZmZlbmRlcl91ZBgUIAEoBBIfChdvZmZlbmRlcl9idWxsZXRfdGVhbV9pZBgV",
+            "IAEoBRILCgN0cnQYFiABKA0SDwoHdG9wb19sdhgXIAEoDSJ0Cg5QbGF5ZXJN",
+            "ZXRhSW5mbxIRCglwbGF5ZXJfaWQYASABKAkSEgoKam9pbl9pbmRleBgCIAEo",
+            "DRIWCg5idWxsZXRfdGVhbV9pZBgDIAEoBRISCgpzcGVjaWVzX2lkGAQgASgN",
+            "Eg8KB3Jvb21faWQYBSABKAUicwoRUnBjRW5kcG9pbnRIb2xkZXISCgoCaWQY",
+            "ASABKA0SGgoSZXh0ZXJuYWxfYWRkcl9ob3N0GAIgASgJEhoKEmV4dGVybmFs",
+            "X2FkZHJfcG9ydBgDIAEoDRIaChJpbnRlcm5hbF9hZGRyX2hvc3QYBCABKAki",
+            "5AMKD0NoU3BlY2llc0NvbnN0cxIRCglibGFkZWdpcmwYASABKA0SFAoMYm91",
+            "bnR5aHVudGVyGAIgASgNEhMKC2JsYWNrc2FiZXIxGAMgASgNEhUKDWJsYWNr",
+            "c2hvb3RlcjEYBCABKA0SFQoNYmxhY2t0aHJvd2VyMRgFIAEoDRIUCgxoZWFk",
+            "cXVhcnRlcjEYBiABKA0SEwoLYmxhY2tzYWJlcjIYByABKA0SFQoNYmxhY2tz",
+            "aG9vdGVyMhgIIAEoDRIUCgxzaGllbGRndWFyZDEYCSABKA0SFAoMc2hpZWxk",
+            "Z3VhcmQyGAogASgNEhMKC3JpZGVyZ3VhcmQxGAsgASgNEgwKBGJhdDEYDCAB",
+            "KA0SDQoFd29sZjEYDSABKA0SEgoKd29sdmVyaW5lMRgOIAEoDRIaChJwYXJp",
+            "c19wb2xpY2VfY2hpZWYYDyABKA0SEgoKcG9saWNlbWFuMRgQIAEoDRISCgpw",
+            "b2xpY2VtYW4yGBEgASgNEhQKDHBvbGljZXdvbWFuMRgSIAEoDRINCgRub25l",
+            "GIAQIAEoDRIiChlibGFja3NhYmVyX3Rlc3Rfbm9fdmlzaW9uGIEQIAEoDRIk",
+            "ChtibGFja3NhYmVyX3Rlc3Rfd2l0aF92aXNpb24YghAgASgNIpsBCglUcmFw",
+            "VHlwZXMSGAoQc2xpZGluZ19wbGF0Zm9ybRgBIAEoDRIZChFyb3RhdGluZ19w",
+            "bGF0Zm9ybRgCIAEoDRIVCg1jb252ZXlvcl9iZWx0GAMgASgNEhQKDGZhbGxp",
+            "bmdfcm9jaxgEIAEoDRIOCgZzcHJpbmcYBSABKA0SDQoFYnJpY2sYBiABKA0S",
+            "DQoEbm9uZRiAECABKA0i8wEKDFRyaWdnZXJUeXBlcxIPCgd2aWN0b3J5GAEg",
+            "ASgNEhUKDWJ5X2luaXRfZGVsYXkYAiABKA0SEwoLYnlfbW92ZW1lbnQYAyAB",
+            "KA0SEQoJYnlfYXR0YWNrGAQgASgNEhQKDGJ5X3BhdHRlcm5fZhgFIAEoDRId",
+            "ChVpbmRpX3dhdmVfbnBjX3NwYXduZXIYBiABKA0SIgoaaW5kaV93YXZlX3Bp",
+            "Y2thYmxlX3NwYXduZXIYByABKA0SFwoPc3luY193YXZlX2dyb3VwGAggASgN",
+            "EhIKCnNhdmVfcG9pbnQYCSABKA0SDQoEbm9uZRiAECABKA0iuQEKDVBpY2th",
+            "YmxlVHlwZXMSEAoIaHBfc21hbGwYASABKA0SEAoIbXBfc21hbGwYAiABKA0S",
+            "GgoSaW52X2NfcmVmaWxsX3NtYWxsGAMgASgNEhoKEmludl9kX3JlZmlsbF9z",
+            "bWFsbBgEIAEoDRIXCg92ZWhpY2xlX3NlZGFuXzEYBSABKA0SDAoEY29pbhgG",
+            "IAEoDRIWCg5kcmFnb25fY3J5c3RhbBgHIAEoDRINCgRub25lGIAQIAEoDSJz",
+            "CgtBdGtFbGVUeXBlcxIMCgRmaXJlGAEgASgNEg0KBXdhdGVyGAIgASgNEg8K",
+            "B3RodW5kZXIYAyABKA0SDAoEcm9jaxgEIAEoDRIMCgR3aW5kGAUgASgNEgsK",
+            "A2ljZRgGIAEoDRINCgRub25lGIAQIAEoDSJ6Cg1EZWJ1ZmZTcGVjaWVzEhQK",
+            "DHNob3J0X2Zyb3plbhgBIAEoDRIXCg9zaG9ydF9wYXJhbHl6ZWQYAiABKA0S",
+            "EwoLbG9uZ19mcm96ZW4YAyABKA0SFgoObG9uZ19wYXJhbHl6ZWQYBCABKA0S",
+            "DQoEbm9uZRiAECABKA0i0TMKD1ByaW1pdGl2ZUNvbnN0cxIbChNiYXR0bGVf",
+            "ZHluYW1pY3NfZnBzGAEgASgFEjIKKmRlZmF1bHRfdGltZW91dF9mb3JfbGFz",
+            "dF9hbGxfY29uZmlybWVkX2lmZBgCIAEoBRIUCgxyb29tX2lkX25vbmUYAyAB",
+            "KAUSHQoVcm9vbV9zdGF0ZV9pbXBvc3NpYmxlGAQgASgFEhcKD3Jvb21fc3Rh",
+            "dGVfaWRsZRgFIAEoBRIaChJyb29tX3N0YXRlX3dhaXRpbmcYBiABKAUSGgoS",
+            "cm9vbV9zdGF0ZV9wcmVwYXJlGAcgASgFEhwKFHJvb21fc3RhdGVfaW5fYmF0",
+            "dGxlGAggASgFEiAKGHJvb21fc3RhdGVfaW5fc2V0dGxlbWVudBgJIAEoBRIa",
+            "ChJyb29tX3N0YXRlX3N0b3BwZWQYCiABKAUSMAoocm9vbV9zdGF0ZV9mcm9u",
+            "dGVuZF9hd2FpdGluZ19hdXRvX3Jlam9pbhgLIAEoBRIyCipyb29tX3N0YXRl",
+            "X2Zyb250ZW5kX2F3YWl0aW5nX21hbnVhbF9yZWpvaW4YDCABKAUSJQodcm9v",
+            "bV9zdGF0ZV9mcm9udGVuZF9yZWpvaW5pbmcYDSABKAUSJgoecGxheWVyX2Jh",
+            "dHRsZV9zdGF0ZV9pbXBvc3NpYmxlGA4gASgFEj0KNXBsYXllcl9iYXR0bGVf",
+            "c3RhdGVfYWRkZWRfcGVuZGluZ19iYXR0bGVfY29sbGlkZXJfYWNrGA8gASgF",
+            "EjgKMHBsYXllcl9iYXR0bGVfc3RhdGVfcmVhZGRlZF9wZW5kaW5nX2ZvcmNl",
+            "X3Jlc3luYxgQIAEoBRIiChpwbGF5ZXJfYmF0dGxlX3N0YXRlX2FjdGl2ZRgR",
+            "IAEoBRIoCiBwbGF5ZXJfYmF0dGxlX3N0YXRlX2Rpc2Nvbm5lY3RlZBgSIAEo",
+            "BRIgChhwbGF5ZXJfYmF0dGxlX3N0YXRlX2xvc3QYEyABKAUSMAoocGxheWVy",
+            "X2JhdHRsZV9zdGF0ZV9leHBlbGxlZF9kdXJpbmdfZ2FtZRgUIAEoBRIxCilw",
+            "bGF5ZXJfYmF0dGxlX3N0YXRlX2V4cGVsbGVkX2luX2Rpc21pc3NhbBgVIAEo",
+            "BRIqCiJ1cHN5bmNfbXNnX2FjdF9wbGF5ZXJfY29sbGlkZXJfYWNrGBYgASgF",
+            "EiEKGXVwc3luY19tc2dfYWN0X3BsYXllcl9jbWQYFyABKAUSMwordXBzeW5j",
+            "X21zZ19hY3RfaG9sZXB1bmNoX2JhY2tlbmRfdWRwX3R1bm5lbBgYIAEoBRIu",
+            "CiZ1cHN5bmNfbXNnX2FjdF9ob2xlcHVuY2hfcGVlcl91ZHBfYWRkchgZIAEo",
+            "BRItCiVkb3duc3luY19tc2dfYWN0X2JhdHRsZV9jb2xsaWRlcl9pbmZvGBog",
+            "ASgFEiQKHGRvd25zeW5jX21zZ19hY3RfaW5wdXRfYmF0Y2gYGyABKAUSJwof",
+            "ZG93bnN5bmNfbXNnX2FjdF9iYXR0bGVfc3RvcHBlZBgcIAEoBRImCh5kb3du",
+            "c3luY19tc2dfYWN0X2ZvcmNlZF9yZXN5bmMYHSABKAUSKQohZG93bnN5bmNf",
+            "bXNnX2FjdF9wZWVyX2lucHV0X2JhdGNoGB4gASgFEiYKHmRvd25zeW5jX21z",
+            "Z19hY3RfcGVlcl91ZHBfYWRkchgfIAEoBRIuCiZkb3duc3luY19tc2dfYWN0",
+            "X2JhdHRsZV9yZWFkeV90b19zdGFydBggIAEoBRIlCh1kb3duc3luY19tc2df",
+            "YWN0X2JhdHRsZV9zdGFydBghIAEoBRIsCiRkb3duc3luY19tc2dfYWN0X3Bs",
+            "YXllcl9kaXNjb25uZWN0ZWQYIiABKAUSMQopZG93bnN5bmNfbXNnX2FjdF9w",
+            "bGF5ZXJfcmVhZGRlZF9hbmRfYWNrZWQYIyABKAUSLwonZG93bnN5bmNfbXNn",
+            "X2FjdF9wbGF5ZXJfYWRkZWRfYW5kX2Fja2VkGCQgASgFEh4KFmRvd25zeW5j",
+            "X21zZ193c19jbG9zZWQYJSABKAUSHAoUZG93bnN5bmNfbXNnX3dzX29wZW4Y",
+            "JiABKAUSIAoYbWFnaWNfam9pbl9pbmRleF9pbnZhbGlkGCcgASgNEicKH21h",
+            "Z2ljX2pvaW5faW5kZXhfc3J2X3VkcF90dW5uZWwYKCABKA0SHAoUbWFnaWNf",
+            "cXVvdGFfaW5maW5pdGUYKSABKAUSMworbWFnaWNfbGFzdF9zZW50X2lucHV0",
+            "X2ZyYW1lX2lkX25vcm1hbF9hZGRlZBgrIAEoBRIuCiZtYWdpY19sYXN0X3Nl",
+            "bnRfaW5wdXRfZnJhbWVfaWRfcmVhZGRlZBgsIAEoBRIVCg1iZ21fbm9fY2hh",
+            "bmdlGC0gASgFEiEKGWludmFsaWRfZGVmYXVsdF9wbGF5ZXJfaWQYLiABKAkS",
+            "IQoZZXN0aW1hdGVkX3NlY29uZHNfcGVyX3JkZhgvIAEoAhIfChdtYXhfYnRu",
+            "X2hvbGRpbmdfcmRmX2NudBgwIAEoBRIaChJtYXhfZmx5aW5nX3JkZl9jbnQY",
+            "MSABKAUSLgombWF4X3JldmVyc2VfcHVzaGJhY2tfZnJhbWVzX3RvX3JlY292",
+            "ZXIYMiABKAUSLgomZGVmYXVsdF9zbGlwX2p1bXBfZ3JhY2VfcGVyaW9kX3Jk",
+            "Zl9jbnQYMyABKAUSKQohZGVmYXVsdF9taW5fc3BlZWRfZm9yX3Jlc3RpdHV0",
+            "aW9uGDQgASgCEiMKG3NwZWVkX25vdF9oaXRfbm90X3NwZWNpZmllZBg1IAEo",
+            "BRIlCh1kZWZhdWx0X3ByZWFsbG9jX25wY19jYXBhY2l0eRg2IAEoBRIoCiBk",
+            "ZWZhdWx0X3ByZWFsbG9jX2J1bGxldF9jYXBhY2l0eRg3IAEoBRImCh5kZWZh",
+            "dWx0X3ByZWFsbG9jX3RyYXBfY2FwYWNpdHkYOCABKAUSKQohZGVmYXVsdF9w",
+            "cmVhbGxvY190cmlnZ2VyX2NhcGFjaXR5GDkgASgFEioKImRlZmF1bHRfcHJl",
+            "YWxsb2NfcGlja2FibGVfY2FwYWNpdHkYOiABKAUSKwojZGVmYXVsdF9wZXJf",
+            "Y2hhcmFjdGVyX2J1ZmZfY2FwYWNpdHkYOyABKAUSLQolZGVmYXVsdF9wZXJf",
+            "Y2hhcmFjdGVyX2RlYnVmZl9jYXBhY2l0eRg8IAEoBRIwCihkZWZhdWx0X3Bl",
+            "cl9jaGFyYWN0ZXJfaW52ZW50b3J5X2NhcGFjaXR5GD0gASgFEjsKM2RlZmF1",
+            "bHRfcGVyX2NoYXJhY3Rlcl9pbW11bmVfYnVsbGV0X3JlY29yZF9jYXBhY2l0",
+            "eRg+IAEoBRIRCglncmF2aXR5X3kYPyABKAISHgoWZ3Jhdml0eV95X2p1bXBf",
+            "aG9sZGluZxhAIAEoAhIpCiFkZWZhdWx0X3BhdHJvbF9jdWVfd2FpdmluZ19m",
+            "cmFtZXMYQSABKAUSGAoQbm9fcGF0cm9sX2N1ZV9pZBhCIAEoBRIpCiFzdGlj",
+            "a190b19ncm91bmRfY29ycmVjdGlvbl9sZW5ndGgYQyABKAISLAokZGVmYXVs",
+            "dF9waWNrYWJsZV9odXJ0Ym94X2hhbGZfc2l6ZV94GEQgASgCEiwKJGRlZmF1",
+            "bHRfcGlja2FibGVfaHVydGJveF9oYWxmX3NpemVfeRhFIAEoAhIxCilkZWZh",
+            "dWx0X3BpY2thYmxlX2Rpc2FwcGVhcmluZ19hbmltX2ZyYW1lcxhGIAEoBRIt",
+            "CiVkZWZhdWx0X3BpY2thYmxlX2NvbnN1bWVkX2FuaW1fZnJhbWVzGEcgASgF",
+            "EiUKHWRlZmF1bHRfcGlja2FibGVfcmlzaW5nX3ZlbF95GEggASgCEicKH2Rl",
+            "ZmF1bHRfcGlja2FibGVfc3RhcnR1cF9mcmFtZXMYSSABKAUSKQohZGVmYXVs",
+            "dF9waWNrYWJsZV9saWZldGltZV9yZGZfY250GEogASgFEiEKGWRlZmF1bHRf",
+            "YmxvY2tfc3R1bl9mcmFtZXMYTCABKAUSKQohZGVmYXVsdF9ibG93bnVwX2Zy",
+            "YW1lc19mb3JfZmx5aW5nGE0gASgFEiAKGGRlZmF1bHRfZ2F1Z2VfaW5jX2J5",
+            "X2hpdBhOIAEoBRIwCihkZWZhdWx0X2ZyYW1lc19kZWxheWVkX29mX2Jvc3Nf",
+            "c2F2ZXBvaW50GE8gASgFEhoKEmlucHV0X3NjYWxlX2ZyYW1lcxhQIAEoBRIT",
+            "CgtpbnB1dF9zY2FsZRhRIAEoBRIaChJpbnB1dF9kZWxheV9mcmFtZXMYUiAB",
+            "KAUSKQohZGVmYXVsdF9iYWNrZW5kX2lucHV0X2J1ZmZlcl9zaXplGFMgASgF",
+            "EiwKJG1heF9jaGFzaW5nX3JlbmRlcl9mcmFtZXNfcGVyX3VwZGF0ZRhUIAEo",
+            "BRIiChptYWdpY19mcmFtZXNfdG9fYmVfb25fd2FsbBhVIAEoBRIrCiNtYWdp",
+            "Y19mcmFtZXNfdG9fYmVfb25fd2FsbF9haXJfanVtcBhWIAEoBRIfChdkeWlu",
+            "Z19mcmFtZXNfdG9fcmVjb3ZlchhXIAEoBRIhChlwYXJyaWVkX2ZyYW1lc190",
+            "b19yZWNvdmVyGFggASgFEisKI3BhcnJpZWRfZnJhbWVzX3RvX3N0YXJ0X2Nh",
+            "bmNlbGxhYmxlGFkgASgFEhAKCG5vX3NraWxsGFogASgNEhQKDG5vX3NraWxs",
+            "X2hpdBhbIAEoBRIiChp1cHN5bmNfc3RfaWZkX2lkX3RvbGVyYW5jZRhdIAEo",
+            "DRITCgtub19sb2NrX3ZlbBheIAEoAhIsCiRjcm91Y2hfZm9yY2luZ19jZWls",
+            "aW5nX2RvdF90aHJlc2hvbGQYXyABKAISIwobdGVybWluYXRpbmdfcmVuZGVy",
+            "X2ZyYW1lX2lkGGAgASgFEiIKGnRlcm1pbmF0aW5nX2lucHV0X2ZyYW1lX2lk",
+            "GGEgASgFEiAKGHRlcm1pbmF0aW5nX2NoYXJhY3Rlcl9pZBhiIAEoDRIbChN0",
+            "ZXJtaW5hdGluZ190cmFwX2lkGGMgASgNEh4KFnRlcm1pbmF0aW5nX3RyaWdn",
+            "ZXJfaWQYZCABKA0SJAocdGVybWluYXRpbmdfdHJpZ2dlcl9ncm91cF9pZBhl",
+            "IAEoDRIfChd0ZXJtaW5hdGluZ19waWNrYWJsZV9pZBhmIAEoDRIdChV0ZXJt",
+            "aW5hdGluZ19idWxsZXRfaWQYZyABKA0SIgoadGVybWluYXRpbmdfYnVsbGV0",
+            "X3RlYW1faWQYaCABKAUSIwobdGVybWluYXRpbmdfYnVmZl9zcGVjaWVzX2lk",
+            "GGkgASgNEiUKHXRlcm1pbmF0aW5nX2RlYnVmZl9zcGVjaWVzX2lkGGogASgN",
+            "EikKIXRlcm1pbmF0aW5nX2NvbnN1bWFibGVfc3BlY2llc19pZBhrIAEoDRIj",
+            "Chtmcm9udGVuZF93c19yZWN2X2J5dGVsZW5ndGgYbCABKAUSIgoaYmFja2Vu",
+            "ZF93c19yZWN2X2J5dGVsZW5ndGgYbSABKAUSIgoaamFtbWVkX2J0bl9ob2xk",
+            "aW5nX3JkZl9jbnQYbiABKAUSKQohYnRuX2JfaG9sZGluZ19yZGZfY250X3Ro",
+            "cmVzaG9sZF8yGG8gASgFEikKIWJ0bl9iX2hvbGRpbmdfcmRmX2NudF90aHJl",
+            "c2hvbGRfMRhwIAEoBRIoCiBqdW1wX2hvbGRpbmdfcmRmX2NudF90aHJlc2hv",
+            "bGRfMRhxIAEoBRIoCiBqdW1wX2hvbGRpbmdfaWZkX2NudF90aHJlc2hvbGRf",
+            "MRhyIAEoBRIoCiBqdW1wX2hvbGRpbmdfcmRmX2NudF90aHJlc2hvbGRfMhhz",
+            "IAEoBRIoCiBqdW1wX2hvbGRpbmdfaWZkX2NudF90aHJlc2hvbGRfMhh0IAEo",
+            "BRIoCiBpbl9haXJfZGFzaF9ncmFjZV9wZXJpb2RfcmRmX2NudBh1IAEoBRIo",
+            "CiBpbl9haXJfanVtcF9ncmFjZV9wZXJpb2RfcmRmX2NudBh2IAEoBRIpCiFi",
+            "dG5fZV9ob2xkaW5nX3JkZl9jbnRfdGhyZXNob2xkXzEYdyABKAUSKQohYnRu",
+            "X2VfaG9sZGluZ19pZmRfY250X3RocmVzaG9sZF8xGHggASgFEh8KF3BhdHRl",
+            "cm5faWRfdW5hYmxlX3RvX29wGHkgASgFEhgKEHBhdHRlcm5faWRfbm9fb3AY",
+            "eiABKAUSEQoJcGF0dGVybl9iGHsgASgFEhQKDHBhdHRlcm5fdXBfYhh8IAEo",
+            "BRIWCg5wYXR0ZXJuX2Rvd25fYhh9IAEoBRIWCg5wYXR0ZXJuX2hvbGRfYhh+",
+            "IAEoBRIWCg5wYXR0ZXJuX2Rvd25fYRh/IAEoBRIbChJwYXR0ZXJuX3JlbGVh",
+            "c2VkX2IYgAEgASgFEhIKCXBhdHRlcm5fZRiBASABKAUSGAoPcGF0dGVybl9m",
+            "cm9udF9lGIIBIAEoBRIXCg5wYXR0ZXJuX2JhY2tfZRiDASABKAUSFQoMcGF0",
+            "dGVybl91cF9lGIQBIAEoBRIXCg5wYXR0ZXJuX2Rvd25fZRiFASABKAUSFwoO",
+            "cGF0dGVybl9ob2xkX2UYhgEgASgFEhkKEHBhdHRlcm5fZV9ob2xkX2IYhwEg",
+            "ASgFEh8KFnBhdHRlcm5fZnJvbnRfZV9ob2xkX2IYiAEgASgFEh4KFXBhdHRl",
+            "cm5fYmFja19lX2hvbGRfYhiJASABKAUSHAoTcGF0dGVybl91cF9lX2hvbGRf",
+            "YhiKASABKAUSHgoVcGF0dGVybl9kb3duX2VfaG9sZF9iGIsBIAEoBRIeChVw",
+            "YXR0ZXJuX2hvbGRfZV9ob2xkX2IYjAEgASgFEiEKGHBhdHRlcm5faW52ZW50",
+            "b3J5X3Nsb3RfYxiNASABKAUSIQoYcGF0dGVybl9pbnZlbnRvcnlfc2xvdF9k",
+            "GI4BIAEoBRIiChlwYXR0ZXJuX2ludmVudG9yeV9zbG90X2JjGI8BIAEoBRIm",
+            "Ch1wYXR0ZXJuX2hvbGRfaW52ZW50b3J5X3Nsb3RfYxiQASABKAUSJgodcGF0",
+            "dGVybl9ob2xkX2ludmVudG9yeV9zbG90X2QYkQEgASgFEhIKCXBhdHRlcm5f",
+            "ZhiSASABKAUSEgoJcGF0dGVybl9sGJMBIAEoBRISCglwYXR0ZXJuX3IYlAEg",
+            "ASgFEiMKGmRlZmF1bHRfYWlyX2xpbmVhcl9kYW1waW5nGJUBIAEoAhIZChBi",
+            "YXVtZ2FydGVfZmFjdG9yGJYBIAEoAhIZChBwZW5ldHJhdGlvbl9zbG9wGJcB",
+            "IAEoAhIhChhtYXhfcGVuZXRyYXRpb25fZGlzdGFuY2UYmAEgASgCEiMKGmVs",
+            "ZV93ZWFrbmVzc19kZWZhdWx0X3lpZWxkGJoBIAEoAhIlChxlbGVfcmVzaXN0",
+            "YW5jZV9kZWZhdWx0X3lpZWxkGJsBIAEoAhIhChhzdGFydGluZ19yZW5kZXJf",
+            "ZnJhbWVfaWQYnAEgASgFEiAKF3N0YXJ0aW5nX2lucHV0X2ZyYW1lX2lkGJ0B",
+            "IAEoBRIcChNkZWZhdWx0X2NoX2ZyaWN0aW9uGJ4BIAEoAhIfChZkZWZhdWx0",
+            "X2NoX3Jlc3RpdHV0aW9uGJ8BIAEoAhIjChpncm91bmRfZGFzaGluZ19jaF9m",
+            "cmljdGlvbhigASABKAISHgoVYW50aV9wdXNoX2NoX2ZyaWN0aW9uGKEBIAEo",
+            "AhIhChh3YWxrc3RvcHBpbmdfY2hfZnJpY3Rpb24YogEgASgCEiEKGGZhbGxz",
+            "dG9wcGluZ19jaF9mcmljdGlvbhijASABKAISIQoYZGVmYXVsdF9iYXJyaWVy",
+            "X2ZyaWN0aW9uGKQBIAEoAhIkChtkZWZhdWx0X2JhcnJpZXJfcmVzdGl0dXRp",
+            "b24YpQEgASgCEiAKF2RlZmF1bHRfYnVsbGV0X2ZyaWN0aW9uGKYBIAEoAhIj",
+            "ChpkZWZhdWx0X2J1bGxldF9yZXN0aXR1dGlvbhinASABKAISIgoZc3RhaXJz",
+            "X3BfdGVycmFpbl9wcmlvcml0eRioASABKAISJwoecmVndWxhcl9zbG9wZV90",
+            "ZXJyYWluX3ByaW9yaXR5GKkBIAEoAhIdChRzcF9hdGtfbG9va3VwX2ZyYW1l",
+            "cxiACCABKAUSIwoaZGVidWZmX2FycmF5X2lkeF9lbGVtZW50YWwYgQggASgF",
+            "EicKHnRlcm1pbmF0aW5nX2xvd2VyX3BhcnRfcmRmX2NudBiCCCABKAUSIwoa",
+            "ZGVmYXVsdF90cl9yZWNvdmVyeV9mcmFtZXMYgwggASgFEi0KJGRlZmF1bHRf",
+            "ZmxlZWluZ19ncmFjZV9wZXJpb2RfcmRmX2NudBiECCABKAUSJwoeZGVmYXVs",
+            "dF9mcmFtZXNfdG9fc2hvd19kYW1hZ2VkGIUIIAEoBRIpCiBkZWZhdWx0X2Zy",
+            "YW1lc190b19jb250aW51ZV9jb21ibxiGCCABKAUSLgoKY2hfc3BlY2llcxiA",
+            "ECABKAsyGS5qdHNoYXJlZC5DaFNwZWNpZXNDb25zdHMSIgoEdHB0cxiBECAB",
+            "KAsyEy5qdHNoYXJlZC5UcmFwVHlwZXMSJQoEdHJ0cxiCECABKAsyFi5qdHNo",
+            "YXJlZC5UcmlnZ2VyVHlwZXMSJgoEcGt0cxiDECABKAsyFy5qdHNoYXJlZC5Q",
+            "aWNrYWJsZVR5cGVzEiUKBWVsZXRzGIQQIAEoCzIVLmp0c2hhcmVkLkF0a0Vs",
+            "ZVR5cGVzEjAKDmRlYnVmZl9zcGVjaWVzGIUQIAEoCzIXLmp0c2hhcmVkLkRl",
+            "YnVmZlNwZWNpZXMiigEKCUFpbWluZ1JheRITCgtvZmZlbmRlcl91ZBgBIAEo",
+            "BBIUCgxvZmZlbmRlcl91ZHQYAiABKAQSDAoEc3RfeBgDIAEoAhIMCgRzdF95",
+            "GAQgASgCEgwKBHN0X3oYBSABKAISDAoEZWRfeBgGIAEoAhIMCgRlZF95GAcg",
+            "ASgCEgwKBGVkX3oYCCABKAIigwgKDENvbmZpZ0NvbnN0cxJHChFjaGFyYWN0",
+            "ZXJfY29uZmlncxgBIAMoCzIsLmp0c2hhcmVkLkNvbmZpZ0NvbnN0cy5DaGFy",
+            "YWN0ZXJDb25maWdzRW50cnkSPwoNc2tpbGxfY29uZmlncxgCIAMoCzIoLmp0",
+            "c2hhcmVkLkNvbmZpZ0NvbnN0cy5Ta2lsbENvbmZpZ3NFbnRyeRI9CgxidWZm",
+            "X2NvbmZpZ3MYAyADKAsyJy5qdHNoYXJlZC5Db25maWdDb25zdHMuQnVmZkNv",
+            "bmZpZ3NFbnRyeRJBCg5kZWJ1ZmZfY29uZmlncxgEIAMoCzIpLmp0c2hhcmVk",
+            "LkNvbmZpZ0NvbnN0cy5EZWJ1ZmZDb25maWdzRW50cnkSPQoMdHJhcF9jb25m",
+            "aWdzGAUgAygLMicuanRzaGFyZWQuQ29uZmlnQ29uc3RzLlRyYXBDb25maWdz",
+            "RW50cnkSQwoPdHJpZ2dlcl9jb25maWdzGAYgAygLMiouanRzaGFyZWQuQ29u",
+            "ZmlnQ29uc3RzLlRyaWdnZXJDb25maWdzRW50cnkSRQoQcGlja2FibGVfY29u",
+            "ZmlncxgHIAMoCzIrLmp0c2hhcmVkLkNvbmZpZ0NvbnN0cy5QaWNrYWJsZUNv",
+            "bmZpZ3NFbnRyeRpSChVDaGFyYWN0ZXJDb25maWdzRW50cnkSCwoDa2V5GAEg",
+            "ASgNEigKBXZhbHVlGAIgASgLMhkuanRzaGFyZWQuQ2hhcmFjdGVyQ29uZmln",
+            "OgI4ARpEChFTa2lsbENvbmZpZ3NFbnRyeRILCgNrZXkYASABKA0SHgoFdmFs",
+            "dWUYAiABKAsyDy5qdHNoYXJlZC5Ta2lsbDoCOAEaSAoQQnVmZkNvbmZpZ3NF",
+            "bnRyeRILCgNrZXkYASABKA0SIwoFdmFsdWUYAiABKAsyFC5qdHNoYXJlZC5C",
+            "dWZmQ29uZmlnOgI4ARpMChJEZWJ1ZmZDb25maWdzRW50cnkSCwoDa2V5GAEg",
+            "ASgNEiUKBXZhbHVlGAIgASgLMhYuanRzaGFyZWQuRGVidWZmQ29uZmlnOgI4",
+            "ARpIChBUcmFwQ29uZmlnc0VudHJ5EgsKA2tleRgBIAEoDRIjCgV2YWx1ZRgC",
+            "IAEoCzIULmp0c2hhcmVkLlRyYXBDb25maWc6AjgBGk4KE1RyaWdnZXJDb25m",
+            "aWdzRW50cnkSCwoDa2V5GAEgASgNEiYKBXZhbHVlGAIgASgLMhcuanRzaGFy",
+            "ZWQuVHJpZ2dlckNvbmZpZzoCOAEaUAoUUGlja2FibGVDb25maWdzRW50cnkS",
+            "CwoDa2V5GAEgASgNEicKBXZhbHVlGAIgASgLMhguanRzaGFyZWQuUGlja2Fi",
+            "bGVDb25maWc6AjgBKjQKFEJveEludGVycG9sYXRpb25UeXBlEgsKB1VzZVBy",
+            "ZXYQABIPCgtJbnRlcnBvbGF0ZRABKlUKCElmYWNlQ2F0EgkKBUVNUFRZEAAS",
+            "CQoFRkxFU0gQARIJCgVNRVRBTBACEgkKBUZMVUlEEAMSCAoEUk9DSxAEEgkK",
+            "BUdSQVNTEAUSCAoEV09PRBAGKj4KC0J1bGxldFN0YXRlEgsKB1N0YXJ0VXAQ",
+            "ABIKCgZBY3RpdmUQARINCglWYW5pc2hpbmcQAhIHCgNIaXQQAyrZCAoOQ2hh",
+            "cmFjdGVyU3RhdGUSEgoOSW52YWxpZENoU3RhdGUQABIJCgVJZGxlMRABEgsK",
+            "B1dhbGtpbmcQAhIOCgpUdXJuQXJvdW5kEAMSCgoGQXRrZWQxEAQSFAoQSW5B",
+            "aXJJZGxlMU5vSnVtcBAFEhQKEEluQWlySWRsZTFCeUp1bXAQBhIUChBJbkFp",
+            "cklkbGUyQnlKdW1wEAcSGAoUSW5BaXJJZGxlMUJ5V2FsbEp1bXAQCBIPCgtJ",
+            "bkFpckF0a2VkMRAJEgwKCEJsb3duVXAxEAoSDAoITGF5RG93bjEQCxIKCgZH",
+            "ZXRVcDEQDBIJCgVEeWluZxANEgsKB0Rhc2hpbmcQDhILCgdTbGlkaW5nEA8S",
+            "CgoGRGltbWVkEBASFAoQVHJhbnNmb3JtaW5nSW50bxAREg8KC0JhY2tEYXNo",
+            "aW5nEBISEAoMSW5BaXJXYWxraW5nEBMSHQoZVHJhbnNmb3JtaW5nSW50b0Zy",
+            "b21EZWF0aBAUEhAKDEZhbGxTdG9wcGluZxAVEgsKB1BhcnJpZWQQFxILCgdB",
+            "d2FraW5nEBgSEAoMR3JvdW5kRG9kZ2VkEBkSDwoLQmFja1dhbGtpbmcQGhIQ",
+            "CgxJbkFpckRhc2hpbmcQGxIUChBJbkFpckJhY2tEYXNoaW5nEBwSEwoPSW5B",
+            "aXJUdXJuQXJvdW5kEB0SGAoUSW5BaXJJZGxlMUJ5U2xpcEp1bXAQHhIQCgtP",
+            "bldhbGxJZGxlMRCAARIQCgtDcm91Y2hJZGxlMRCAAhIPCgpDcm91Y2hBdGsx",
+            "EIECEhIKDUNyb3VjaFdhbGtpbmcQggISEQoMQ3JvdWNoQXRrZWQxEIMCEgkK",
+            "BERlZjEQhAISDwoKRGVmMUF0a2VkMRCFAhIPCgpEZWYxQnJva2VuEIYCEgkK",
+            "BEF0azEQgAgSCQoEQXRrMhCBCBIJCgRBdGszEIIIEgkKBEF0azQQgwgSCQoE",
+            "QXRrNRCECBIJCgRBdGs2EIUIEgkKBEF0azcQhggSEgoNQXRrN19DaGFyZ2lu",
+            "ZxCHCBIXChJBdGs3X0NoYXJnZVJlbGVhc2UQiAgSCQoEQXRrOBCJCBIOCglJ",
+            "bkFpckF0azEQgBASDgoJSW5BaXJBdGsyEIEQEg4KCUluQWlyQXRrNhCCEBIQ",
+            "CgtXYWxraW5nQXRrMRCDEBIQCgtXYWxraW5nQXRrNBCEEBIVChBJbkFpcldh",
+            "bGtpbmdBdGsxEIUQEhUKEEluQWlyV2Fsa2luZ0F0azQQhhASDwoKT25XYWxs",
+            "QXRrMRCAGBISCg1BdGsxX0NoYXJnaW5nEIEYEhkKFFdhbGtpbmdBdGsxX0No",
+            "YXJnaW5nEIIYEh4KGUluQWlyV2Fsa2luZ0F0azFfQ2hhcmdpbmcQgxgSFwoS",
+            "SW5BaXJBdGsxX0NoYXJnaW5nEIQYEhgKE09uV2FsbEF0azFfQ2hhcmdpbmcQ",
+            "hRgSGAoTQ3JvdWNoQXRrMV9DaGFyZ2luZxCGGCrhAQoHTnBjR29hbBIJCgVO",
+            "SWRsZRAAEg8KC05Gb2xsb3dBbGx5EAESCwoHTlBhdHJvbBACEhEKDU5IdW50",
+            "VGhlbklkbGUQAxITCg9OSHVudFRoZW5QYXRyb2wQBBIXChNOSHVudFRoZW5G",
+            "b2xsb3dBbGx5EAUSHgoaTklkbGVJZkdvSHVudGluZ1RoZW5QYXRyb2wQBhIP",
+            "CgtOUGF0aFBhdHJvbBAHEhcKE05IdW50VGhlblBhdGhQYXRyb2wQCBIiCh5O",
+            "SWRsZUlmR29IdW50aW5nVGhlblBhdGhQYXRyb2wQCSpfCglUcmFwU3RhdGUS",
+            "CgoGVHBJZGxlEAASDQoJVHBXYWxraW5nEAESCgoGVHBBdGsxEAISDAoIVHBB",
+            "dGtlZDEQAxIRCg1UcERlYWN0aXZhdGVkEAQSCgoGVHBEZWFkEAUq3QEKDFRy",
+            "aWdnZXJTdGF0ZRILCgdUclJlYWR5EAASEwoPVHJTdWJDeWNsZVJlYWR5EAES",
+            "GQoVVHJTdWJDeWNsZUNvb2xpbmdEb3duEAISGAoUVHJTdWJDeWNsZUNvb2xl",
+            "ZERvd24QAxIXChNUclN1YkN5Y2xlRXhoYXVzdGVkEAQSEQoNVHJDb29saW5n",
+            "RG93bhAFEhAKDFRyQ29vbGVkRG93bhAGEg8KC1RyRXhoYXVzdGVkEAcSCgoG",
+            "VHJEZWFkEAgSGwoXVHJFeGhhdXN0ZWRZZXRMaXN0ZW5pbmcQCSo8Cg1QaWNr",
+            "YWJsZVN0YXRlEgkKBVBJZGxlEAASEQoNUERpc2FwcGVhcmluZxABEg0KCVBD",
+            "b25zdW1lZBACKksKGVNwZWNpYWxNb3ZlT3ZlcnJpZGVTdGF0dXMSDAoIU211",
+            "c0tlZXAQABIOCgpTbXVzTG9ja2VkEAESEAoMU211c1VubG9ja2VkEAIqhwEK",
+            "CkJ1bGxldFR5cGUSEAoMVW5kZXRlcm1pbmVkEAASCQoFTWVsZWUQARIXChNN",
+            "ZWNoYW5pY2FsQ2FydHJpZGdlEAISHgoaTWVjaGFuaWNhbEJvdW5jZXJTcGhl",
+            "cmljYWwQAxITCg9NYWdpY2FsRmlyZWJhbGwQBBIOCgpHcm91bmRXYXZlEAUq",
+            "5gEKDE11bHRpSGl0VHlwZRIICgROb25lEAASEAoMRnJvbUVtaXNzaW9uEAES",
+            "FgoSRnJvbUZpcnN0SGl0QWN0dWFsEAISFgoSRnJvbUZpcnN0SGl0QW55d2F5",
+            "EAMSFQoRRnJvbVByZXZIaXRBY3R1YWwQBBIVChFGcm9tUHJldkhpdEFueXdh",
+            "eRAFEhsKF0Zyb21WaXNpb25TZWVrT3JEZWZhdWx0EAYSIwofRnJvbVByZXZI",
+            "aXRBY3R1YWxPckFjdGl2ZVRpbWVVcBAHEhoKFkZyb21FbWlzc2lvbkp1c3RB",
+            "Y3RpdmUQCCoyCg9Ta2lsbEludm9jYXRpb24SDgoKUmlzaW5nRWRnZRAAEg8K",
+            "C0ZhbGxpbmdFZGdlEAEqLAoPVmZ4RHVyYXRpb25UeXBlEgoKBk9uZU9mZhAA",
+            "Eg0KCVJlcGVhdGluZxABKjcKDVZmeE1vdGlvblR5cGUSDAoITm9Nb3Rpb24Q",
+            "ABILCgdEcm9wcGVkEAESCwoHVHJhY2luZxACKkoKGk92ZXJyaWRlT2JzSWZh",
+            "Y2VCb2R5T3B0aW9uEg0KCU9PSUJPS2VlcBAAEg0KCU9PSUJPVHJ1ZRABEg4K",
+            "Ck9PSUJPRmFsc2UQAiqBAQoJVXBzeW5jQWN0EgsKB1VBX05PTkUQABIKCgZV",
+            "QV9DTUQQARIWChJVQV9TRUxGX1BBUlNFRF9SREYQAhIjCh9VQV9IT0xFUFVO",
+            "Q0hfQkFDS0VORF9VRFBfVFVOTkVMEAMSHgoaVUFfSE9MRVBVTkNIX1BFRVJf",
+            "VURQX0FERFIQBCr/AwoLRG93bnN5bmNBY3QSCwoHREFfTk9ORRAAEg4KCkRB",
+            "X1JFR1VMQVIQARIVChFEQV9CQVRUTEVfUFJFUEFSRRACEhwKGERBX0JBVFRM",
+            "RV9SRUFEWV9UT19TVEFSVBADEhUKEURBX0JBVFRMRV9TVEFSVEVEEAQSFQoR",
+            "REFfQkFUVExFX1NUT1BQRUQQBRIbChdEQV9CQVRUTEVfUEVFUl9VRFBfQURE",
+            "UhAGEh8KG0RBX0JBVFRMRV9QRUVSX0RJU0NPTk5FQ1RFRBAHEhkKFURBX0JB",
+            "VFRMRV9QRUVSX0pPSU5FRBAIEhsKF0RBX0JBVFRMRV9QRUVSX1JFSk9JTkVE",
+            "EAkSKQolREFfRkFJTEVEX1RPX0pPSU5fQkFUVExFX05PVF9KT0lOQUJMRRAK",
+            "EiUKIURBX0ZBSUxFRF9UT19KT0lOX0FMUkVBRFlfSU5fUk9PTRALEi0KKURB",
+            "X0ZBSUxFRF9UT19SRUpPSU5fQkFUVExFX05PVF9SRUpPSU5BQkxFEAwSKQol",
+            "REFfRkFJTEVEX1RPX1JFSk9JTl9OT1RfRk9VTkRfSU5fUk9PTRANEiwKKERB",
+            "X0ZBSUxFRF9UT19SRUpPSU5fUExBWUVSX1NUQVRFX0lOVkFMSUQQDhIOCgpE",
+            "QV9XU19PUEVOEEASEAoMREFfV1NfQ0xPU0VEEEEqMQoNQnVmZlN0b2NrVHlw",
+            "ZRIKCgZOb25lQmYQABIJCgVUaW1lZBABEgkKBVF1b3RhEAIqcQoKRGVidWZm",
+            "VHlwZRILCgdOb25lRGJmEAASEQoNU3BlZWREb3duT25seRABEhEKDUNvbGRT",
+            "cGVlZERvd24QAhIWChJQb3NpdGlvbkxvY2tlZE9ubHkQAxIYChRGcm96ZW5Q",
+            "b3NpdGlvbkxvY2tlZBAEKoQBChZJbnZlbnRvcnlTbG90U3RvY2tUeXBlEgoK",
+            "Bk5vbmVJdhAAEgsKB0R1bW15SXYQARIMCghQb2NrZXRJdhACEgsKB1RpbWVk",
+            "SXYQAxILCgdRdW90YUl2EAQSEwoPVGltZWRNYWdhemluZUl2EAUSFAoQR2F1",
+            "Z2VkTWFnYXppbmVJdhAGKjwKGVBsYXllclN0b3J5TW9kZVNlbGVjdFZpZXcS",
+            "CAoETk9ORRAAEgoKBlJFR0lPThABEgkKBUxFVkVMEAIqNQoQRmluaXNoZWRM",
+            "dk9wdGlvbhINCglCT1NTX09OTFkQABISCg5TVE9SWV9BTkRfQk9TUxABQhBI",
+            "A/gBAaoCCGp0c2hhcmVkYgZwcm90bzM="));
       descriptor = pbr::FileDescriptor.FromGeneratedCode(descriptorData,
           new pbr::FileDescriptor[] { },
           new pbr::GeneratedClrTypeInfo(new[] {typeof(global::jtshared.BoxInterpolationType), typeof(global::jtshared.IfaceCat), typeof(global::jtshared.BulletState), typeof(global::jtshared.CharacterState), typeof(global::jtshared.NpcGoal), typeof(global::jtshared.TrapState), typeof(global::jtshared.TriggerState), typeof(global::jtshared.PickableState), typeof(global::jtshared.SpecialMoveOverrideStatus), typeof(global::jtshared.BulletType), typeof(global::jtshared.MultiHitType), typeof(global::jtshared.SkillInvocation), typeof(global::jtshared.VfxDurationType), typeof(global::jtshared.VfxMotionType), typeof(global::jtshared.OverrideObsIfaceBodyOption), typeof(global::jtshared.UpsyncAct), typeof(global::jtshared.DownsyncAct), typeof(global::jtshared.BuffStockType), typeof(global::jtshared.DebuffType), typeof(global::jtshared.InventorySlotStockType), typeof(global::jtshared.PlayerStoryModeSelectView), typeof(global::jtshared.FinishedLvOption), }, null, new pbr::GeneratedClrTypeInfo[] {
@@ -893,7 +910,7 @@ namespace jtshared {
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.PlayerCharacterDownsync), global::jtshared.PlayerCharacterDownsync.Parser, new[]{ "Chd", "JoinIndex", "BeatsCnt", "BeatenCnt", "RevivalX", "RevivalY", "RevivalZ", "RevivalQX", "RevivalQY", "RevivalQZ", "RevivalQW", "NotEnoughMpHintRdfCountdown", "CachedCueCmd", "GoalAsNpc" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.NpcCharacterDownsync), global::jtshared.NpcCharacterDownsync.Parser, new[]{ "Chd", "Id", "ActivatedRdfId", "CachedCueCmd", "LastFledRdfId", "GoalAsNpc", "PublishingMaskUponExhausted", "PublishingToTriggerIdUponExhausted", "SubscribesToTriggerId", "CapturedByPatrolCue", "FramesInPatrolCue", "ExhaustedToDropPkt", "IsMainTowerOfTeam", "WaivingPatrolCueId" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.InputFrameDecoded), global::jtshared.InputFrameDecoded.Parser, new[]{ "Dx", "Dy", "BtnALevel", "BtnBLevel", "BtnCLevel", "BtnDLevel", "BtnELevel", "BtnFLevel", "BtnLLevel", "BtnRLevel" }, null, null, null, null),
-            new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.UpsyncSnapshot), global::jtshared.UpsyncSnapshot.Parser, new[]{ "StIfdId", "CmdList" }, null, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.UpsyncSnapshot), global::jtshared.UpsyncSnapshot.Parser, new[]{ "StIfdId", "CmdList", "AckedRefRdfId", "ChecksumRdfId", "Checksum" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.WsReq), global::jtshared.WsReq.Parser, new[]{ "SeqNo", "JoinIndex", "Act", "AuthKey", "UpsyncSnapshot", "SelfParsedRdf", "BattleDurationSeconds", "SerializedBarriers", "PreallocateNpcSpeciesDict", "TrapConfigFromTileList", "TriggerConfigFromTileList", "PickableConfigFromTileList", "FallenDeathHeight", "BattleSpecificConfig" }, null, null, null, new pbr::GeneratedClrTypeInfo[] { null, }),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.PatrolCue), global::jtshared.PatrolCue.Parser, new[]{ "Id", "FlAct", "FrAct", "FlCaptureFrames", "FrCaptureFrames", "FdAct", "FuAct", "FdCaptureFrames", "FuCaptureFrames", "CollisionTypeMask" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.BulletConfig), global::jtshared.BulletConfig.Parser, new[]{ "StartupFrames", "StartupInvinsibleFrames", "CancellableStFrame", "CancellableEdFrame", "ActiveFrames", "CooldownFrames", "HitStunFrames", "BlockStunFrames", "PushbackVelX", "PushbackVelY", "Damage", "SelfLockVelX", "SelfLockVelY", "SelfLockVelYWhenFlying", "HitboxOffsetX", "HitboxOffsetY", "HitboxHalfSizeX", "HitboxHalfSizeY", "MeleeHitSelfStunFrames", "ActiveAnimLoopingRdfOffset", "VanishingAnimRdfCnt", "VanishingAnimLoopingRdfOffset", "HitAnimRdfCnt", "BType", "MhType", "SimultaneousMultiHitCnt", "Speed", "SpeedIfNotHit", "Hardness", "HitInvinsibleFrames", "PerpAccMag", "DelaySelfVelToActive", "HitOnMultiContact", "OmitSoftPushback", "RemainsUponHit", "RenderRotationAlongVelocity", "BlowUp", "RepeatQuota", "MhVanishOnMeleeHit", "MhUpdatesOriginPos", "BeamCollision", "ForAlly", "HitboxSizeIncX", "HitboxSizeIncY", "AllowsWalking", "AllowsCrouching", "ElementalAttrs", "BeamVisualSizeY", "TouchHitBombCollision", "AirRidingGroundWave", "GroundImpactMeleeCollision", "WallImpactMeleeCollision", "MhInheritsSpin", "InitQ", "Friction", "Restitution", "GravityFactor", "NoHitAnim", "Ifc", "ReflectFireballXIfNotHarder", "RejectReflectionFromAnotherBullet", "ProvidesXHardPushback", "ProvidesYHardPushbackTop", "ProvidesYHardPushbackBottom", "IgnoreSlopeDeceleration", "RotateOffenderWithSpin", "MhNotTriggerOnChHit", "MhNotTriggerOnHarderBulletHit", "MhNotTriggerOnHardPushbackHit", "HopperMissile", "BeamRendering", "MissileSearchIntervalPow2Minus1", "UseChOffsetRegardlessOfEmissionMh", "GaugeIncReductionRatio", "MhInheritsFramesInBlState", "GuardBreakerExtraHitCnt", "FinishingFrames", "NoVanishAnimOnHardPushback", "CollisionTypeMask", "TakesGravity", "BuffConfig", "CancelTransit", "CharacterEmitSfxName", "FireballEmitSfxName", "HitSfxName", "ActiveSfxName", "HitOnFleshSfxName", "HitOnRockSfxName", "HitOnMetalSfxName", "HitOnWoodSfxName", "AnimName" }, new[]{ "InitQ", "Friction", "Restitution", "GravityFactor" }, null, null, new pbr::GeneratedClrTypeInfo[] { null, }),
@@ -905,12 +922,14 @@ namespace jtshared {
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.PeerUdpAddr), global::jtshared.PeerUdpAddr.Parser, new[]{ "Ip", "Port", "AuthKey", "SeqNo" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.SteamBinding), global::jtshared.SteamBinding.Parser, new[]{ "UlSteamId", "ChSpeciesId" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.StepResult), global::jtshared.StepResult.Parser, new[]{ "AimingRays", "AimingRayCount", "FulfilledTriggers", "FulfilledTriggerIds", "FulfilledTriggerGroupIds", "PreparedTriggerUds" }, null, null, null, new pbr::GeneratedClrTypeInfo[] { null, null, }),
-            new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.RenderFrame), global::jtshared.RenderFrame.Parser, new[]{ "Id", "Players", "CountdownNanos", "Bullets", "Npcs", "DynamicTraps", "Triggers", "Pickables", "BulletIdCounter", "BulletCount", "NpcIdCounter", "NpcCount", "TriggerCount", "PickableIdCounter", "PickableCount", "DynamicTrapCount" }, null, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.RenderFrame), global::jtshared.RenderFrame.Parser, new[]{ "Id", "Players", "CountdownNanos", "Bullets", "Npcs", "DynamicTraps", "Triggers", "Pickables", "BulletIdCounter", "BulletCount", "NpcIdCounter", "NpcCount", "TriggerCount", "PickableIdCounter", "PickableCount", "DynamicTrapCount", "Checksum" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.BattlePrepareInfo), global::jtshared.BattlePrepareInfo.Parser, new[]{ "StageName", "BoundRoomId", "BattleDurationFrames", "BoundRoomCapacity", "FrameLogEnabled" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.InputFrameDownsync), global::jtshared.InputFrameDownsync.Parser, new[]{ "InputCount", "InputList", "ConfirmedList", "UdpConfirmedList" }, null, null, null, null),
-            new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.DownsyncSnapshot), global::jtshared.DownsyncSnapshot.Parser, new[]{ "RefRdfId", "RefRdf", "UnconfirmedMask", "StIfdId", "IfdBatch", "Act", "PrepareInfo", "AssignedUdpTunnel", "PeerUdpAddrList", "ParticipantChangeId", "InactiveJoinMask", "PeerJoinIndex", "PeerBulletTeamId", "PeerSpeciesId", "PeerSteamBindingList", "ErrMsg" }, null, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.RenderFrameDelta), global::jtshared.RenderFrameDelta.Parser, new[]{ "BaseRdfId", "Changed", "PlayerDirtyMask", "NpcDirtyMask", "BulletDirtyMask", "DynamicTrapDirtyMask", "TriggerDirtyMask", "PickableDirtyMask" }, null, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.DownsyncSnapshot), global::jtshared.DownsyncSnapshot.Parser, new[]{ "RefRdfId", "RefRdf", "RefRdfDelta", "UnconfirmedMask", "StIfdId", "IfdBatch", "Act", "PrepareInfo", "AssignedUdpTunnel", "PeerUdpAddrList", "ParticipantChangeId", "InactiveJoinMask", "PeerJoinIndex", "PeerBulletTeamId", "PeerSpeciesId", "PeerSteamBindingList", "ErrMsg" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.Skill), global::jtshared.Skill.Parser, new[]{ "Id", "RecoveryFrames", "RecoveryFramesOnBlock", "RecoveryFramesOnHit", "InvocationType", "BoundChState", "BoundChStateOnHit", "MpDelta", "Atk1MagazineDelta", "SuperAtkGaugeDelta", "Hits", "SelfNonStockBuff" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.FrameLog), global::jtshared.FrameLog.Parser, new[]{ "Rdf", "ActuallyUsedIfdId", "UsedIfdInputList", "UsedIfdConfirmedList", "UsedIfdUdpConfirmedList", "TimerRdfId", "LcacIfdId", "ChaserRdfId", "ChaserRdfIdLowerBound", "ChaserStRdfId", "ChaserEdRdfId", "ChaserRdfIdLowerBoundSnatched" }, null, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.RollbackStats), global::jtshared.RollbackStats.Parser, new[]{ "RollbackCnt", "MaxRollbackDepth", "RollbackDepthHistogram", "RollbackFromSelfCnt", "RollbackFromUdpCnt", "RollbackFromRegulateBeforeRenderCnt", "ResimulatedRdfCnt", "ChasingMicros", "ElapsedMicros", "PredictedInputCntPerPlayer", "MispredictedInputCntPerPlayer" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.BattleResult), global::jtshared.BattleResult.Parser, new[]{ "WinnerJoinIndex", "WinnerBulletTeamId" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.DebuffConfig), global::jtshared.DebuffConfig.Parser, new[]{ "SpeciesId", "StockType", "Stock", "Type", "ArrIdx", "ImpactPerInterval", "ImpactInterval" }, null, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::jtshared.BuffConfig), global::jtshared.BuffConfig.Parser, new[]{ "SpeciesId", "StockType", "Stock", "SpeedDelta", "HitboxHalfSizeXDelta", "HitboxHalfSizeYDelta", "DamageDelta", "DamageDeltaByPercentage", "CharacterHardnessDelta", "MeleeHardnessDelta", "FireballHardnessDelta", "Invinsible", "XformChSpeciesId", "RepelSoftPushback", "OmitGravity", "AssociatedDebuffs", "CharacterVfxAnimName" }, null, null, null, null),
@@ -13718,6 +13737,9 @@ namespace jtshared {
     public UpsyncSnapshot(UpsyncSnapshot other) : this() {
       stIfdId_ = other.stIfdId_;
       cmdList_ = other.cmdList_.Clone();
+      ackedRefRdfId_ = other.ackedRefRdfId_;
+      checksumRdfId_ = other.checksumRdfId_;
+      checksum_ = other.checksum_;
       _unknownFields = pb::UnknownFieldSet.Clone(other._unknownFields);
     }
 
@@ -13753,6 +13775,51 @@ namespace jtshared {
       get { return cmdList_; }
     }
 
+    /// <summary>Field number for the "acked_ref_rdf_id" field.</summary>
+    public const int AckedRefRdfIdFieldNumber = 3;
+    private int ackedRefRdfId_;
+    /// <summary>
+    /// The "id" of the latest authoritative "RenderFrame" held by the sender (i.e. received as "DownsyncSnapshot.ref_rdf" or decoded from "DownsyncSnapshot.ref_rdf_delta"), used by backend as the base of "RenderFrameDelta".
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int AckedRefRdfId {
+      get { return ackedRefRdfId_; }
+      set {
+        ackedRefRdfId_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "checksum_rdf_id" field.</summary>
+    public const int ChecksumRdfIdFieldNumber = 4;
+    private int checksumRdfId_;
+    /// <summary>
+    /// The "id" of the latest "RenderFrame" calculated by the sender from all-confirmed inputs, or "terminating_render_frame_id" if none.
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int ChecksumRdfId {
+      get { return checksumRdfId_; }
+      set {
+        checksumRdfId_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "checksum" field.</summary>
+    public const int ChecksumFieldNumber = 5;
+    private ulong checksum_;
+    /// <summary>
+    /// "RenderFrame.checksum" of "checksum_rdf_id", compared against the backend counterpart to detect desyncs.
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public ulong Checksum {
+      get { return checksum_; }
+      set {
+        checksum_ = value;
+      }
+    }
+
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public override bool Equals(object other) {
@@ -13770,6 +13837,9 @@ namespace jtshared {
       }
       if (StIfdId != other.StIfdId) return false;
       if(!cmdList_.Equals(other.cmdList_)) return false;
+      if (AckedRefRdfId != other.AckedRefRdfId) return false;
+      if (ChecksumRdfId != other.ChecksumRdfId) return false;
+      if (Checksum != other.Checksum) return false;
       return Equals(_unknownFields, other._unknownFields);
     }
 
@@ -13779,6 +13849,9 @@ namespace jtshared {
       int hash = 1;
       if (StIfdId != 0) hash ^= StIfdId.GetHashCode();
       hash ^= cmdList_.GetHashCode();
+      if (AckedRefRdfId != 0) hash ^= AckedRefRdfId.GetHashCode();
+      if (ChecksumRdfId != 0) hash ^= ChecksumRdfId.GetHashCode();
+      if (Checksum != 0UL) hash ^= Checksum.GetHashCode();
       if (_unknownFields != null) {
         hash ^= _unknownFields.GetHashCode();
       }
@@ -13802,6 +13875,18 @@ namespace jtshared {
         output.WriteInt32(StIfdId);
       }
       cmdList_.WriteTo(output, _repeated_cmdList_codec);
+      if (AckedRefRdfId != 0) {
+        output.WriteRawTag(24);
+        output.WriteInt32(AckedRefRdfId);
+      }
+      if (ChecksumRdfId != 0) {
+        output.WriteRawTag(32);
+        output.WriteInt32(ChecksumRdfId);
+      }
+      if (Checksum != 0UL) {
+        output.WriteRawTag(40);
+        output.WriteUInt64(Checksum);
+      }
       if (_unknownFields != null) {
         _unknownFields.WriteTo(output);
       }
@@ -13817,6 +13902,18 @@ namespace jtshared {
         output.WriteInt32(StIfdId);
       }
       cmdList_.WriteTo(ref output, _repeated_cmdList_codec);
+      if (AckedRefRdfId != 0) {
+        output.WriteRawTag(24);
+        output.WriteInt32(AckedRefRdfId);
+      }
+      if (ChecksumRdfId != 0) {
+        output.WriteRawTag(32);
+        output.WriteInt32(ChecksumRdfId);
+      }
+      if (Checksum != 0UL) {
+        output.WriteRawTag(40);
+        output.WriteUInt64(Checksum);
+      }
       if (_unknownFields != null) {
         _unknownFields.WriteTo(ref output);
       }
@@ -13831,6 +13928,15 @@ namespace jtshared {
         size += 1 + pb::CodedOutputStream.ComputeInt32Size(StIfdId);
       }
       size += cmdList_.CalculateSize(_repeated_cmdList_codec);
+      if (AckedRefRdfId != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeInt32Size(AckedRefRdfId);
+      }
+      if (ChecksumRdfId != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeInt32Size(ChecksumRdfId);
+      }
+      if (Checksum != 0UL) {
+        size += 1 + pb::CodedOutputStream.ComputeUInt64Size(Checksum);
+      }
       if (_unknownFields != null) {
         size += _unknownFields.CalculateSize();
       }
@@ -13847,6 +13953,15 @@ namespace jtshared {
         StIfdId = other.StIfdId;
       }
       cmdList_.Add(other.cmdList_);
+      if (other.AckedRefRdfId != 0) {
+        AckedRefRdfId = other.AckedRefRdfId;
+      }
+      if (other.ChecksumRdfId != 0) {
+        ChecksumRdfId = other.ChecksumRdfId;
+      }
+      if (other.Checksum != 0UL) {
+        Checksum = other.Checksum;
+      }
       _unknownFields = pb::UnknownFieldSet.MergeFrom(_unknownFields, other._unknownFields);
     }
 
@@ -13875,6 +13990,18 @@ namespace jtshared {
             cmdList_.AddEntriesFrom(input, _repeated_cmdList_codec);
             break;
           }
+          case 24: {
+            AckedRefRdfId = input.ReadInt32();
+            break;
+          }
+          case 32: {
+            ChecksumRdfId = input.ReadInt32();
+            break;
+          }
+          case 40: {
+            Checksum = input.ReadUInt64();
+            break;
+          }
         }
       }
     #endif
@@ -13903,6 +14030,18 @@ namespace jtshared {
             cmdList_.AddEntriesFrom(ref input, _repeated_cmdList_codec);
             break;
           }
+          case 24: {
+            AckedRefRdfId = input.ReadInt32();
+            break;
+          }
+          case 32: {
+            ChecksumRdfId = input.ReadInt32();
+            break;
+          }
+          case 40: {
+            Checksum = input.ReadUInt64();
+            break;
+          }
         }
       }
     }
@@ -24574,6 +24713,7 @@ namespace jtshared {
       pickableIdCounter_ = other.pickableIdCounter_;
       pickableCount_ = other.pickableCount_;
       dynamicTrapCount_ = other.dynamicTrapCount_;
+      checksum_ = other.checksum_;
       _unknownFields = pb::UnknownFieldSet.Clone(other._unknownFields);
     }
 
@@ -24785,6 +24925,21 @@ namespace jtshared {
       }
     }
 
+    /// <summary>Field number for the "checksum" field.</summary>
+    public const int ChecksumFieldNumber = 18;
+    private ulong checksum_;
+    /// <summary>
+    /// Calculated at the end of "BaseBattle::CalcSingleStep", see "BaseBattle::CalcRdfChecksum" for what's covered.
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public ulong Checksum {
+      get { return checksum_; }
+      set {
+        checksum_ = value;
+      }
+    }
+
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public override bool Equals(object other) {
@@ -24816,6 +24971,7 @@ namespace jtshared {
       if (PickableIdCounter != other.PickableIdCounter) return false;
       if (PickableCount != other.PickableCount) return false;
       if (DynamicTrapCount != other.DynamicTrapCount) return false;
+      if (Checksum != other.Checksum) return false;
       return Equals(_unknownFields, other._unknownFields);
     }
 
@@ -24839,6 +24995,7 @@ namespace jtshared {
       if (PickableIdCounter != 0) hash ^= PickableIdCounter.GetHashCode();
       if (PickableCount != 0) hash ^= PickableCount.GetHashCode();
       if (DynamicTrapCount != 0) hash ^= DynamicTrapCount.GetHashCode();
+      if (Checksum != 0UL) hash ^= Checksum.GetHashCode();
       if (_unknownFields != null) {
         hash ^= _unknownFields.GetHashCode();
       }
@@ -24903,6 +25060,10 @@ namespace jtshared {
         output.WriteRawTag(136, 1);
         output.WriteUInt32(DynamicTrapCount);
       }
+      if (Checksum != 0UL) {
+        output.WriteRawTag(144, 1);
+        output.WriteUInt64(Checksum);
+      }
       if (_unknownFields != null) {
         _unknownFields.WriteTo(output);
       }
@@ -24959,6 +25120,10 @@ namespace jtshared {
         output.WriteRawTag(136, 1);
         output.WriteUInt32(DynamicTrapCount);
       }
+      if (Checksum != 0UL) {
+        output.WriteRawTag(144, 1);
+        output.WriteUInt64(Checksum);
+      }
       if (_unknownFields != null) {
         _unknownFields.WriteTo(ref output);
       }
@@ -25005,6 +25170,9 @@ namespace jtshared {
       if (DynamicTrapCount != 0) {
         size += 2 + pb::CodedOutputStream.ComputeUInt32Size(DynamicTrapCount);
       }
+      if (Checksum != 0UL) {
+        size += 2 + pb::CodedOutputStream.ComputeUInt64Size(Checksum);
+      }
       if (_unknownFields != null) {
         size += _unknownFields.CalculateSize();
       }
@@ -25053,6 +25221,9 @@ namespace jtshared {
       if (other.DynamicTrapCount != 0) {
         DynamicTrapCount = other.DynamicTrapCount;
       }
+      if (other.Checksum != 0UL) {
+        Checksum = other.Checksum;
+      }
       _unknownFields = pb::UnknownFieldSet.MergeFrom(_unknownFields, other._unknownFields);
     }
 
@@ -25136,6 +25307,10 @@ namespace jtshared {
             DynamicTrapCount = input.ReadUInt32();
             break;
           }
+          case 144: {
+            Checksum = input.ReadUInt64();
+            break;
+          }
         }
       }
     #endif
@@ -25219,6 +25394,10 @@ namespace jtshared {
             DynamicTrapCount = input.ReadUInt32();
             break;
           }
+          case 144: {
+            Checksum = input.ReadUInt64();
+            break;
+          }
         }
       }
     }
@@ -25881,6 +26060,428 @@ namespace jtshared {
 
   }
 
+  /// <summary>
+  ///
+  ///[REMINDER]
+  ///
+  ///A "RenderFrameDelta" is decoded by "CopyRdf(baseRdf, holder)" followed by patching "holder" with "changed", where
+  ///- all scalar fields of "changed" (e.g. "id", "xxx_count", "xxx_id_counter") are ALWAYS set, and
+  ///- each repeated field of "changed" only contains the entities whose slot is marked in the corresponding "xxx_dirty_mask", in ascending slot order, i.e. bit "i" of the list refers to "xxx_dirty_mask[i >> 6] &amp; (1 &lt;&lt; (i &amp; 63))".
+  ///
+  ///An entity is marked dirty if its serialized bytes differ from those of the same slot in "baseRdf" or if that slot is beyond the alive count of "baseRdf", therefore within a dirty entity all non-default fields are carried (proto3 already omits default-valued ones on the wire).
+  /// </summary>
+  [global::System.Diagnostics.DebuggerDisplayAttribute("{ToString(),nq}")]
+  public sealed partial class RenderFrameDelta : pb::IMessage<RenderFrameDelta>
+  #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+      , pb::IBufferMessage
+  #endif
+  {
+    private static readonly pb::MessageParser<RenderFrameDelta> _parser = new pb::MessageParser<RenderFrameDelta>(() => new RenderFrameDelta());
+    private pb::UnknownFieldSet _unknownFields;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public static pb::MessageParser<RenderFrameDelta> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[31]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public RenderFrameDelta() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public RenderFrameDelta(RenderFrameDelta other) : this() {
+      baseRdfId_ = other.baseRdfId_;
+      changed_ = other.changed_ != null ? other.changed_.Clone() : null;
+      playerDirtyMask_ = other.playerDirtyMask_.Clone();
+      npcDirtyMask_ = other.npcDirtyMask_.Clone();
+      bulletDirtyMask_ = other.bulletDirtyMask_.Clone();
+      dynamicTrapDirtyMask_ = other.dynamicTrapDirtyMask_.Clone();
+      triggerDirtyMask_ = other.triggerDirtyMask_.Clone();
+      pickableDirtyMask_ = other.pickableDirtyMask_.Clone();
+      _unknownFields = pb::UnknownFieldSet.Clone(other._unknownFields);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public RenderFrameDelta Clone() {
+      return new RenderFrameDelta(this);
+    }
+
+    /// <summary>Field number for the "base_rdf_id" field.</summary>
+    public const int BaseRdfIdFieldNumber = 1;
+    private int baseRdfId_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int BaseRdfId {
+      get { return baseRdfId_; }
+      set {
+        baseRdfId_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "changed" field.</summary>
+    public const int ChangedFieldNumber = 2;
+    private global::jtshared.RenderFrame changed_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public global::jtshared.RenderFrame Changed {
+      get { return changed_; }
+      set {
+        changed_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "player_dirty_mask" field.</summary>
+    public const int PlayerDirtyMaskFieldNumber = 3;
+    private static readonly pb::FieldCodec<ulong> _repeated_playerDirtyMask_codec
+        = pb::FieldCodec.ForUInt64(26);
+    private readonly pbc::RepeatedField<ulong> playerDirtyMask_ = new pbc::RepeatedField<ulong>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<ulong> PlayerDirtyMask {
+      get { return playerDirtyMask_; }
+    }
+
+    /// <summary>Field number for the "npc_dirty_mask" field.</summary>
+    public const int NpcDirtyMaskFieldNumber = 4;
+    private static readonly pb::FieldCodec<ulong> _repeated_npcDirtyMask_codec
+        = pb::FieldCodec.ForUInt64(34);
+    private readonly pbc::RepeatedField<ulong> npcDirtyMask_ = new pbc::RepeatedField<ulong>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<ulong> NpcDirtyMask {
+      get { return npcDirtyMask_; }
+    }
+
+    /// <summary>Field number for the "bullet_dirty_mask" field.</summary>
+    public const int BulletDirtyMaskFieldNumber = 5;
+    private static readonly pb::FieldCodec<ulong> _repeated_bulletDirtyMask_codec
+        = pb::FieldCodec.ForUInt64(42);
+    private readonly pbc::RepeatedField<ulong> bulletDirtyMask_ = new pbc::RepeatedField<ulong>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<ulong> BulletDirtyMask {
+      get { return bulletDirtyMask_; }
+    }
+
+    /// <summary>Field number for the "dynamic_trap_dirty_mask" field.</summary>
+    public const int DynamicTrapDirtyMaskFieldNumber = 6;
+    private static readonly pb::FieldCodec<ulong> _repeated_dynamicTrapDirtyMask_codec
+        = pb::FieldCodec.ForUInt64(50);
+    private readonly pbc::RepeatedField<ulong> dynamicTrapDirtyMask_ = new pbc::RepeatedField<ulong>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<ulong> DynamicTrapDirtyMask {
+      get { return dynamicTrapDirtyMask_; }
+    }
+
+    /// <summary>Field number for the "trigger_dirty_mask" field.</summary>
+    public const int TriggerDirtyMaskFieldNumber = 7;
+    private static readonly pb::FieldCodec<ulong> _repeated_triggerDirtyMask_codec
+        = pb::FieldCodec.ForUInt64(58);
+    private readonly pbc::RepeatedField<ulong> triggerDirtyMask_ = new pbc::RepeatedField<ulong>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<ulong> TriggerDirtyMask {
+      get { return triggerDirtyMask_; }
+    }
+
+    /// <summary>Field number for the "pickable_dirty_mask" field.</summary>
+    public const int PickableDirtyMaskFieldNumber = 8;
+    private static readonly pb::FieldCodec<ulong> _repeated_pickableDirtyMask_codec
+        = pb::FieldCodec.ForUInt64(66);
+    private readonly pbc::RepeatedField<ulong> pickableDirtyMask_ = new pbc::RepeatedField<ulong>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<ulong> PickableDirtyMask {
+      get { return pickableDirtyMask_; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public override bool Equals(object other) {
+      return Equals(other as RenderFrameDelta);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public bool Equals(RenderFrameDelta other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (BaseRdfId != other.BaseRdfId) return false;
+      if (!object.Equals(Changed, other.Changed)) return false;
+      if(!playerDirtyMask_.Equals(other.playerDirtyMask_)) return false;
+      if(!npcDirtyMask_.Equals(other.npcDirtyMask_)) return false;
+      if(!bulletDirtyMask_.Equals(other.bulletDirtyMask_)) return false;
+      if(!dynamicTrapDirtyMask_.Equals(other.dynamicTrapDirtyMask_)) return false;
+      if(!triggerDirtyMask_.Equals(other.triggerDirtyMask_)) return false;
+      if(!pickableDirtyMask_.Equals(other.pickableDirtyMask_)) return false;
+      return Equals(_unknownFields, other._unknownFields);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (BaseRdfId != 0) hash ^= BaseRdfId.GetHashCode();
+      if (changed_ != null) hash ^= Changed.GetHashCode();
+      hash ^= playerDirtyMask_.GetHashCode();
+      hash ^= npcDirtyMask_.GetHashCode();
+      hash ^= bulletDirtyMask_.GetHashCode();
+      hash ^= dynamicTrapDirtyMask_.GetHashCode();
+      hash ^= triggerDirtyMask_.GetHashCode();
+      hash ^= pickableDirtyMask_.GetHashCode();
+      if (_unknownFields != null) {
+        hash ^= _unknownFields.GetHashCode();
+      }
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public void WriteTo(pb::CodedOutputStream output) {
+    #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+      output.WriteRawMessage(this);
+    #else
+      if (BaseRdfId != 0) {
+        output.WriteRawTag(8);
+        output.WriteInt32(BaseRdfId);
+      }
+      if (changed_ != null) {
+        output.WriteRawTag(18);
+        output.WriteMessage(Changed);
+      }
+      playerDirtyMask_.WriteTo(output, _repeated_playerDirtyMask_codec);
+      npcDirtyMask_.WriteTo(output, _repeated_npcDirtyMask_codec);
+      bulletDirtyMask_.WriteTo(output, _repeated_bulletDirtyMask_codec);
+      dynamicTrapDirtyMask_.WriteTo(output, _repeated_dynamicTrapDirtyMask_codec);
+      triggerDirtyMask_.WriteTo(output, _repeated_triggerDirtyMask_codec);
+      pickableDirtyMask_.WriteTo(output, _repeated_pickableDirtyMask_codec);
+      if (_unknownFields != null) {
+        _unknownFields.WriteTo(output);
+      }
+    #endif
+    }
+
+    #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    void pb::IBufferMessage.InternalWriteTo(ref pb::WriteContext output) {
+      if (BaseRdfId != 0) {
+        output.WriteRawTag(8);
+        output.WriteInt32(BaseRdfId);
+      }
+      if (changed_ != null) {
+        output.WriteRawTag(18);
+        output.WriteMessage(Changed);
+      }
+      playerDirtyMask_.WriteTo(ref output, _repeated_playerDirtyMask_codec);
+      npcDirtyMask_.WriteTo(ref output, _repeated_npcDirtyMask_codec);
+      bulletDirtyMask_.WriteTo(ref output, _repeated_bulletDirtyMask_codec);
+      dynamicTrapDirtyMask_.WriteTo(ref output, _repeated_dynamicTrapDirtyMask_codec);
+      triggerDirtyMask_.WriteTo(ref output, _repeated_triggerDirtyMask_codec);
+      pickableDirtyMask_.WriteTo(ref output, _repeated_pickableDirtyMask_codec);
+      if (_unknownFields != null) {
+        _unknownFields.WriteTo(ref output);
+      }
+    }
+    #endif
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int CalculateSize() {
+      int size = 0;
+      if (BaseRdfId != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeInt32Size(BaseRdfId);
+      }
+      if (changed_ != null) {
+        size += 1 + pb::CodedOutputStream.ComputeMessageSize(Changed);
+      }
+      size += playerDirtyMask_.CalculateSize(_repeated_playerDirtyMask_codec);
+      size += npcDirtyMask_.CalculateSize(_repeated_npcDirtyMask_codec);
+      size += bulletDirtyMask_.CalculateSize(_repeated_bulletDirtyMask_codec);
+      size += dynamicTrapDirtyMask_.CalculateSize(_repeated_dynamicTrapDirtyMask_codec);
+      size += triggerDirtyMask_.CalculateSize(_repeated_triggerDirtyMask_codec);
+      size += pickableDirtyMask_.CalculateSize(_repeated_pickableDirtyMask_codec);
+      if (_unknownFields != null) {
+        size += _unknownFields.CalculateSize();
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public void MergeFrom(RenderFrameDelta other) {
+      if (other == null) {
+        return;
+      }
+      if (other.BaseRdfId != 0) {
+        BaseRdfId = other.BaseRdfId;
+      }
+      if (other.changed_ != null) {
+        if (changed_ == null) {
+          Changed = new global::jtshared.RenderFrame();
+        }
+        Changed.MergeFrom(other.Changed);
+      }
+      playerDirtyMask_.Add(other.playerDirtyMask_);
+      npcDirtyMask_.Add(other.npcDirtyMask_);
+      bulletDirtyMask_.Add(other.bulletDirtyMask_);
+      dynamicTrapDirtyMask_.Add(other.dynamicTrapDirtyMask_);
+      triggerDirtyMask_.Add(other.triggerDirtyMask_);
+      pickableDirtyMask_.Add(other.pickableDirtyMask_);
+      _unknownFields = pb::UnknownFieldSet.MergeFrom(_unknownFields, other._unknownFields);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public void MergeFrom(pb::CodedInputStream input) {
+    #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+      input.ReadRawMessage(this);
+    #else
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+      if ((tag & 7) == 4) {
+        // Abort on any end group tag.
+        return;
+      }
+      switch(tag) {
+          default:
+            _unknownFields = pb::UnknownFieldSet.MergeFieldFrom(_unknownFields, input);
+            break;
+          case 8: {
+            BaseRdfId = input.ReadInt32();
+            break;
+          }
+          case 18: {
+            if (changed_ == null) {
+              Changed = new global::jtshared.RenderFrame();
+            }
+            input.ReadMessage(Changed);
+            break;
+          }
+          case 26:
+          case 24: {
+            playerDirtyMask_.AddEntriesFrom(input, _repeated_playerDirtyMask_codec);
+            break;
+          }
+          case 34:
+          case 32: {
+            npcDirtyMask_.AddEntriesFrom(input, _repeated_npcDirtyMask_codec);
+            break;
+          }
+          case 42:
+          case 40: {
+            bulletDirtyMask_.AddEntriesFrom(input, _repeated_bulletDirtyMask_codec);
+            break;
+          }
+          case 50:
+          case 48: {
+            dynamicTrapDirtyMask_.AddEntriesFrom(input, _repeated_dynamicTrapDirtyMask_codec);
+            break;
+          }
+          case 58:
+          case 56: {
+            triggerDirtyMask_.AddEntriesFrom(input, _repeated_triggerDirtyMask_codec);
+            break;
+          }
+          case 66:
+          case 64: {
+            pickableDirtyMask_.AddEntriesFrom(input, _repeated_pickableDirtyMask_codec);
+            break;
+          }
+        }
+      }
+    #endif
+    }
+
+    #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    void pb::IBufferMessage.InternalMergeFrom(ref pb::ParseContext input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+      if ((tag & 7) == 4) {
+        // Abort on any end group tag.
+        return;
+      }
+      switch(tag) {
+          default:
+            _unknownFields = pb::UnknownFieldSet.MergeFieldFrom(_unknownFields, ref input);
+            break;
+          case 8: {
+            BaseRdfId = input.ReadInt32();
+            break;
+          }
+          case 18: {
+            if (changed_ == null) {
+              Changed = new global::jtshared.RenderFrame();
+            }
+            input.ReadMessage(Changed);
+            break;
+          }
+          case 26:
+          case 24: {
+            playerDirtyMask_.AddEntriesFrom(ref input, _repeated_playerDirtyMask_codec);
+            break;
+          }
+          case 34:
+          case 32: {
+            npcDirtyMask_.AddEntriesFrom(ref input, _repeated_npcDirtyMask_codec);
+            break;
+          }
+          case 42:
+          case 40: {
+            bulletDirtyMask_.AddEntriesFrom(ref input, _repeated_bulletDirtyMask_codec);
+            break;
+          }
+          case 50:
+          case 48: {
+            dynamicTrapDirtyMask_.AddEntriesFrom(ref input, _repeated_dynamicTrapDirtyMask_codec);
+            break;
+          }
+          case 58:
+          case 56: {
+            triggerDirtyMask_.AddEntriesFrom(ref input, _repeated_triggerDirtyMask_codec);
+            break;
+          }
+          case 66:
+          case 64: {
+            pickableDirtyMask_.AddEntriesFrom(ref input, _repeated_pickableDirtyMask_codec);
+            break;
+          }
+        }
+      }
+    }
+    #endif
+
+  }
+
   [global::System.Diagnostics.DebuggerDisplayAttribute("{ToString(),nq}")]
   public sealed partial class DownsyncSnapshot : pb::IMessage<DownsyncSnapshot>
   #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
@@ -25896,7 +26497,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[31]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[32]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -25918,6 +26519,7 @@ namespace jtshared {
     public DownsyncSnapshot(DownsyncSnapshot other) : this() {
       refRdfId_ = other.refRdfId_;
       refRdf_ = other.refRdf_ != null ? other.refRdf_.Clone() : null;
+      refRdfDelta_ = other.refRdfDelta_ != null ? other.refRdfDelta_.Clone() : null;
       unconfirmedMask_ = other.unconfirmedMask_;
       stIfdId_ = other.stIfdId_;
       ifdBatch_ = other.ifdBatch_.Clone();
@@ -25965,6 +26567,21 @@ namespace jtshared {
       }
     }
 
+    /// <summary>Field number for the "ref_rdf_delta" field.</summary>
+    public const int RefRdfDeltaFieldNumber = 17;
+    private global::jtshared.RenderFrameDelta refRdfDelta_;
+    /// <summary>
+    /// Mutually exclusive with "ref_rdf", see "BackendBattle.refRdfDeltaEnabled".
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public global::jtshared.RenderFrameDelta RefRdfDelta {
+      get { return refRdfDelta_; }
+      set {
+        refRdfDelta_ = value;
+      }
+    }
+
     /// <summary>Field number for the "unconfirmed_mask" field.</summary>
     public const int UnconfirmedMaskFieldNumber = 3;
     private ulong unconfirmedMask_;
@@ -26147,6 +26764,7 @@ namespace jtshared {
       }
       if (RefRdfId != other.RefRdfId) return false;
       if (!object.Equals(RefRdf, other.RefRdf)) return false;
+      if (!object.Equals(RefRdfDelta, other.RefRdfDelta)) return false;
       if (UnconfirmedMask != other.UnconfirmedMask) return false;
       if (StIfdId != other.StIfdId) return false;
       if(!ifdBatch_.Equals(other.ifdBatch_)) return false;
@@ -26170,6 +26788,7 @@ namespace jtshared {
       int hash = 1;
       if (RefRdfId != 0) hash ^= RefRdfId.GetHashCode();
       if (refRdf_ != null) hash ^= RefRdf.GetHashCode();
+      if (refRdfDelta_ != null) hash ^= RefRdfDelta.GetHashCode();
       if (UnconfirmedMask != 0UL) hash ^= UnconfirmedMask.GetHashCode();
       if (StIfdId != 0) hash ^= StIfdId.GetHashCode();
       hash ^= ifdBatch_.GetHashCode();
@@ -26253,6 +26872,10 @@ namespace jtshared {
         output.WriteUInt32(PeerSpeciesId);
       }
       peerSteamBindingList_.WriteTo(output, _repeated_peerSteamBindingList_codec);
+      if (refRdfDelta_ != null) {
+        output.WriteRawTag(138, 1);
+        output.WriteMessage(RefRdfDelta);
+      }
       if (ErrMsg.Length != 0) {
         output.WriteRawTag(130, 32);
         output.WriteString(ErrMsg);
@@ -26318,6 +26941,10 @@ namespace jtshared {
         output.WriteUInt32(PeerSpeciesId);
       }
       peerSteamBindingList_.WriteTo(ref output, _repeated_peerSteamBindingList_codec);
+      if (refRdfDelta_ != null) {
+        output.WriteRawTag(138, 1);
+        output.WriteMessage(RefRdfDelta);
+      }
       if (ErrMsg.Length != 0) {
         output.WriteRawTag(130, 32);
         output.WriteString(ErrMsg);
@@ -26338,6 +26965,9 @@ namespace jtshared {
       if (refRdf_ != null) {
         size += 1 + pb::CodedOutputStream.ComputeMessageSize(RefRdf);
       }
+      if (refRdfDelta_ != null) {
+        size += 2 + pb::CodedOutputStream.ComputeMessageSize(RefRdfDelta);
+      }
       if (UnconfirmedMask != 0UL) {
         size += 1 + pb::CodedOutputStream.ComputeUInt64Size(UnconfirmedMask);
       }
@@ -26395,6 +27025,12 @@ namespace jtshared {
         }
         RefRdf.MergeFrom(other.RefRdf);
       }
+      if (other.refRdfDelta_ != null) {
+        if (refRdfDelta_ == null) {
+          RefRdfDelta = new global::jtshared.RenderFrameDelta();
+        }
+        RefRdfDelta.MergeFrom(other.RefRdfDelta);
+      }
       if (other.UnconfirmedMask != 0UL) {
         UnconfirmedMask = other.UnconfirmedMask;
       }
@@ -26525,6 +27161,13 @@ namespace jtshared {
             peerSteamBindingList_.AddEntriesFrom(input, _repeated_peerSteamBindingList_codec);
             break;
           }
+          case 138: {
+            if (refRdfDelta_ == null) {
+              RefRdfDelta = new global::jtshared.RenderFrameDelta();
+            }
+            input.ReadMessage(RefRdfDelta);
+            break;
+          }
           case 4098: {
             ErrMsg = input.ReadString();
             break;
@@ -26617,6 +27260,13 @@ namespace jtshared {
             peerSteamBindingList_.AddEntriesFrom(ref input, _repeated_peerSteamBindingList_codec);
             break;
           }
+          case 138: {
+            if (refRdfDelta_ == null) {
+              RefRdfDelta = new global::jtshared.RenderFrameDelta();
+            }
+            input.ReadMessage(RefRdfDelta);
+            break;
+          }
           case 4098: {
             ErrMsg = input.ReadString();
             break;
@@ -26643,7 +27293,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[32]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[33]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -27252,7 +27902,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[33]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[34]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -27842,6 +28492,557 @@ namespace jtshared {
 
   }
 
+  [global::System.Diagnostics.DebuggerDisplayAttribute("{ToString(),nq}")]
+  public sealed partial class RollbackStats : pb::IMessage<RollbackStats>
+  #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+      , pb::IBufferMessage
+  #endif
+  {
+    private static readonly pb::MessageParser<RollbackStats> _parser = new pb::MessageParser<RollbackStats>(() => new RollbackStats());
+    private pb::UnknownFieldSet _unknownFields;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public static pb::MessageParser<RollbackStats> Parser { get { return _parser; } }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public static pbr::MessageDescriptor Descriptor {
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[35]; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    pbr::MessageDescriptor pb::IMessage.Descriptor {
+      get { return Descriptor; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public RollbackStats() {
+      OnConstruction();
+    }
+
+    partial void OnConstruction();
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public RollbackStats(RollbackStats other) : this() {
+      rollbackCnt_ = other.rollbackCnt_;
+      maxRollbackDepth_ = other.maxRollbackDepth_;
+      rollbackDepthHistogram_ = other.rollbackDepthHistogram_.Clone();
+      rollbackFromSelfCnt_ = other.rollbackFromSelfCnt_;
+      rollbackFromUdpCnt_ = other.rollbackFromUdpCnt_;
+      rollbackFromRegulateBeforeRenderCnt_ = other.rollbackFromRegulateBeforeRenderCnt_;
+      resimulatedRdfCnt_ = other.resimulatedRdfCnt_;
+      chasingMicros_ = other.chasingMicros_;
+      elapsedMicros_ = other.elapsedMicros_;
+      predictedInputCntPerPlayer_ = other.predictedInputCntPerPlayer_.Clone();
+      mispredictedInputCntPerPlayer_ = other.mispredictedInputCntPerPlayer_.Clone();
+      _unknownFields = pb::UnknownFieldSet.Clone(other._unknownFields);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public RollbackStats Clone() {
+      return new RollbackStats(this);
+    }
+
+    /// <summary>Field number for the "rollback_cnt" field.</summary>
+    public const int RollbackCntFieldNumber = 1;
+    private int rollbackCnt_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int RollbackCnt {
+      get { return rollbackCnt_; }
+      set {
+        rollbackCnt_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "max_rollback_depth" field.</summary>
+    public const int MaxRollbackDepthFieldNumber = 2;
+    private int maxRollbackDepth_;
+    /// <summary>
+    /// In RenderFrames, i.e. "timerRdfId - rewound chaserRdfId"
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int MaxRollbackDepth {
+      get { return maxRollbackDepth_; }
+      set {
+        maxRollbackDepth_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "rollback_depth_histogram" field.</summary>
+    public const int RollbackDepthHistogramFieldNumber = 3;
+    private static readonly pb::FieldCodec<int> _repeated_rollbackDepthHistogram_codec
+        = pb::FieldCodec.ForInt32(26);
+    private readonly pbc::RepeatedField<int> rollbackDepthHistogram_ = new pbc::RepeatedField<int>();
+    /// <summary>
+    /// Bucket 0 is depth [0, 2), bucket i (> 0) is depth [2^i, 2^(i+1)), the last bucket is open-ended
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<int> RollbackDepthHistogram {
+      get { return rollbackDepthHistogram_; }
+    }
+
+    /// <summary>Field number for the "rollback_from_self_cnt" field.</summary>
+    public const int RollbackFromSelfCntFieldNumber = 4;
+    private int rollbackFromSelfCnt_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int RollbackFromSelfCnt {
+      get { return rollbackFromSelfCnt_; }
+      set {
+        rollbackFromSelfCnt_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "rollback_from_udp_cnt" field.</summary>
+    public const int RollbackFromUdpCntFieldNumber = 5;
+    private int rollbackFromUdpCnt_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int RollbackFromUdpCnt {
+      get { return rollbackFromUdpCnt_; }
+      set {
+        rollbackFromUdpCnt_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "rollback_from_regulate_before_render_cnt" field.</summary>
+    public const int RollbackFromRegulateBeforeRenderCntFieldNumber = 6;
+    private int rollbackFromRegulateBeforeRenderCnt_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int RollbackFromRegulateBeforeRenderCnt {
+      get { return rollbackFromRegulateBeforeRenderCnt_; }
+      set {
+        rollbackFromRegulateBeforeRenderCnt_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "resimulated_rdf_cnt" field.</summary>
+    public const int ResimulatedRdfCntFieldNumber = 7;
+    private long resimulatedRdfCnt_;
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public long ResimulatedRdfCnt {
+      get { return resimulatedRdfCnt_; }
+      set {
+        resimulatedRdfCnt_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "chasing_micros" field.</summary>
+    public const int ChasingMicrosFieldNumber = 8;
+    private long chasingMicros_;
+    /// <summary>
+    /// Wall time spent in "ChaseRolledBackRdfs" and "ChaseRolledBackRdfsWithBudget"
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public long ChasingMicros {
+      get { return chasingMicros_; }
+      set {
+        chasingMicros_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "elapsed_micros" field.</summary>
+    public const int ElapsedMicrosFieldNumber = 9;
+    private long elapsedMicros_;
+    /// <summary>
+    /// Wall time since the stats were reset
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public long ElapsedMicros {
+      get { return elapsedMicros_; }
+      set {
+        elapsedMicros_ = value;
+      }
+    }
+
+    /// <summary>Field number for the "predicted_input_cnt_per_player" field.</summary>
+    public const int PredictedInputCntPerPlayerFieldNumber = 10;
+    private static readonly pb::FieldCodec<int> _repeated_predictedInputCntPerPlayer_codec
+        = pb::FieldCodec.ForInt32(82);
+    private readonly pbc::RepeatedField<int> predictedInputCntPerPlayer_ = new pbc::RepeatedField<int>();
+    /// <summary>
+    /// Indexed by "joinIndex-1", count of locally predicted inputs later replaced by the actual ones (from either TCP or UDP)
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<int> PredictedInputCntPerPlayer {
+      get { return predictedInputCntPerPlayer_; }
+    }
+
+    /// <summary>Field number for the "mispredicted_input_cnt_per_player" field.</summary>
+    public const int MispredictedInputCntPerPlayerFieldNumber = 11;
+    private static readonly pb::FieldCodec<int> _repeated_mispredictedInputCntPerPlayer_codec
+        = pb::FieldCodec.ForInt32(90);
+    private readonly pbc::RepeatedField<int> mispredictedInputCntPerPlayer_ = new pbc::RepeatedField<int>();
+    /// <summary>
+    /// Indexed by "joinIndex-1", the subset of "predicted_input_cnt_per_player" whose actual input differs
+    /// </summary>
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public pbc::RepeatedField<int> MispredictedInputCntPerPlayer {
+      get { return mispredictedInputCntPerPlayer_; }
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public override bool Equals(object other) {
+      return Equals(other as RollbackStats);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public bool Equals(RollbackStats other) {
+      if (ReferenceEquals(other, null)) {
+        return false;
+      }
+      if (ReferenceEquals(other, this)) {
+        return true;
+      }
+      if (RollbackCnt != other.RollbackCnt) return false;
+      if (MaxRollbackDepth != other.MaxRollbackDepth) return false;
+      if(!rollbackDepthHistogram_.Equals(other.rollbackDepthHistogram_)) return false;
+      if (RollbackFromSelfCnt != other.RollbackFromSelfCnt) return false;
+      if (RollbackFromUdpCnt != other.RollbackFromUdpCnt) return false;
+      if (RollbackFromRegulateBeforeRenderCnt != other.RollbackFromRegulateBeforeRenderCnt) return false;
+      if (ResimulatedRdfCnt != other.ResimulatedRdfCnt) return false;
+      if (ChasingMicros != other.ChasingMicros) return false;
+      if (ElapsedMicros != other.ElapsedMicros) return false;
+      if(!predictedInputCntPerPlayer_.Equals(other.predictedInputCntPerPlayer_)) return false;
+      if(!mispredictedInputCntPerPlayer_.Equals(other.mispredictedInputCntPerPlayer_)) return false;
+      return Equals(_unknownFields, other._unknownFields);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public override int GetHashCode() {
+      int hash = 1;
+      if (RollbackCnt != 0) hash ^= RollbackCnt.GetHashCode();
+      if (MaxRollbackDepth != 0) hash ^= MaxRollbackDepth.GetHashCode();
+      hash ^= rollbackDepthHistogram_.GetHashCode();
+      if (RollbackFromSelfCnt != 0) hash ^= RollbackFromSelfCnt.GetHashCode();
+      if (RollbackFromUdpCnt != 0) hash ^= RollbackFromUdpCnt.GetHashCode();
+      if (RollbackFromRegulateBeforeRenderCnt != 0) hash ^= RollbackFromRegulateBeforeRenderCnt.GetHashCode();
+      if (ResimulatedRdfCnt != 0L) hash ^= ResimulatedRdfCnt.GetHashCode();
+      if (ChasingMicros != 0L) hash ^= ChasingMicros.GetHashCode();
+      if (ElapsedMicros != 0L) hash ^= ElapsedMicros.GetHashCode();
+      hash ^= predictedInputCntPerPlayer_.GetHashCode();
+      hash ^= mispredictedInputCntPerPlayer_.GetHashCode();
+      if (_unknownFields != null) {
+        hash ^= _unknownFields.GetHashCode();
+      }
+      return hash;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public override string ToString() {
+      return pb::JsonFormatter.ToDiagnosticString(this);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public void WriteTo(pb::CodedOutputStream output) {
+    #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+      output.WriteRawMessage(this);
+    #else
+      if (RollbackCnt != 0) {
+        output.WriteRawTag(8);
+        output.WriteInt32(RollbackCnt);
+      }
+      if (MaxRollbackDepth != 0) {
+        output.WriteRawTag(16);
+        output.WriteInt32(MaxRollbackDepth);
+      }
+      rollbackDepthHistogram_.WriteTo(output, _repeated_rollbackDepthHistogram_codec);
+      if (RollbackFromSelfCnt != 0) {
+        output.WriteRawTag(32);
+        output.WriteInt32(RollbackFromSelfCnt);
+      }
+      if (RollbackFromUdpCnt != 0) {
+        output.WriteRawTag(40);
+        output.WriteInt32(RollbackFromUdpCnt);
+      }
+      if (RollbackFromRegulateBeforeRenderCnt != 0) {
+        output.WriteRawTag(48);
+        output.WriteInt32(RollbackFromRegulateBeforeRenderCnt);
+      }
+      if (ResimulatedRdfCnt != 0L) {
+        output.WriteRawTag(56);
+        output.WriteInt64(ResimulatedRdfCnt);
+      }
+      if (ChasingMicros != 0L) {
+        output.WriteRawTag(64);
+        output.WriteInt64(ChasingMicros);
+      }
+      if (ElapsedMicros != 0L) {
+        output.WriteRawTag(72);
+        output.WriteInt64(ElapsedMicros);
+      }
+      predictedInputCntPerPlayer_.WriteTo(output, _repeated_predictedInputCntPerPlayer_codec);
+      mispredictedInputCntPerPlayer_.WriteTo(output, _repeated_mispredictedInputCntPerPlayer_codec);
+      if (_unknownFields != null) {
+        _unknownFields.WriteTo(output);
+      }
+    #endif
+    }
+
+    #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    void pb::IBufferMessage.InternalWriteTo(ref pb::WriteContext output) {
+      if (RollbackCnt != 0) {
+        output.WriteRawTag(8);
+        output.WriteInt32(RollbackCnt);
+      }
+      if (MaxRollbackDepth != 0) {
+        output.WriteRawTag(16);
+        output.WriteInt32(MaxRollbackDepth);
+      }
+      rollbackDepthHistogram_.WriteTo(ref output, _repeated_rollbackDepthHistogram_codec);
+      if (RollbackFromSelfCnt != 0) {
+        output.WriteRawTag(32);
+        output.WriteInt32(RollbackFromSelfCnt);
+      }
+      if (RollbackFromUdpCnt != 0) {
+        output.WriteRawTag(40);
+        output.WriteInt32(RollbackFromUdpCnt);
+      }
+      if (RollbackFromRegulateBeforeRenderCnt != 0) {
+        output.WriteRawTag(48);
+        output.WriteInt32(RollbackFromRegulateBeforeRenderCnt);
+      }
+      if (ResimulatedRdfCnt != 0L) {
+        output.WriteRawTag(56);
+        output.WriteInt64(ResimulatedRdfCnt);
+      }
+      if (ChasingMicros != 0L) {
+        output.WriteRawTag(64);
+        output.WriteInt64(ChasingMicros);
+      }
+      if (ElapsedMicros != 0L) {
+        output.WriteRawTag(72);
+        output.WriteInt64(ElapsedMicros);
+      }
+      predictedInputCntPerPlayer_.WriteTo(ref output, _repeated_predictedInputCntPerPlayer_codec);
+      mispredictedInputCntPerPlayer_.WriteTo(ref output, _repeated_mispredictedInputCntPerPlayer_codec);
+      if (_unknownFields != null) {
+        _unknownFields.WriteTo(ref output);
+      }
+    }
+    #endif
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public int CalculateSize() {
+      int size = 0;
+      if (RollbackCnt != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeInt32Size(RollbackCnt);
+      }
+      if (MaxRollbackDepth != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeInt32Size(MaxRollbackDepth);
+      }
+      size += rollbackDepthHistogram_.CalculateSize(_repeated_rollbackDepthHistogram_codec);
+      if (RollbackFromSelfCnt != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeInt32Size(RollbackFromSelfCnt);
+      }
+      if (RollbackFromUdpCnt != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeInt32Size(RollbackFromUdpCnt);
+      }
+      if (RollbackFromRegulateBeforeRenderCnt != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeInt32Size(RollbackFromRegulateBeforeRenderCnt);
+      }
+      if (ResimulatedRdfCnt != 0L) {
+        size += 1 + pb::CodedOutputStream.ComputeInt64Size(ResimulatedRdfCnt);
+      }
+      if (ChasingMicros != 0L) {
+        size += 1 + pb::CodedOutputStream.ComputeInt64Size(ChasingMicros);
+      }
+      if (ElapsedMicros != 0L) {
+        size += 1 + pb::CodedOutputStream.ComputeInt64Size(ElapsedMicros);
+      }
+      size += predictedInputCntPerPlayer_.CalculateSize(_repeated_predictedInputCntPerPlayer_codec);
+      size += mispredictedInputCntPerPlayer_.CalculateSize(_repeated_mispredictedInputCntPerPlayer_codec);
+      if (_unknownFields != null) {
+        size += _unknownFields.CalculateSize();
+      }
+      return size;
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public void MergeFrom(RollbackStats other) {
+      if (other == null) {
+        return;
+      }
+      if (other.RollbackCnt != 0) {
+        RollbackCnt = other.RollbackCnt;
+      }
+      if (other.MaxRollbackDepth != 0) {
+        MaxRollbackDepth = other.MaxRollbackDepth;
+      }
+      rollbackDepthHistogram_.Add(other.rollbackDepthHistogram_);
+      if (other.RollbackFromSelfCnt != 0) {
+        RollbackFromSelfCnt = other.RollbackFromSelfCnt;
+      }
+      if (other.RollbackFromUdpCnt != 0) {
+        RollbackFromUdpCnt = other.RollbackFromUdpCnt;
+      }
+      if (other.RollbackFromRegulateBeforeRenderCnt != 0) {
+        RollbackFromRegulateBeforeRenderCnt = other.RollbackFromRegulateBeforeRenderCnt;
+      }
+      if (other.ResimulatedRdfCnt != 0L) {
+        ResimulatedRdfCnt = other.ResimulatedRdfCnt;
+      }
+      if (other.ChasingMicros != 0L) {
+        ChasingMicros = other.ChasingMicros;
+      }
+      if (other.ElapsedMicros != 0L) {
+        ElapsedMicros = other.ElapsedMicros;
+      }
+      predictedInputCntPerPlayer_.Add(other.predictedInputCntPerPlayer_);
+      mispredictedInputCntPerPlayer_.Add(other.mispredictedInputCntPerPlayer_);
+      _unknownFields = pb::UnknownFieldSet.MergeFrom(_unknownFields, other._unknownFields);
+    }
+
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    public void MergeFrom(pb::CodedInputStream input) {
+    #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+      input.ReadRawMessage(this);
+    #else
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            _unknownFields = pb::UnknownFieldSet.MergeFieldFrom(_unknownFields, input);
+            break;
+          case 8: {
+            RollbackCnt = input.ReadInt32();
+            break;
+          }
+          case 16: {
+            MaxRollbackDepth = input.ReadInt32();
+            break;
+          }
+          case 26:
+          case 24: {
+            rollbackDepthHistogram_.AddEntriesFrom(input, _repeated_rollbackDepthHistogram_codec);
+            break;
+          }
+          case 32: {
+            RollbackFromSelfCnt = input.ReadInt32();
+            break;
+          }
+          case 40: {
+            RollbackFromUdpCnt = input.ReadInt32();
+            break;
+          }
+          case 48: {
+            RollbackFromRegulateBeforeRenderCnt = input.ReadInt32();
+            break;
+          }
+          case 56: {
+            ResimulatedRdfCnt = input.ReadInt64();
+            break;
+          }
+          case 64: {
+            ChasingMicros = input.ReadInt64();
+            break;
+          }
+          case 72: {
+            ElapsedMicros = input.ReadInt64();
+            break;
+          }
+          case 82:
+          case 80: {
+            predictedInputCntPerPlayer_.AddEntriesFrom(input, _repeated_predictedInputCntPerPlayer_codec);
+            break;
+          }
+          case 90:
+          case 88: {
+            mispredictedInputCntPerPlayer_.AddEntriesFrom(input, _repeated_mispredictedInputCntPerPlayer_codec);
+            break;
+          }
+        }
+      }
+    #endif
+    }
+
+    #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
+    void pb::IBufferMessage.InternalMergeFrom(ref pb::ParseContext input) {
+      uint tag;
+      while ((tag = input.ReadTag()) != 0) {
+        switch(tag) {
+          default:
+            _unknownFields = pb::UnknownFieldSet.MergeFieldFrom(_unknownFields, ref input);
+            break;
+          case 8: {
+            RollbackCnt = input.ReadInt32();
+            break;
+          }
+          case 16: {
+            MaxRollbackDepth = input.ReadInt32();
+            break;
+          }
+          case 26:
+          case 24: {
+            rollbackDepthHistogram_.AddEntriesFrom(ref input, _repeated_rollbackDepthHistogram_codec);
+            break;
+          }
+          case 32: {
+            RollbackFromSelfCnt = input.ReadInt32();
+            break;
+          }
+          case 40: {
+            RollbackFromUdpCnt = input.ReadInt32();
+            break;
+          }
+          case 48: {
+            RollbackFromRegulateBeforeRenderCnt = input.ReadInt32();
+            break;
+          }
+          case 56: {
+            ResimulatedRdfCnt = input.ReadInt64();
+            break;
+          }
+          case 64: {
+            ChasingMicros = input.ReadInt64();
+            break;
+          }
+          case 72: {
+            ElapsedMicros = input.ReadInt64();
+            break;
+          }
+          case 82:
+          case 80: {
+            predictedInputCntPerPlayer_.AddEntriesFrom(ref input, _repeated_predictedInputCntPerPlayer_codec);
+            break;
+          }
+          case 90:
+          case 88: {
+            mispredictedInputCntPerPlayer_.AddEntriesFrom(ref input, _repeated_mispredictedInputCntPerPlayer_codec);
+            break;
+          }
+        }
+      }
+    }
+    #endif
+
+  }
+
   [global::System.Diagnostics.DebuggerDisplayAttribute("{ToString(),nq}")]
   public sealed partial class BattleResult : pb::IMessage<BattleResult>
   #if !GOOGLE_PROTOBUF_REFSTRUCT_COMPATIBILITY_MODE
@@ -27857,7 +29058,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[34]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[36]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -28092,7 +29293,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[35]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[37]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -28512,7 +29713,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[36]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[38]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -29306,7 +30507,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[37]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[39]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -29689,7 +30890,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[38]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[40]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -29927,7 +31128,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[39]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[41]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -30162,7 +31363,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[40]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[42]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -30511,7 +31712,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[41]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[43]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -30860,7 +32061,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[42]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[44]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -31061,7 +32262,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[43]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[45]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -31518,7 +32719,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[44]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[46]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -31808,7 +33009,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[45]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[47]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -32320,7 +33521,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[46]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[48]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -32570,7 +33771,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[47]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[49]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -33112,7 +34313,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[48]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[50]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -33376,7 +34577,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[49]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[51]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -33688,7 +34889,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[50]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[52]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -33912,7 +35113,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[51]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[53]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -34213,7 +35414,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[52]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[54]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -34674,7 +35875,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[53]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[55]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -34927,7 +36128,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[54]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[56]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -35273,7 +36474,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[55]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[57]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -35656,7 +36857,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[56]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[58]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -36298,7 +37499,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[57]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[59]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -36533,7 +37734,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[58]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[60]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -36790,7 +37991,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[59]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[61]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -37047,7 +38248,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[60]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[62]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -37285,7 +38486,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[61]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[63]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -38472,7 +39673,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[62]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[64]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -39345,7 +40546,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[63]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[65]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -39691,7 +40892,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[64]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[66]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -40000,7 +41201,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[65]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[67]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -40938,7 +42139,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[66]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[68]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -41358,7 +42559,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[67]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[69]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -41889,7 +43090,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[68]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[70]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -42346,7 +43547,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[69]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[71]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -42766,7 +43967,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[70]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[72]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -43112,7 +44313,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[71]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[73]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -49946,7 +51147,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[72]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[74]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -50403,7 +51604,7 @@ namespace jtshared {
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     [global::System.CodeDom.Compiler.GeneratedCode("protoc", null)]
     public static pbr::MessageDescriptor Descriptor {
-      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[73]; }
+      get { return global::jtshared.SerializableDataReflection.Descriptor.MessageTypes[75]; }
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
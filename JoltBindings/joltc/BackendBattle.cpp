@@ -1,4 +1,5 @@
 #include "BackendBattle.h"
+#include <cstring>
 
 bool BackendBattle::ResetStartRdf(char* inBytes, int inBytesCnt) {
     bool res = BaseBattle::ResetStartRdf(inBytes, inBytesCnt);
@@ -8,9 +9,48 @@ bool BackendBattle::ResetStartRdf(char* inBytes, int inBytesCnt) {
 bool BackendBattle::ResetStartRdf(WsReq* initializerMapData) {
     bool res = BaseBattle::ResetStartRdf(initializerMapData);
     dynamicsRdfId = rdfBuffer.GetLast()->id();
+    lastRefRdfId = globalPrimitiveConsts->terminating_render_frame_id();
+    playerAckedRefRdfIds.assign(playersCnt, globalPrimitiveConsts->terminating_render_frame_id());
+    playerChecksumRdfIds.assign(playersCnt, globalPrimitiveConsts->terminating_render_frame_id());
+    playerChecksums.assign(playersCnt, 0);
+    playerFirstDesyncedRdfIds.assign(playersCnt, globalPrimitiveConsts->terminating_render_frame_id());
+    unfitDownsyncBytes.clear();
+    hasCarriedUpsyncInput = false;
     return res;
 }
 
+bool BackendBattle::writeDownsyncSnapshot(DownsyncSnapshot* result, char* outBytesPreallocatedStart, long* outBytesCntLimit) {
+    long byteSize = result->ByteSizeLong();
+    bool fits = (byteSize <= *outBytesCntLimit);
+    if (fits) {
+        result->SerializeToArray(outBytesPreallocatedStart, byteSize);
+    } else {
+        JPH_ASSERT(unfitDownsyncBytes.empty()); // [WARNING] The previously kept one MUST have been taken by far, otherwise the order of generation is broken.
+        unfitDownsyncBytes.resize(byteSize);
+        result->SerializeToArray(unfitDownsyncBytes.data(), byteSize);
+#ifndef NDEBUG
+        std::ostringstream oss;
+        oss << "writeDownsyncSnapshot/C++ kept unfit DownsyncSnapshot of byteSize=" << byteSize << " > outBytesCntLimit=" << *outBytesCntLimit << ", st_ifd_id=" << result->st_ifd_id() << ", ifd_batch_size=" << result->ifd_batch_size();
+        Debug::Log(oss.str(), DColor::Orange);
+#endif
+    }
+    *outBytesCntLimit = byteSize;
+    releaseDownsyncSnapshotArenaOwnership(result);
+    return fits;
+}
+
+bool BackendBattle::TakeUnfitDownsyncSnapshot(char* outBytesPreallocatedStart, long* outBytesCntLimit) {
+    long byteSize = (long)unfitDownsyncBytes.size();
+    if (0 >= byteSize || byteSize > *outBytesCntLimit) {
+        *outBytesCntLimit = byteSize;
+        return false;
+    }
+    memcpy(outBytesPreallocatedStart, unfitDownsyncBytes.data(), byteSize);
+    *outBytesCntLimit = byteSize;
+    unfitDownsyncBytes.clear();
+    return true;
+}
+
 void BackendBattle::produceDownsyncSnapshot(uint64_t unconfirmedMask, int stIfdId, int edIfdId, bool withRefRdf, DownsyncSnapshot** pOutResult) {
     JPH_ASSERT(stIfdId >= ifdBuffer.StFrameId);
     JPH_ASSERT(edIfdId <= ifdBuffer.EdFrameId);
@@ -25,7 +65,13 @@ void BackendBattle::produceDownsyncSnapshot(uint64_t unconfirmedMask, int stIfdI
             JPH_ASSERT(!downsyncSnapshotHolder->has_ref_rdf()); // [WARNING] Must have been released by far
             downsyncSnapshotHolder->set_ref_rdf_id(dynamicsRdfId); // [WARNING] Unlike [DLLMU-v2.3.4](https://github.com/genxium/DelayNoMoreUnity/blob/v2.3.4/backend/Battle/Room.cs#L1248), we're only sure that "dynamicsRdfId" exists in "rdfBuffer" in the extreme case of "StFrameId eviction upon DryPut()". Moreover the use of "DownsyncSnapshot.ref_rdf" is de-coupled from "DownsyncSnapshot.ifd_batch", i.e. no need to guarantee that "DownsyncSnapshot.ref_rdf" is using one of "DownsyncSnapshot.ifd_batch" for frontend. 
 
-            downsyncSnapshotHolder->unsafe_arena_set_allocated_ref_rdf(refRdf); // [WARNING] Intentionally avoids memory copy in all possible cases.
+            const RenderFrame* baseRdf = refRdfDeltaEnabled ? findRefRdfDeltaBase(inactiveJoinMask.load()) : nullptr;
+            if (nullptr != baseRdf && EncodeRdfDelta(baseRdf, refRdf, refRdfDeltaHolder)) {
+                downsyncSnapshotHolder->unsafe_arena_set_allocated_ref_rdf_delta(refRdfDeltaHolder);
+            } else {
+                downsyncSnapshotHolder->unsafe_arena_set_allocated_ref_rdf(refRdf); // [WARNING] Intentionally avoids memory copy in all possible cases.
+            }
+            lastRefRdfId = dynamicsRdfId;
         }
         *pOutResult = downsyncSnapshotHolder; 
     }
@@ -36,10 +82,22 @@ void BackendBattle::produceDownsyncSnapshot(uint64_t unconfirmedMask, int stIfdI
     }
 }
 
+const RenderFrame* BackendBattle::findRefRdfDeltaBase(uint64_t inactiveJoinMaskVal) {
+    if (globalPrimitiveConsts->terminating_render_frame_id() == lastRefRdfId) return nullptr;
+    for (int i = 0; i < (int)playerAckedRefRdfIds.size(); i++) {
+        if (0 < (inactiveJoinMaskVal & CalcJoinIndexMask(i + 1))) continue;
+        if (lastRefRdfId != playerAckedRefRdfIds[i]) return nullptr;
+    }
+    return rdfBuffer.GetByFrameId(lastRefRdfId); // Might've been evicted
+}
+
 void BackendBattle::releaseDownsyncSnapshotArenaOwnership(DownsyncSnapshot* downsyncSnapshot) {
     if (downsyncSnapshot->has_ref_rdf()) {
         downsyncSnapshot->unsafe_arena_release_ref_rdf(); // There's no need to duplicate just for returning an unused local variable, I have the pointer I need in "rdfBuffer"
     }
+    if (downsyncSnapshot->has_ref_rdf_delta()) {
+        downsyncSnapshot->unsafe_arena_release_ref_rdf_delta(); // Owned by "refRdfDeltaHolder"
+    }
     google::protobuf::RepeatedPtrField<InputFrameDownsync>* mutableIfdBatch = downsyncSnapshot->mutable_ifd_batch();
     while (!mutableIfdBatch->empty()) {
         mutableIfdBatch->UnsafeArenaReleaseLast();
@@ -64,6 +122,14 @@ bool BackendBattle::OnUpsyncSnapshotReceived(const uint32_t peerJoinIndex, const
     *outOldDynamicsRdfId = dynamicsRdfId;
     *outNewLcacIfdId = lcacIfdId;
     *outNewDynamicsRdfId = dynamicsRdfId;
+    if (0 < peerJoinIndex && peerJoinIndex <= playerAckedRefRdfIds.size() && upsyncSnapshot.acked_ref_rdf_id() > playerAckedRefRdfIds[peerJoinIndex - 1]) {
+        playerAckedRefRdfIds[peerJoinIndex - 1] = upsyncSnapshot.acked_ref_rdf_id();
+    }
+    if (0 < peerJoinIndex && peerJoinIndex <= playerChecksumRdfIds.size() && upsyncSnapshot.checksum_rdf_id() > playerChecksumRdfIds[peerJoinIndex - 1]) {
+        playerChecksumRdfIds[peerJoinIndex - 1] = upsyncSnapshot.checksum_rdf_id();
+        playerChecksums[peerJoinIndex - 1] = upsyncSnapshot.checksum();
+        comparePlayerChecksumIfApplicable(peerJoinIndex - 1);
+    }
     bool isTooAdvanced = (ifdBuffer.StFrameId + ifdBuffer.N + globalPrimitiveConsts->upsync_st_ifd_id_tolerance()) < (upsyncSnapshot.st_ifd_id()); // When "ifdBuffer" is not full, we have "ifdBuffer.StFrameId + ifdBuffer.N >= ifdBuffer.EdFrameId"  
     if (isTooAdvanced) {
         *outBytesCntLimit = 0;
@@ -90,6 +156,10 @@ bool BackendBattle::OnUpsyncSnapshotReceived(const uint32_t peerJoinIndex, const
         [WARNING/BACKEND] it's maintained that "lcacIfdId + 1 >= ifdBuffer.StFrameId", hence "ifdId > lcacIfdId" implies that "ifdId >= ifdBuffer.StFrameId", no need to check. 
         */
         bool willEvictSt = (ifdId >= ifdBuffer.StFrameId + ifdBuffer.N);
+        if (willEvictSt && lcacIfdId + 1 < ifdId - ifdBuffer.N + 1 && tryGrowIfdBuffer(ifdId - ifdBuffer.StFrameId + 1)) {
+            // Only grows when eviction would otherwise drag "lcacIfdId" forward, i.e. force confirmation.
+            willEvictSt = false;
+        }
         if (willEvictSt) {
             int toEvictCnt = (ifdId - ifdBuffer.StFrameId - ifdBuffer.N + 1);
             JPH_ASSERT(1 == toEvictCnt || (1 < toEvictCnt && 0 == i)); // The only case where "1 < toEvictCnt" MUST come with "0 == i". 
@@ -163,9 +233,9 @@ bool BackendBattle::OnUpsyncSnapshotReceived(const uint32_t peerJoinIndex, const
 /*
 #ifndef NDEBUG
         if (frontsUpdated) {
-            Debug::Log("OnUpsyncSnapshotReceived/C++ playerInputFrontIds[" + std::to_string(peerJoinIndexArrIdx) + "] is updated to " + std::to_string(ifdId) + ", playerInputFrontIdsSorted.size=" + std::to_string(playerInputFrontIdsSorted.size()), DColor::Orange);
+            Debug::Log("OnUpsyncSnapshotReceived/C++ playerInputFrontIds[" + std::to_string(peerJoinIndexArrIdx) + "] is updated to " + std::to_string(ifdId) + ", playerInputFrontIdsUpdatedMask=" + std::to_string(playerInputFrontIdsUpdatedMask), DColor::Orange);
         } else {
-            Debug::Log("OnUpsyncSnapshotReceived/C++ playerInputFrontIds[" + std::to_string(peerJoinIndexArrIdx) + "] NOT updated for ifdId=" + std::to_string(ifdId) + ", origIfdId=" + std::to_string(playerInputFrontIds[peerJoinIndexArrIdx]) + ", playerInputFrontIdsSorted.size=" + std::to_string(playerInputFrontIdsSorted.size()), DColor::Orange);
+            Debug::Log("OnUpsyncSnapshotReceived/C++ playerInputFrontIds[" + std::to_string(peerJoinIndexArrIdx) + "] NOT updated for ifdId=" + std::to_string(ifdId) + ", origIfdId=" + std::to_string(playerInputFrontIds[peerJoinIndexArrIdx]) + ", playerInputFrontIdsUpdatedMask=" + std::to_string(playerInputFrontIdsUpdatedMask), DColor::Orange);
         }
 #endif
 */
@@ -183,12 +253,12 @@ bool BackendBattle::OnUpsyncSnapshotReceived(const uint32_t peerJoinIndex, const
         JPH_ASSERT(lcacIfdId+1 >= ifdBuffer.StFrameId); // A backend-specific constraint.
     }
 
-    if (!playerInputFrontIdsSorted.empty()) {
-        *outMaxPlayerInputFrontId = *playerInputFrontIdsSorted.rbegin();
-        *outMinPlayerInputFrontId = *playerInputFrontIdsSorted.begin();
+    if (0 != playerInputFrontIdsUpdatedMask) {
+        *outMaxPlayerInputFrontId = maxPlayerInputFrontId;
+        *outMinPlayerInputFrontId = minPlayerInputFrontId;
 /*
 #ifndef NDEBUG
-        Debug::Log("OnUpsyncSnapshotReceived/C++ updated maxPlayerInputFrontId=" + std::to_string(*outMaxPlayerInputFrontId) + ", minPlayerInputFrontId=" + std::to_string(*outMinPlayerInputFrontId) + " after handling with playerInputFrontIdsSorted.size=" + std::to_string(playerInputFrontIdsSorted.size()), DColor::Orange);
+        Debug::Log("OnUpsyncSnapshotReceived/C++ updated maxPlayerInputFrontId=" + std::to_string(*outMaxPlayerInputFrontId) + ", minPlayerInputFrontId=" + std::to_string(*outMinPlayerInputFrontId) + " after handling with playerInputFrontIdsUpdatedMask=" + std::to_string(playerInputFrontIdsUpdatedMask), DColor::Orange);
 #endif
 */
     }
@@ -206,14 +276,9 @@ bool BackendBattle::OnUpsyncSnapshotReceived(const uint32_t peerJoinIndex, const
     *outNewDynamicsRdfId = dynamicsRdfId;
 
     if (nullptr != result) {
-        long byteSize = result->ByteSizeLong();
-        if (byteSize > *outBytesCntLimit) {
-            releaseDownsyncSnapshotArenaOwnership(result);
-            return false;
+        if (!writeDownsyncSnapshot(result, outBytesPreallocatedStart, outBytesCntLimit)) {
+            return false; // [WARNING] The upsync itself is still applied, see "TakeUnfitDownsyncSnapshot".
         }
-        *outBytesCntLimit = byteSize;
-        result->SerializeToArray(outBytesPreallocatedStart, byteSize);
-        releaseDownsyncSnapshotArenaOwnership(result);
     } else {
         *outBytesCntLimit = 0;
     }
@@ -257,6 +322,9 @@ int BackendBattle::Step(int fromRdfId, int toRdfId, DownsyncSnapshot* virtualIfd
             WriteSingleStepFrameLog(currRdfId, nextRdf, delayedIfdId, delayedIfd);
         }
         dynamicsRdfId = currRdfId + 1;
+        for (int i = 0; i < (int)playerChecksumRdfIds.size(); i++) {
+            comparePlayerChecksumIfApplicable(i);
+        }
         auto* stepResult = stepResultBuffer.GetByFrameId(dynamicsRdfId); 
         if (isBattleSettled(stepResult)) {
             return nextRdf->id();
@@ -265,6 +333,30 @@ int BackendBattle::Step(int fromRdfId, int toRdfId, DownsyncSnapshot* virtualIfd
     return toRdfId;
 }
 
+void BackendBattle::comparePlayerChecksumIfApplicable(int playerArrIdx) {
+    int checksumRdfId = playerChecksumRdfIds[playerArrIdx];
+    if (globalPrimitiveConsts->terminating_render_frame_id() == checksumRdfId || checksumRdfId > dynamicsRdfId) {
+        return;
+    }
+    playerChecksumRdfIds[playerArrIdx] = globalPrimitiveConsts->terminating_render_frame_id(); // Consumed
+    const RenderFrame* rdf = rdfBuffer.GetByFrameId(checksumRdfId);
+    if (nullptr == rdf) {
+        return; // Already evicted, nothing to compare against
+    }
+    if (rdf->checksum() == playerChecksums[playerArrIdx]) {
+        return;
+    }
+    int& firstDesyncedRdfId = playerFirstDesyncedRdfIds[playerArrIdx];
+    if (globalPrimitiveConsts->terminating_render_frame_id() == firstDesyncedRdfId || checksumRdfId < firstDesyncedRdfId) {
+        firstDesyncedRdfId = checksumRdfId;
+    }
+#ifndef NDEBUG
+    std::ostringstream oss;
+    oss << "@dynamicsRdfId=" << dynamicsRdfId << ", @lcacIfdId=" << lcacIfdId << ", checksum mismatch from joinIndex=" << (playerArrIdx + 1) << " at rdfId=" << checksumRdfId << ": reported=" << playerChecksums[playerArrIdx] << ", backend=" << rdf->checksum() << ", firstDesyncedRdfId=" << firstDesyncedRdfId;
+    Debug::Log(oss.str(), DColor::Orange);
+#endif
+}
+
 int BackendBattle::MoveForwardLcacIfdIdAndStep(bool withRefRdf, int* outOldLcacIfdId, int* outNewLcacIfdId, int* outOldDynamicsRdfId, int* outNewDynamicsRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit) {
     uint64_t inactiveJoinMaskVal = inactiveJoinMask.load();
     *outOldDynamicsRdfId = dynamicsRdfId;
@@ -292,15 +384,7 @@ int BackendBattle::MoveForwardLcacIfdIdAndStep(bool withRefRdf, int* outOldLcacI
         uint64_t unconfirmedMask = inactiveJoinMaskVal;
         DownsyncSnapshot* result = nullptr;
         produceDownsyncSnapshot(unconfirmedMask, oldLcacIfdId + 1, lcacIfdId + 1, withRefRdf, &result);
-
-        long byteSize = result->ByteSizeLong();
-        if (byteSize > *outBytesCntLimit) {
-            releaseDownsyncSnapshotArenaOwnership(result);
-            return stoppedAtRdfId;
-        }
-        *outBytesCntLimit = byteSize;
-        result->SerializeToArray(outBytesPreallocatedStart, byteSize);
-        releaseDownsyncSnapshotArenaOwnership(result);
+        writeDownsyncSnapshot(result, outBytesPreallocatedStart, outBytesCntLimit); // If unfit, "*outBytesCntLimit" becomes larger than passed in and the caller should "TakeUnfitDownsyncSnapshot"
 
         return stoppedAtRdfId;
     } else {
@@ -309,6 +393,107 @@ int BackendBattle::MoveForwardLcacIfdIdAndStep(bool withRefRdf, int* outOldLcacI
     }
 }
 
+bool BackendBattle::EnqueueUpsyncInput(uint32_t joinIndex, int ifdId, uint64_t input, bool fromUdp, bool fromTcp) {
+    if (0 >= joinIndex) return false;
+    UpsyncInput single = { joinIndex, ifdId, input, fromUdp, fromTcp };
+    return upsyncInputQue.Push_ThreadSafe(single);
+}
+
+long BackendBattle::flushDrainedUpsyncInputs(uint32_t joinIndex, bool fromUdp, bool fromTcp, char* outBytesPreallocatedStart, long outBytesCntLimit) {
+    const long headerSize = (long)sizeof(int32_t);
+    long bytesCnt = (outBytesCntLimit > headerSize ? outBytesCntLimit - headerSize : 0);
+    int forceConfirmedStEvictedCnt = 0, oldLcacIfdId = -1, newLcacIfdId = -1, oldDynamicsRdfId = -1, newDynamicsRdfId = -1, maxPlayerInputFrontId = -1, minPlayerInputFrontId = -1;
+    // [WARNING] A produced "DownsyncSnapshot" which doesn't fit into "bytesCnt" is kept in "unfitDownsyncBytes" by "OnUpsyncSnapshotReceived", in which case nothing is written here and "DrainUpsyncInputs" MUST stop.
+    bool res = OnUpsyncSnapshotReceived(joinIndex, *drainedUpsyncHolder, fromUdp, fromTcp, outBytesPreallocatedStart + headerSize, &bytesCnt, &forceConfirmedStEvictedCnt, &oldLcacIfdId, &newLcacIfdId, &oldDynamicsRdfId, &newDynamicsRdfId, &maxPlayerInputFrontId, &minPlayerInputFrontId);
+    drainedUpsyncHolder->clear_cmd_list();
+    if (!res || 0 >= bytesCnt) {
+        return 0;
+    }
+    int32_t header = (int32_t)bytesCnt;
+    memcpy(outBytesPreallocatedStart, &header, headerSize);
+    return headerSize + bytesCnt;
+}
+
+int BackendBattle::DrainUpsyncInputs(char* outBytesPreallocatedStart, long* outBytesCntLimit) {
+    if (0 < GetUnfitDownsyncSnapshotSize()) {
+        // [WARNING] The kept "DownsyncSnapshot" MUST be taken first, otherwise the order of generation is broken.
+        *outBytesCntLimit = 0;
+        return 0;
+    }
+    long written = 0;
+    int drainedCnt = 0;
+    bool hasPending = false;
+    UpsyncInput pending = { 0, 0, 0, false, false }; // The head of the batch being merged in "drainedUpsyncHolder"
+    UpsyncInput single;
+    int poppedCnt = 0; // Bounded by "cUpsyncInputQueCapacity" per call, otherwise a producer enqueuing as fast as we pop would keep this call (and "inputBufferLock" of "BackendRoomHost") busy forever
+
+    drainedUpsyncHolder->Clear();
+    drainedUpsyncHolder->set_acked_ref_rdf_id(globalPrimitiveConsts->terminating_render_frame_id());
+    drainedUpsyncHolder->set_checksum_rdf_id(globalPrimitiveConsts->terminating_render_frame_id());
+
+    while (true) {
+        if (hasCarriedUpsyncInput) {
+            single = carriedUpsyncInput;
+            hasCarriedUpsyncInput = false;
+        } else if (cUpsyncInputQueCapacity <= poppedCnt || !upsyncInputQue.Pop_NotThreadSafe(single)) {
+            break;
+        } else {
+            ++poppedCnt;
+        }
+        bool extendsPending = hasPending && single.joinIndex == pending.joinIndex && single.fromUdp == pending.fromUdp && single.fromTcp == pending.fromTcp && single.ifdId == (pending.ifdId + drainedUpsyncHolder->cmd_list_size());
+        if (extendsPending) {
+            drainedUpsyncHolder->add_cmd_list(single.input);
+            continue;
+        }
+        if (hasPending) {
+            drainedCnt += drainedUpsyncHolder->cmd_list_size();
+            written += flushDrainedUpsyncInputs(pending.joinIndex, pending.fromUdp, pending.fromTcp, outBytesPreallocatedStart + written, *outBytesCntLimit - written);
+            hasPending = false;
+            if (0 < GetUnfitDownsyncSnapshotSize()) {
+                // "single" is popped but not yet applied, thus carried to the next call.
+                carriedUpsyncInput = single;
+                hasCarriedUpsyncInput = true;
+                break;
+            }
+        }
+        pending = single;
+        hasPending = true;
+        drainedUpsyncHolder->set_st_ifd_id(single.ifdId);
+        drainedUpsyncHolder->add_cmd_list(single.input);
+    }
+
+    if (hasPending) {
+        drainedCnt += drainedUpsyncHolder->cmd_list_size();
+        written += flushDrainedUpsyncInputs(pending.joinIndex, pending.fromUdp, pending.fromTcp, outBytesPreallocatedStart + written, *outBytesCntLimit - written);
+    }
+    *outBytesCntLimit = written;
+    return drainedCnt;
+}
+
+int BackendBattle::calcGrownIfdBufferSize(int requiredN) {
+    int proposed = ifdBuffer.N;
+    while (proposed < requiredN && proposed < ifdBufferSizeCap) {
+        proposed <<= 1;
+    }
+    return (proposed > ifdBufferSizeCap ? ifdBufferSizeCap : proposed);
+}
+
+bool BackendBattle::tryGrowIfdBuffer(int requiredN) {
+#ifndef NDEBUG
+    int oldN = ifdBuffer.N;
+#endif
+    int newN = calcGrownIfdBufferSize(requiredN);
+    if (newN < requiredN || !ifdBuffer.Reserve(newN)) {
+        return false;
+    }
+#ifndef NDEBUG
+    std::ostringstream oss;
+    oss << "@dynamicsRdfId=" << dynamicsRdfId << ", @lcacIfdId=" << lcacIfdId << ", ifdBuffer grown from N=" << oldN << " to N=" << ifdBuffer.N << " for requiredN=" << requiredN << ", ifdBufferSizeCap=" << ifdBufferSizeCap << ", " << ifdBuffer.toSimpleStat();
+    Debug::Log(oss.str(), DColor::Orange);
+#endif
+    return true;
+}
+
 int BackendBattle::GetDynamicsRdfId() {
     return dynamicsRdfId;
 }
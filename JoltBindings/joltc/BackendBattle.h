@@ -2,6 +2,7 @@
 #define BACKEND_BATTLE_H_ 1
 
 #include "BaseBattle.h"
+#include "UpsyncInputQueue.h"
 #ifndef NDEBUG
 #include "DebugLog.h"
 #endif
@@ -10,15 +11,17 @@ using namespace JPH;
 
 class JOLTC_EXPORT BackendBattle : public BaseBattle {
 public:
-    BackendBattle(int renderBufferSize, int inputBufferSize, TempAllocator* inGlobalTempAllocator) : BaseBattle(renderBufferSize, inputBufferSize, inGlobalTempAllocator, BackendBattle::ArenaAllocStepResult)  {
+    BackendBattle(int renderBufferSize, int inputBufferSize, TempAllocator* inGlobalTempAllocator, int nBytesForOwnTempAllocator = 0, JobSystemThreadPool* inSharedJobSys = nullptr) : BaseBattle(renderBufferSize, inputBufferSize, inGlobalTempAllocator, nBytesForOwnTempAllocator, BackendBattle::ArenaAllocStepResult), upsyncInputQue(cUpsyncInputQueCapacity)  {
         downsyncSnapshotHolder = google::protobuf::Arena::Create<DownsyncSnapshot>(&pbSemiPermAllocator);
         wsReqHolder = google::protobuf::Arena::Create<WsReq>(&pbSemiPermAllocator);
+        drainedUpsyncHolder = google::protobuf::Arena::Create<UpsyncSnapshot>(&pbSemiPermAllocator);
 
         JPH_ASSERT (nullptr != downsyncSnapshotHolder->GetArena()); // [WARNING] Otherwise too inefficient in memory usage, e.g. when calling "unsafe_arena_set_allocated_xxx" would "delete" existing field first
         JPH_ASSERT(nullptr != wsReqHolder->GetArena()); // [WARNING] Otherwise too inefficient in memory usage, e.g. when calling "unsafe_arena_set_allocated_xxx" would "delete" existing field first
+        refRdfDeltaHolder = new RenderFrameDelta(); // [WARNING] Intentionally NOT on "pbSemiPermAllocator", because the "changed" entities are cleared and refilled upon every use, which would otherwise leak nested messages (e.g. "CharacterDownsync") onto the arena till the end of battle.
 
         allocPhySys();
-        jobSys = new JobSystemThreadPool(cMaxPhysicsJobs, cMaxPhysicsBarriers, thread::hardware_concurrency() - 1);
+        allocJobSys(inSharedJobSys);
     }
 
     virtual ~BackendBattle() {
@@ -29,6 +32,13 @@ public:
         if (nullptr != wsReqHolder) {
             wsReqHolder = nullptr;
         }
+        if (nullptr != drainedUpsyncHolder) {
+            drainedUpsyncHolder = nullptr;
+        }
+        if (nullptr != refRdfDeltaHolder) {
+            delete refRdfDeltaHolder;
+            refRdfDeltaHolder = nullptr;
+        }
 #ifndef NDEBUG
         Debug::Log("~BackendBattle/C++", DColor::Green);
 #endif
@@ -40,11 +50,41 @@ public:
     int lastForceResyncedRdfId;
     int nstDelayFrames;
 
+    /*
+    [REMINDER] When "refRdfDeltaEnabled", "produceDownsyncSnapshot" attaches "ref_rdf_delta" against "lastRefRdfId" instead of a full "ref_rdf", but only if every active player has acknowledged "lastRefRdfId" via "UpsyncSnapshot.acked_ref_rdf_id" -- the same "DownsyncSnapshot" is broadcasted to all players, thus its base MUST be held by all of them.
+    */
+    bool refRdfDeltaEnabled = false;
+    int lastRefRdfId = globalPrimitiveConsts->terminating_render_frame_id();
+    std::vector<int> playerAckedRefRdfIds;
+
+    /*
+    [REMINDER] Each player reports "UpsyncSnapshot.checksum" of its latest "RenderFrame" calculated from all-confirmed inputs, which is kept pending in "playerChecksumRdfIds & playerChecksums" till "dynamicsRdfId" reaches it, then compared against "RenderFrame.checksum" of the backend counterpart. The earliest mismatched "rdfId" per player is kept in "playerFirstDesyncedRdfIds" (or "terminating_render_frame_id" if none) to help localizing the desync, e.g. by "APP_GetFrameLog" around it.
+    */
+    std::vector<int> playerChecksumRdfIds;
+    std::vector<uint64_t> playerChecksums;
+    std::vector<int> playerFirstDesyncedRdfIds;
+
+    /*
+    [REMINDER] When an incoming "ifdId" would evict "ifdBuffer.StFrameId" while "lcacIfdId" is still behind it (i.e. some player lags by more than "ifdBuffer.N" input frames), "OnUpsyncSnapshotReceived" first asks "calcGrownIfdBufferSize" for a larger "ifdBuffer" before falling back to force-confirming with virtual ifds. The default policy doubles "ifdBuffer.N" up to "ifdBufferSizeCap", and "ifdBufferSizeCap <= ifdBuffer.N" (e.g. the default 0) disables growing. The grown size is kept till the battle is destroyed, i.e. rooms can start with small buffers and only pay for a larger one under sustained lag.
+    */
+    int ifdBufferSizeCap = 0;
+
 public:
     bool OnUpsyncSnapshotReqReceived(char* inBytes, int inBytesCnt, bool fromUdp, bool fromTcp, char* outBytesPreallocatedStart, long* outBytesCntLimit, int* outForceConfirmedStEvictedCnt, int* outOldLcacIfdId, int* outNewLcacIfdId, int* outOldDynamicsRdfId, int* outNewDynamicsRdfId, int* outMaxPlayerInputFrontId, int* outMinPlayerInputFrontId);
 
     bool OnUpsyncSnapshotReceived(const uint32_t peerJoinIndex, const UpsyncSnapshot& upsyncSnapshot, bool fromUdp, bool fromTcp, char* outBytesPreallocatedStart, long* outBytesCntLimit, int* outForceConfirmedStEvictedCnt, int* outOldLcacIfdId, int* outNewLcacIfdId, int* outOldDynamicsRdfId, int* outNewDynamicsRdfId, int* outMaxPlayerInputFrontId, int* outMinPlayerInputFrontId);
 
+    /*
+    [REMINDER] A lock-free alternative to "OnUpsyncSnapshotReceived" for servers with many I/O threads per battle.
+
+    - "EnqueueUpsyncInput" can be called from any I/O thread concurrently without locking, it returns false when "upsyncInputQue" is full, in which case the caller should fall back to the locked "OnUpsyncSnapshotReqReceived" path (or retry later).
+    - "DrainUpsyncInputs" MUST only be called by the stepping thread, i.e. the one calling "MoveForwardLcacIfdIdAndStep", right before "MoveForwardLcacIfdIdAndStep". Consecutive entries of the same "(joinIndex, fromUdp, fromTcp)" with consecutive "ifdId"s are merged into a single "UpsyncSnapshot" before being applied by "OnUpsyncSnapshotReceived".
+
+    Any "DownsyncSnapshot" produced while applying the drained entries is written into "outBytesPreallocatedStart" as "[int32_t bytesCnt][bytesCnt bytes]" in native byte order and in the order of generation, "*outBytesCntLimit" is set to the total bytes written. Once a produced "DownsyncSnapshot" doesn't fit into the remaining space, the draining stops right after it (the popped-but-unapplied entry is carried to the next call), and that "DownsyncSnapshot" is kept for "TakeUnfitDownsyncSnapshot", i.e. it comes after all written ones and MUST be taken before the next call (otherwise the next call drains nothing). At most "cUpsyncInputQueCapacity" entries are popped per call. The caller should keep calling it until it returns 0 (i.e. the count of applied entries), or until its own bound of rounds (e.g. "BackendRoomHost::cMaxDrainRoundsPerStep") is reached, the remaining entries are then drained by the next round of stepping.
+    */
+    bool EnqueueUpsyncInput(uint32_t joinIndex, int ifdId, uint64_t input, bool fromUdp, bool fromTcp);
+    int DrainUpsyncInputs(char* outBytesPreallocatedStart, long* outBytesCntLimit);
+
     bool WriteSingleStepFrameLog(int currRdfId, RenderFrame* nextRdf, int delayedIfdId, InputFrameDownsync* delayedIfd);
     int Step(int fromRdfId, int toRdfId, DownsyncSnapshot* virtualIfds = nullptr);
     int MoveForwardLcacIfdIdAndStep(bool withRefRdf, int* outOldLcacIfdId, int* outNewLcacIfdId, int* outOldDynamicsRdfId, int* outNewDynamicsRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit);
@@ -54,6 +94,32 @@ public:
 
     int GetDynamicsRdfId();
 
+    /*
+    [REMINDER] A produced "DownsyncSnapshot" which doesn't fit into "outBytesCntLimit" of "OnUpsyncSnapshotReceived" or "MoveForwardLcacIfdIdAndStep" is NEVER dropped, because its inputs are already confirmed and "lcacIfdId/dynamicsRdfId" already advanced by then, i.e. dropping it would leave a permanent gap in the broadcasted ifds. Instead it's kept in "unfitDownsyncBytes" and "*outBytesCntLimit" is set to its (larger) size, the caller MUST fetch it by "TakeUnfitDownsyncSnapshot" with a large enough buffer before the next call that might produce another "DownsyncSnapshot".
+    */
+    bool TakeUnfitDownsyncSnapshot(char* outBytesPreallocatedStart, long* outBytesCntLimit); // Returns false if there's none or "*outBytesCntLimit" is still insufficient, in both cases "*outBytesCntLimit" is set to the size of the kept one (or 0 if none)
+
+    inline long GetUnfitDownsyncSnapshotSize() const {
+        return (long)unfitDownsyncBytes.size();
+    }
+
+    inline int GetFirstDesyncedRdfId(uint32_t joinIndex) {
+        if (0 == joinIndex || joinIndex > playerFirstDesyncedRdfIds.size()) return globalPrimitiveConsts->terminating_render_frame_id();
+        return playerFirstDesyncedRdfIds[joinIndex - 1];
+    }
+
+    inline int SetIfdBufferSizeCap(int val) {
+        int oldVal = ifdBufferSizeCap;
+        ifdBufferSizeCap = val;
+        return oldVal;
+    }
+
+    inline bool SetRefRdfDeltaEnabled(bool val) {
+        bool oldVal = refRdfDeltaEnabled;
+        refRdfDeltaEnabled = val;
+        return oldVal;
+    }
+
     static inline StepResult* ArenaAllocStepResult(google::protobuf::Arena* theAllocator) {
         auto* stepResult = google::protobuf::Arena::Create<StepResult>(theAllocator);
         // Don't preallocate aiming rays for backend
@@ -63,8 +129,23 @@ public:
 protected:
     void produceDownsyncSnapshot(uint64_t unconfirmedMask, int stIfdId, int edIfdId, bool withRefRdf, DownsyncSnapshot** outResult);
     void releaseDownsyncSnapshotArenaOwnership(DownsyncSnapshot* downsyncSnapshot);
+    bool writeDownsyncSnapshot(DownsyncSnapshot* result, char* outBytesPreallocatedStart, long* outBytesCntLimit); // Always releases arena ownership of "result" and sets "*outBytesCntLimit" to its byte size, returns false if it's kept in "unfitDownsyncBytes" instead
+    std::vector<char> unfitDownsyncBytes;
     DownsyncSnapshot* downsyncSnapshotHolder = nullptr;
     WsReq* wsReqHolder = nullptr;
+    RenderFrameDelta* refRdfDeltaHolder = nullptr;
+
+    static constexpr int cUpsyncInputQueCapacity = 1024;
+    UpsyncInputQueue_ThreadSafe upsyncInputQue;
+    UpsyncSnapshot* drainedUpsyncHolder = nullptr;
+    bool hasCarriedUpsyncInput = false;
+    UpsyncInput carriedUpsyncInput = { 0, 0, 0, false, false }; // Popped by "DrainUpsyncInputs" but not yet applied due to an unfit "DownsyncSnapshot"
+    long flushDrainedUpsyncInputs(uint32_t joinIndex, bool fromUdp, bool fromTcp, char* outBytesPreallocatedStart, long outBytesCntLimit); // Returns the count of bytes written, including the "[int32_t bytesCnt]" header
+    const RenderFrame* findRefRdfDeltaBase(uint64_t inactiveJoinMaskVal);
+    void comparePlayerChecksumIfApplicable(int playerArrIdx);
+
+    virtual int calcGrownIfdBufferSize(int requiredN); // Returns the proposed new "ifdBuffer.N", growing is rejected if it's less than "requiredN"
+    bool tryGrowIfdBuffer(int requiredN);
 
     virtual bool allocPhySys() override {
         if (nullptr != phySys) return false;
@@ -0,0 +1,183 @@
+#include "BackendRoomHost.h"
+#include <cstring>
+
+BackendRoomHost::BackendRoomHost(int inMaxRoomsCnt, int nWorkers, int inRdfBufferSize, int inNBytesForTempAllocatorPerRoom, int inDownsyncBytesCntLimitPerRoom, TempAllocator* inGlobalTempAllocator, JobSystemThreadPool* inSharedJobSys) : maxRoomsCnt(inMaxRoomsCnt), rdfBufferSize(inRdfBufferSize), nBytesForTempAllocatorPerRoom(inNBytesForTempAllocatorPerRoom), downsyncBytesCntLimitPerRoom(inDownsyncBytesCntLimitPerRoom), globalTempAllocator(inGlobalTempAllocator), sharedJobSys(inSharedJobSys) {
+    if (0 >= nWorkers) {
+        nWorkers = thread::hardware_concurrency() - 1;
+    }
+    roomJobSys = new JobSystemThreadPool(GetNextPowerOf2((uint32)maxRoomsCnt), 1, nWorkers); // [WARNING] "inMaxJobs" MUST be a power of 2 for "FixedSizeFreeList". Only 1 barrier is used, i.e. within "StepAll(...)"
+    rooms.assign(maxRoomsCnt, nullptr);
+    roomsCnt = 0;
+}
+
+BackendRoomHost::~BackendRoomHost() {
+    // [WARNING] Rooms MUST be destroyed before "roomJobSys", and the caller MUST guarantee that no "StepAll(...)" is running.
+    int cnt = roomsCnt.load();
+    for (int roomId = 0; roomId < cnt; ++roomId) {
+        Room* room = rooms[roomId];
+        if (nullptr == room) continue;
+        delete room->battle;
+        room->battle = nullptr;
+        delete room;
+        rooms[roomId] = nullptr;
+    }
+    roomsCnt = 0;
+    delete roomJobSys;
+    roomJobSys = nullptr;
+#ifndef NDEBUG
+    Debug::Log("~BackendRoomHost/C++", DColor::Green);
+#endif
+}
+
+int BackendRoomHost::AddRoom(char* inBytes, int inBytesCnt) {
+    int roomId = roomsCnt.load();
+    if (roomId >= maxRoomsCnt) return -1;
+    if (0 >= nBytesForTempAllocatorPerRoom) return -1; // [WARNING] Rooms are stepped concurrently, thus MUST NOT share "globalTempAllocator".
+    BackendBattle* battle = new BackendBattle(rdfBufferSize, globalPrimitiveConsts->default_backend_input_buffer_size(), globalTempAllocator, nBytesForTempAllocatorPerRoom, sharedJobSys);
+    if (!battle->ResetStartRdf(inBytes, inBytesCnt)) {
+        delete battle;
+        return -1;
+    }
+    rooms[roomId] = new Room(battle, downsyncBytesCntLimitPerRoom);
+    roomsCnt.store(roomId + 1); // [WARNING] Published only after "rooms[roomId]" is fully set.
+    return roomId;
+}
+
+BackendBattle* BackendRoomHost::GetRoomBattle(int roomId) {
+    if (0 > roomId || roomId >= roomsCnt.load()) return nullptr;
+    return rooms[roomId]->battle;
+}
+
+void BackendRoomHost::appendToOutbox(Room* room, int roomId, const char* bytes, long bytesCnt) {
+    // [WARNING] This function MUST BE called while "room->inputBufferLock" is locked!
+    int32_t header[2] = { (int32_t)roomId, (int32_t)bytesCnt };
+    room->outbox.insert(room->outbox.end(), (const char*)header, (const char*)header + sizeof(header));
+    room->outbox.insert(room->outbox.end(), bytes, bytes + bytesCnt);
+}
+
+void BackendRoomHost::appendUnfitToOutbox(Room* room, int roomId) {
+    // [WARNING] This function MUST BE called while "room->inputBufferLock" is locked!
+    long byteSize = room->battle->GetUnfitDownsyncSnapshotSize();
+    if (0 >= byteSize) return;
+    if (byteSize > (long)room->scratch.size()) {
+#ifndef NDEBUG
+        std::ostringstream oss;
+        oss << "BackendRoomHost/roomId=" << roomId << ", growing scratch from " << room->scratch.size() << " to " << byteSize << " bytes for an unfit DownsyncSnapshot";
+        Debug::Log(oss.str(), DColor::Orange);
+#endif
+        room->scratch.resize(byteSize);
+    }
+    long outBytesCnt = (long)room->scratch.size();
+    bool taken = room->battle->TakeUnfitDownsyncSnapshot(room->scratch.data(), &outBytesCnt);
+    JPH_ASSERT(taken);
+    if (taken) {
+        appendToOutbox(room, roomId, room->scratch.data(), outBytesCnt);
+    }
+}
+
+bool BackendRoomHost::SubmitUpsync(int roomId, char* inBytes, int inBytesCnt, bool fromUdp, bool fromTcp) {
+    if (0 > roomId || roomId >= roomsCnt.load()) return false;
+    Room* room = rooms[roomId];
+    std::lock_guard<std::mutex> guard(room->inputBufferLock);
+    long outBytesCnt = (long)room->scratch.size();
+    int forceConfirmedStEvictedCnt = 0, oldLcacIfdId = -1, newLcacIfdId = -1, oldDynamicsRdfId = -1, newDynamicsRdfId = -1, maxPlayerInputFrontId = -1, minPlayerInputFrontId = -1;
+    bool res = room->battle->OnUpsyncSnapshotReqReceived(inBytes, inBytesCnt, fromUdp, fromTcp, room->scratch.data(), &outBytesCnt, &forceConfirmedStEvictedCnt, &oldLcacIfdId, &newLcacIfdId, &oldDynamicsRdfId, &newDynamicsRdfId, &maxPlayerInputFrontId, &minPlayerInputFrontId);
+    if (0 < room->battle->GetUnfitDownsyncSnapshotSize()) {
+        // The upsync is applied, just that the produced "DownsyncSnapshot" didn't fit into "scratch".
+        appendUnfitToOutbox(room, roomId);
+        return true;
+    }
+    if (res && 0 < outBytesCnt) {
+        appendToOutbox(room, roomId, room->scratch.data(), outBytesCnt);
+    }
+    return res;
+}
+
+bool BackendRoomHost::SubmitUpsyncInput(int roomId, uint32_t joinIndex, int ifdId, uint64_t input, bool fromUdp, bool fromTcp) {
+    if (0 > roomId || roomId >= roomsCnt.load()) return false;
+    return rooms[roomId]->battle->EnqueueUpsyncInput(joinIndex, ifdId, input, fromUdp, fromTcp);
+}
+
+bool BackendRoomHost::appendDrainedToOutbox(Room* room, int roomId, long drainedBytesCnt) {
+    // [WARNING] This function MUST BE called while "room->inputBufferLock" is locked!
+    bool appended = false;
+    long offset = 0;
+    while (offset + (long)sizeof(int32_t) <= drainedBytesCnt) {
+        int32_t bytesCnt = 0;
+        memcpy(&bytesCnt, room->scratch.data() + offset, sizeof(int32_t));
+        offset += sizeof(int32_t);
+        appendToOutbox(room, roomId, room->scratch.data() + offset, bytesCnt);
+        offset += bytesCnt;
+        appended = true;
+    }
+    return appended;
+}
+
+bool BackendRoomHost::stepRoom(int roomId, bool withRefRdf) {
+    Room* room = rooms[roomId];
+    std::lock_guard<std::mutex> guard(room->inputBufferLock);
+    bool producedByDrain = false;
+    long drainedBytesCnt = (long)room->scratch.size();
+    for (int round = 0; round < cMaxDrainRoundsPerStep && 0 < room->battle->DrainUpsyncInputs(room->scratch.data(), &drainedBytesCnt); ++round) {
+        if (appendDrainedToOutbox(room, roomId, drainedBytesCnt)) {
+            producedByDrain = true;
+        }
+        if (0 < room->battle->GetUnfitDownsyncSnapshotSize()) {
+            // Generated after all "DownsyncSnapshot"s in "drainedBytesCnt", thus appended after them.
+            appendUnfitToOutbox(room, roomId);
+            producedByDrain = true;
+        }
+        drainedBytesCnt = (long)room->scratch.size();
+    }
+
+    long outBytesCnt = (long)room->scratch.size();
+    int oldLcacIfdId = -1, newLcacIfdId = -1, oldDynamicsRdfId = -1, newDynamicsRdfId = -1;
+    room->battle->MoveForwardLcacIfdIdAndStep(withRefRdf, &oldLcacIfdId, &newLcacIfdId, &oldDynamicsRdfId, &newDynamicsRdfId, room->scratch.data(), &outBytesCnt);
+    if (0 < room->battle->GetUnfitDownsyncSnapshotSize()) {
+        appendUnfitToOutbox(room, roomId);
+        return true;
+    }
+    if (0 >= outBytesCnt || oldLcacIfdId >= newLcacIfdId) return producedByDrain;
+    appendToOutbox(room, roomId, room->scratch.data(), outBytesCnt);
+    return true;
+}
+
+int BackendRoomHost::StepAll(bool withRefRdf) {
+    int cnt = roomsCnt.load();
+    if (0 >= cnt) return 0;
+    atomic<int> producedCnt = 0;
+    JobSystem::Barrier* stepAllBarrier = roomJobSys->CreateBarrier();
+    for (int roomId = 0; roomId < cnt; ++roomId) {
+        auto handle = roomJobSys->CreateJob("room-step", JPH::Color::sBlack, [this, roomId, withRefRdf, &producedCnt]() {
+            if (stepRoom(roomId, withRefRdf)) {
+                ++producedCnt;
+            }
+        }, 0);
+        stepAllBarrier->AddJob(handle);
+    }
+    roomJobSys->WaitForJobs(stepAllBarrier);
+    roomJobSys->DestroyBarrier(stepAllBarrier);
+    return producedCnt.load();
+}
+
+bool BackendRoomHost::CollectDownsyncs(char* outBytesPreallocatedStart, long* outBytesCntLimit) {
+    int cnt = roomsCnt.load();
+    long written = 0;
+    bool allCollected = true;
+    for (int roomId = 0; roomId < cnt; ++roomId) {
+        Room* room = rooms[roomId];
+        std::lock_guard<std::mutex> guard(room->inputBufferLock);
+        if (room->outbox.empty()) continue;
+        long byteSize = (long)room->outbox.size();
+        if (written + byteSize > *outBytesCntLimit) {
+            // [REMINDER] The "outbox" of a room is either fully collected or left intact, such that entries of the same room are never re-ordered.
+            allCollected = false;
+            continue;
+        }
+        memcpy(outBytesPreallocatedStart + written, room->outbox.data(), byteSize);
+        written += byteSize;
+        room->outbox.clear();
+    }
+    *outBytesCntLimit = written;
+    return allCollected;
+}
@@ -0,0 +1,61 @@
+#ifndef BACKEND_ROOM_HOST_H_
+#define BACKEND_ROOM_HOST_H_ 1
+
+#include "BackendBattle.h"
+#include <mutex>
+
+using namespace JPH;
+using namespace jtshared;
+
+/*
+[REMINDER]
+
+A "BackendRoomHost" owns up to "maxRoomsCnt" instances of "BackendBattle" (i.e. rooms) and steps them all within a single call of "StepAll(...)", by dispatching 1 job per room onto "roomJobSys".
+
+The "roomJobSys" is intentionally separated from the "JobSystemThreadPool" used by each room for its own pre-physics jobs, post-physics jobs and "PhysicsSystem::Update", such that a room-level job never waits for other jobs of the same pool it's running on.
+
+Each room is guarded by its own "inputBufferLock", i.e. the native equivalent to [DLLMU-v2.3.4 "inputBufferLock"](https://github.com/genxium/DelayNoMoreUnity/blob/v2.3.4/backend/Battle/Room.cs#L144), which guards both write-operations to "ifdBuffer" and the FIFO-enqueuing of produced "DownsyncSnapshot"s into "outbox" -- hence the "order of message generation" per room is preserved in "CollectDownsyncs(...)".
+
+Each entry in "outbox" (and thus in the output of "CollectDownsyncs(...)") is framed as "[int32_t roomId][int32_t bytesCnt][bytesCnt bytes of serialized DownsyncSnapshot]" in native byte order.
+*/
+class JOLTC_EXPORT BackendRoomHost {
+public:
+    BackendRoomHost(int maxRoomsCnt, int nWorkers, int rdfBufferSize, int nBytesForTempAllocatorPerRoom, int downsyncBytesCntLimitPerRoom, TempAllocator* inGlobalTempAllocator, JobSystemThreadPool* inSharedJobSys);
+    virtual ~BackendRoomHost();
+
+public:
+    int AddRoom(char* inBytes, int inBytesCnt); // [WARNING] NOT thread-safe against itself or "StepAll(...)". Returns the "roomId" of the newly added room, or -1 if failed.
+    BackendBattle* GetRoomBattle(int roomId);
+    bool SubmitUpsync(int roomId, char* inBytes, int inBytesCnt, bool fromUdp, bool fromTcp); // Thread-safe, i.e. can be called from any I/O thread.
+    bool SubmitUpsyncInput(int roomId, uint32_t joinIndex, int ifdId, uint64_t input, bool fromUdp, bool fromTcp); // Lock-free, i.e. can be called from any I/O thread without contending "inputBufferLock", the input is applied in the next "StepAll(...)". Returns false if the room's queue is full.
+    int StepAll(bool withRefRdf); // Returns the count of rooms which produced a "DownsyncSnapshot" within this call.
+    bool CollectDownsyncs(char* outBytesPreallocatedStart, long* outBytesCntLimit); // Returns false if any room has remaining "outbox" content which didn't fit into "outBytesPreallocatedStart", in that case the caller should call it again.
+
+protected:
+    typedef struct Room {
+        BackendBattle* battle;
+        std::mutex inputBufferLock;
+        std::vector<char> scratch; // Used as "outBytesPreallocatedStart" for "BackendBattle::OnUpsyncSnapshotReqReceived" and "BackendBattle::MoveForwardLcacIfdIdAndStep"
+        std::vector<char> outbox;
+
+        Room(BackendBattle* inBattle, int scratchSize) : battle(inBattle), scratch(scratchSize) {}
+    } Room;
+
+    int maxRoomsCnt;
+    int rdfBufferSize;
+    int nBytesForTempAllocatorPerRoom;
+    int downsyncBytesCntLimitPerRoom; // The initial size of "Room.scratch", which grows on demand for any larger "DownsyncSnapshot"
+    TempAllocator* globalTempAllocator;
+    JobSystemThreadPool* sharedJobSys;
+    JobSystemThreadPool* roomJobSys;
+    std::vector<Room*> rooms; // [WARNING] Preallocated to "maxRoomsCnt" upon construction and never reallocated afterwards, thus safe to be read while "AddRoom(...)" is appending.
+    atomic<int> roomsCnt;
+
+    static constexpr int cMaxDrainRoundsPerStep = 4; // Bounds the calls of "BackendBattle::DrainUpsyncInputs" per "stepRoom" while holding "inputBufferLock", such that steady enqueuing by I/O threads can't starve the stepping of a room
+    bool stepRoom(int roomId, bool withRefRdf); // Returns true if a "DownsyncSnapshot" is produced
+    static void appendToOutbox(Room* room, int roomId, const char* bytes, long bytesCnt);
+    static void appendUnfitToOutbox(Room* room, int roomId); // Grows "room->scratch" if needed to take the "DownsyncSnapshot" kept by "BackendBattle::TakeUnfitDownsyncSnapshot"
+    static bool appendDrainedToOutbox(Room* room, int roomId, long drainedBytesCnt); // Re-frames the output of "BackendBattle::DrainUpsyncInputs" in "room->scratch", returns true if any "DownsyncSnapshot" is appended
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "BaseBattle.h"
 #include "NpcReactionConsts.h"
+#include "StaticMapShapeCache.h"
 
 #include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
 #include <Jolt/Physics/Collision/Shape/MeshShape.h>
@@ -45,7 +46,7 @@ const bool   cOtherCharactersCanPushPlayer = true;
 
 const EBackFaceMode cBackFaceMode = EBackFaceMode::CollideWithBackFaces;
 
-BaseBattle::BaseBattle(int renderBufferSize, int inputBufferSize, TempAllocator* inGlobalTempAllocator, ALLOC_T_FUNC<StepResult, google::protobuf::Arena> arenaAllocStepResultFunc) : rdfBuffer(renderBufferSize, &pbSemiPermAllocator, BaseBattle::ArenaAllocRdf, BaseBattle::ArenaFreeRdf), ifdBuffer(inputBufferSize), frameLogBuffer(renderBufferSize, &pbTempAllocator, BaseBattle::ArenaAllocFrameLog, BaseBattle::ArenaFreeFrameLog), stepResultBuffer(renderBufferSize, &pbSemiPermAllocator, arenaAllocStepResultFunc, BaseBattle::ArenaFreeStepResult), globalTempAllocator(inGlobalTempAllocator), defaultBplf(ovbLayerFilter, MyObjectLayers::MOVING), defaultOlf(ovoLayerFilter, MyObjectLayers::MOVING), collisionUdHolderStockCache(256, 16), inputInducedMotionStockCache(256) {
+BaseBattle::BaseBattle(int renderBufferSize, int inputBufferSize, TempAllocator* inGlobalTempAllocator, int nBytesForOwnTempAllocator, ALLOC_T_FUNC<StepResult, google::protobuf::Arena> arenaAllocStepResultFunc) : rdfBuffer(renderBufferSize, &pbSemiPermAllocator, BaseBattle::ArenaAllocRdf, BaseBattle::ArenaFreeRdf), ifdBuffer(inputBufferSize), frameLogBuffer(renderBufferSize, &pbTempAllocator, BaseBattle::ArenaAllocFrameLog, BaseBattle::ArenaFreeFrameLog), stepResultBuffer(renderBufferSize, &pbSemiPermAllocator, arenaAllocStepResultFunc, BaseBattle::ArenaFreeStepResult), globalTempAllocator(inGlobalTempAllocator), defaultBplf(ovbLayerFilter, MyObjectLayers::MOVING), defaultOlf(ovoLayerFilter, MyObjectLayers::MOVING), collisionUdHolderStockCache(256, 16), inputInducedMotionStockCache(256) {
 
     JPH_ASSERT(nullptr != frameLogBuffer.GetAllocator()); // [WARNING] Otherwise too inefficient in memory usage, e.g. when calling "unsafe_arena_set_allocated_xxx" would "delete" existing field first
     
@@ -57,6 +58,15 @@ BaseBattle::BaseBattle(int renderBufferSize, int inputBufferSize, TempAllocator*
     It's recommended, but NOT NECESSARY for "rdfBuffer" and "ifdBuffer" to use pb-arena allocation, as long as the "DownsyncSnapshot" and "FrameLog" objects (that might hold references to corresponding "RenderFrame" and "InputFrameDownsync" objects) have correct usage of "unsafe_arena_set_allocated_xxx" & "unsafe_arena_release_xxx". 
     */
 
+    /*
+    [WARNING] 
+
+    "TempAllocatorImpl" is a stack allocator, therefore 2 battles stepping "PhysicsSystem::Update" on different threads with the same "globalTempAllocator" would corrupt each other. A battle that might be stepped concurrently with others (e.g. multiple rooms in a single backend process) should own its temp allocator.
+    */
+    ownTempAllocator = (0 < nBytesForOwnTempAllocator ? new TempAllocatorImplWithMallocFallback(nBytesForOwnTempAllocator) : nullptr);
+    effTempAllocator = (nullptr != ownTempAllocator ? ownTempAllocator : globalTempAllocator);
+    JPH_ASSERT(nullptr != effTempAllocator);
+
     inactiveJoinMask = 0u;
     battleDurationFrames = 0;
 
@@ -73,6 +83,7 @@ BaseBattle::BaseBattle(int renderBufferSize, int inputBufferSize, TempAllocator*
     bi = nullptr;
     biNoLock = nullptr;
     jobSys = nullptr;
+    jobSysShared = false;
     blStockCache = nullptr;
     blSphericalStockCache = nullptr;
     tpDynamicStockCache = nullptr;
@@ -84,9 +95,13 @@ BaseBattle::BaseBattle(int renderBufferSize, int inputBufferSize, TempAllocator*
 
 BaseBattle::~BaseBattle() {
     Clear();
-    delete jobSys;
-    jobSys = nullptr;
+    deallocJobSys();
     deallocPhySys();
+    effTempAllocator = nullptr;
+    if (nullptr != ownTempAllocator) {
+        delete ownTempAllocator;
+        ownTempAllocator = nullptr;
+    }
     // "pbSemiPermAllocator" will be de-scoped and all memory it occupied will be freed automatically
 }
 
@@ -716,6 +731,7 @@ void BaseBattle::updateChColliderBeforePhysicsUpdate_ThreadSafe(uint64_t ud, CH_
 RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, InputFrameDownsync* delayedIfd) {
     const RenderFrame* currRdf = rdfBuffer.GetByFrameId(currRdfId);
     if (nullptr == currRdf) return nullptr;
+    stepProfiler.BeginStep();
     RenderFrame* nextRdf = rdfBuffer.GetByFrameId(currRdfId + 1);
     if (!nextRdf) {
         nextRdf = rdfBuffer.DryPut();
@@ -740,7 +756,10 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
 
     mNextRdfDynamicTrapCount = nextRdf->dynamic_trap_count();
 
+    stepProfiler.Mark(StepPhaseCopyRdf);
+
     batchPutIntoPhySysFromCache(currRdfId, currRdf, nextRdf);
+    stepProfiler.Mark(StepPhasePutIntoPhySys);
 
     StepResult* stepResult = stepResultBuffer.GetByFrameId(currRdfId + 1);
     if (!stepResult) {
@@ -765,7 +784,9 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
         }
     }
 
-    JobSystem::Barrier* prePhysicsUpdateMTBarrier = jobSys->CreateBarrier();
+    stepProfiler.Mark(StepPhaseTriggers);
+
+    JobSystem::Barrier* prePhysicsUpdateMTBarrier = createBarrierBlocking();
     for (int i = 0; i < playersCnt; i++) {
         uint64_t singleInput = delayedIfd->input_list(i);
         auto handle = jobSys->CreateJob("player-pre-physics-update", JPH::Color::sBlack, [currRdfId, i, currRdf, nextRdf, this, singleInput, dt]() {
@@ -978,17 +999,20 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
 
     jobSys->WaitForJobs(prePhysicsUpdateMTBarrier);
     jobSys->DestroyBarrier(prePhysicsUpdateMTBarrier);
+    stepProfiler.Mark(StepPhasePrePhysicsJobs);
 
     /*
     [WARNING] Upon constructors of NON_CONTACT_CONSTRAINT_T classes, lots of member variable setups are done based on Body position, rotation and motion properties -- therefore it's best to setup NON_CONTACT_CONSTRAINT_T instances AFTER all the "bi->SetPositionAndRotation/SetLinearAndAngularVelocity" invocations within "prePhysicsUpdateMTBarrier". 
     */
     batchNonContactConstraintsSetupFromCache(currRdfId, currRdf, nextRdf);
+    stepProfiler.Mark(StepPhaseNonContactConstraints);
 
     // [REMINDER] The "class CharacterVirtual" instances WOULDN'T participate in "phySys->Update(...)" IF they were NOT filled with valid "mInnerBodyID". See "RuleOfThumb.md" for details.
-    phySys->Update(dt, 1, globalTempAllocator, jobSys);
+    phySys->Update(dt, 1, effTempAllocator, jobSys);
+    stepProfiler.Mark(StepPhasePhySysUpdate);
 
     // [REMINDER] From now on, we can safely use "biNoLock" because there'd be NO USE of "bi->SetXxx(...)"!
-    JobSystem::Barrier* postPhysicsUpdateMTBarrier = jobSys->CreateBarrier();
+    JobSystem::Barrier* postPhysicsUpdateMTBarrier = createBarrierBlocking();
     const BaseBattle* battle = this;
     for (int i = 0; i < playersCnt; i++) {
         auto handle = jobSys->CreateJob("player-post-physics-update", JPH::Color::sBlack, [currRdfId, i, currRdf, nextRdf, this, dt, stepResult]() {
@@ -1074,6 +1098,18 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
         postPhysicsUpdateMTBarrier->AddJob(handle);
     }
 
+    // [REMINDER] A conservative superset of the NPCs that will search vision in "npc-post-physics-update", because "nextChd" isn't finalized yet.
+    npcVisionQueryBatch.Reset();
+    for (int i = 0; i < (int)currRdf->npc_count(); i++) {
+        const NpcCharacterDownsync& currNpc = currRdf->npcs(i);
+        if (globalPrimitiveConsts->terminating_character_id() == currNpc.id()) break;
+        const CharacterDownsync& currChd = currNpc.chd();
+        const CharacterConfig* cc = getCc(currChd.species_id());
+        if (!cc->has_vision_reaction() || !BaseNpcReaction::ShouldSearchVision(currRdfId, i, cc)) continue;
+        npcVisionQueryBatch.Include(BaseNpcReaction::CalcConservativeVisionAABB(currChd, cc));
+    }
+    npcVisionQueryBatch.Gather(phySys->GetBroadPhaseQuery(), phySys->GetBodyLockInterfaceNoLock(), defaultBplf, defaultOlf);
+
     for (int i = 0; i < currRdf->npc_count(); i++) {
         if (globalPrimitiveConsts->terminating_character_id() == currRdf->npcs(i).id()) break;
         auto handle = jobSys->CreateJob("npc-post-physics-update", JPH::Color::sBlack, [currRdfId, i, currRdf, nextRdf, this, dt, stepResult]() {
@@ -1131,7 +1167,7 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
                 }
             } else if (!noOpSet.count(nextChd->ch_state())) {
                 bool notTurningAround = (currChd.q_x() == nextChd->q_x() && currChd.q_y() == nextChd->q_y() && currChd.q_z() == nextChd->q_z() && currChd.q_w() == nextChd->q_w());
-                if (cc->has_vision_reaction() && notTurningAround) {
+                if (cc->has_vision_reaction() && notTurningAround && BaseNpcReaction::ShouldSearchVision(currRdfId, i, cc)) {
                     BaseNpcReaction* npcReaction = globalNpcReactionMap.at(cc->species_id());
                     if (nullptr != npcReaction) {
                         NpcGoal currNpcGoal = currNpc.goal_as_npc();
@@ -1149,7 +1185,7 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
                             // [WARNING] To workaround the edge case when an NPC is born right at a "movement blocker".
                             newLastFledRdfId = INT_MIN;
                         }
-                        npcReaction->postStepDeriveNpcVisionReaction(currRdfId, antiGravityNorm, gravityMagnitude, transientUdToCurrPlayer, transientUdToCurrNpc, transientUdToCurrBl, biNoLock, narrowPhaseQueryNoLock, this, defaultBplf, defaultOlf, single, selfNpcBodyID, ud, currNpcGoal, currNpcCachedCueCmd, currChd, massProps, currChdFacing, cc, nextChd, cvSupported, cvInAir, cvOnWall, currNotDashing, currEffInAir, currIsFlying, oldNextNotDashing, oldNextEffInAir, inJumpStartupOrJustEnded, cvGroundState, toRevengeOppoUdt, toRevengeOppoUd, closestOffenderPosDiff, newGoal, newCmd, newLastFledRdfId);
+                        npcReaction->postStepDeriveNpcVisionReaction(currRdfId, antiGravityNorm, gravityMagnitude, transientUdToCurrPlayer, transientUdToCurrNpc, transientUdToCurrBl, biNoLock, narrowPhaseQueryNoLock, &npcVisionQueryBatch, this, defaultBplf, defaultOlf, single, selfNpcBodyID, ud, currNpcGoal, currNpcCachedCueCmd, currChd, massProps, currChdFacing, cc, nextChd, cvSupported, cvInAir, cvOnWall, currNotDashing, currEffInAir, currIsFlying, oldNextNotDashing, oldNextEffInAir, inJumpStartupOrJustEnded, cvGroundState, toRevengeOppoUdt, toRevengeOppoUd, closestOffenderPosDiff, newGoal, newCmd, newLastFledRdfId);
                         nextNpc->set_goal_as_npc(newGoal);
                         nextNpc->set_cached_cue_cmd(newCmd);
                         nextNpc->set_last_fled_rdf_id(newLastFledRdfId);
@@ -1191,7 +1227,7 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
                 CollisionUdHolder_ThreadSafe* holder = transientUdToCollisionUdHolder.at(ud);
                 int cntNow = holder->GetCnt_Realtime();
                 uint64_t udRhs;
-                ContactPoints contactPointsLhs;
+                ContactPointsView contactPointsLhs;
                 Vec3 worldSpaceNormIntoPeer;
                 BodyID peerBodyID; 
                 SubShapeID peerSubShapeID;
@@ -1410,10 +1446,9 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
                 const Trap& currTp = currRdf->dynamic_traps(i);
                 Trap* nextTp = nextRdf->mutable_dynamic_traps(i); // [WARNING] By reaching here, we haven't executed "leftShiftDeadTraps", hence the indices of "currRdf->dynamic_traps" and "nextRdf->dynamic_traps" are FULLY ALIGNED.
                 auto ud = calcUserData(currTp);
-                const uint32_t tpt = currTp.tpt();
                 const TrapConfig* tpConfig = nullptr;
                 const TrapConfigFromTiled* tpConfigFromTile = nullptr;
-                FindTrapConfig(tpt, currTp.id(), trapConfigFromTileDict, tpConfig, tpConfigFromTile);
+                findTrapConfig(currTp, tpConfig, tpConfigFromTile);
 
                 const BodyID effBodyID = isTrapUsingObsIface(tpConfig, tpConfigFromTile) ? *(transientUdToConstraintObsIfaceBodyID.at(ud)) : *(transientUdToBodyID.at(ud));
 
@@ -1472,7 +1507,7 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
                 CollisionUdHolder_ThreadSafe* holder = transientUdToCollisionUdHolder.at(ud);
                 int cntNow = holder->GetCnt_Realtime();
                 uint64_t udRhs;
-                ContactPoints contactPointsLhs;
+                ContactPointsView contactPointsLhs;
                 Vec3 worldSpaceNormIntoPeer;
                 BodyID peerBodyID; 
                 SubShapeID peerSubShapeID;
@@ -1546,10 +1581,10 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
         if (!trActiveMainCycleStates.count(currTrigger.state())) {
             continue;
         }
-        if (!triggerConfigFromTileDict.count(currTrigger.id())) {
+        auto* triggerConfigFromTiled = findTriggerConfigFromTiled(currTrigger.id());
+        if (nullptr == triggerConfigFromTiled) {
             continue;
         }
-        auto* triggerConfigFromTiled = triggerConfigFromTileDict.at(currTrigger.id());
         if (globalPrimitiveConsts->terminating_trigger_id() == triggerConfigFromTiled->publishing_to_trigger_id_upon_exhausted()) {
             continue;
         }
@@ -1566,7 +1601,11 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
 #endif
     }
 
+    stepProfiler.Mark(StepPhasePostPhysicsJobs);
+
     calcFallenDeath(currRdf, nextRdf);
+    stepProfiler.Mark(StepPhaseFallenDeath);
+
     leftShiftDeadNpcs(currRdfId, nextRdf); // Might change "mNextRdfBulletIdCounter" and "mNextRdfBulletCount"
     nextRdf->set_npc_count(mNextRdfNpcCount.load());
     nextRdf->set_npc_id_counter(mNextRdfNpcIdCounter.load());
@@ -1584,6 +1623,7 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
 
     leftShiftDeadTriggers(currRdfId, nextRdf);
     nextRdf->set_trigger_count(mNextRdfTriggerCount.load());
+    stepProfiler.Mark(StepPhaseLeftShiftDead);
 
     stepResult->set_aiming_ray_count(mNextRdfAimingRayCount.load());
     for (auto preparedTriggerUd : transientPreparedTriggerUds) {
@@ -1592,6 +1632,9 @@ RenderFrame* BaseBattle::CalcSingleStep(const int currRdfId, int delayedIfdId, I
 
     batchRemoveFromPhySysAndCache(currRdfId, currRdf);
 
+    nextRdf->set_checksum(CalcRdfChecksum(nextRdf));
+    stepProfiler.Mark(StepPhaseRemoveFromPhySys);
+
     return nextRdf;
 }
 
@@ -1623,6 +1666,8 @@ void BaseBattle::Clear() {
         biNoLock->DestroyBodies(staticColliderBodyIDs.data(), staticColliderBodyIDs.size());
         staticColliderBodyIDs.clear();
     }
+    mergedStaticColliderBodyID = BodyID();
+    mergedStaticColliderShape = nullptr;
     
     /*
     [WARNING] 
@@ -1775,6 +1820,8 @@ void BaseBattle::Clear() {
 
     trapConfigFromTileDict.clear();
     triggerConfigFromTileDict.clear();
+    trapConfigFromTileTable.clear();
+    triggerConfigFromTileTable.clear();
     transientSlipJumpableUds.clear();
     transientUdToSlope.clear();
     transientUdToStairsP.clear();
@@ -1896,6 +1943,28 @@ void BaseBattle::topoSortTriggerConfigFromTiledList(WsReq* initializerMapData) {
     }
 }
 
+template <typename ConfigFromTiledT>
+static void buildDenseConfigFromTileTable(const std::unordered_map<uint32_t, ConfigFromTiledT*>& dict, std::vector<ConfigFromTiledT*>& outTable) {
+    // Ids at or beyond "cMaxDenseConfigId" are left to the dict fallback of "findXxxConfigFromTiled".
+    uint32_t tableSize = 0;
+    for (auto& [id, c] : dict) {
+        if (id < cMaxDenseConfigId && id >= tableSize) {
+            tableSize = id + 1;
+        }
+    }
+    outTable.assign(tableSize, nullptr);
+    for (auto& [id, c] : dict) {
+        if (id < tableSize) {
+            outTable[id] = c;
+        }
+    }
+}
+
+void BaseBattle::buildConfigFromTileTables() {
+    buildDenseConfigFromTileTable(trapConfigFromTileDict, trapConfigFromTileTable);
+    buildDenseConfigFromTileTable(triggerConfigFromTileDict, triggerConfigFromTileTable);
+}
+
 bool BaseBattle::ResetStartRdf(WsReq* initializerMapData) {
     if (nullptr != initializerMapData->GetArena() && initializerMapData->GetArena() != &pbTempAllocator) {
         WsReq* copyWriter = google::protobuf::Arena::Create<WsReq>(&pbTempAllocator);
@@ -2025,6 +2094,7 @@ bool BaseBattle::ResetStartRdf(WsReq* initializerMapData) {
     }
 
     topoSortTriggerConfigFromTiledList(initializerMapData);
+    buildConfigFromTileTables();
 
     for (int i = 0; i < startRdf->dynamic_traps_size(); i++) {
         Trap* tp = startRdf->mutable_dynamic_traps(i);
@@ -2101,15 +2171,21 @@ bool BaseBattle::ResetStartRdf(WsReq* initializerMapData) {
     prefabbedInputList.assign(playersCnt, 0);
     playerInputFrontIds.assign(playersCnt, 0);
     playerInputFronts.assign(playersCnt, 0);
-    playerInputFrontIdsSorted.clear();
+    playerInputFrontIdsUpdatedMask = 0;
+    minPlayerInputFrontId = 0;
+    maxPlayerInputFrontId = 0;
 
     int staticColliderId = 1;
     staticColliderBodyIDs.clear();
     staticColliderUdToBodyID.clear();
+    std::vector<uint32_t> mergeableStaticColliderIds;
+    std::vector<int> mergeableStaticColliderIndices;
+    std::shared_ptr<const COOKED_STATIC_MAP_T> cookedStaticMap = StaticMapShapeCache::GetOrCook(initializerMapData->serialized_barriers()); // [REMINDER] Shapes are cooked only once per map per process, see "StaticMapShapeCache"
     for (int i = 0; i < initializerMapData->serialized_barriers_size(); i++) {
-        SerializedBarrierCollider* barrier = initializerMapData->mutable_serialized_barriers(i);
-        const BarrierColliderAttr& barrierAttr = barrier->attr(); 
-        SerializableConvexPolygon* convexPolygon = barrier->mutable_polygon();
+        const SerializedBarrierCollider& barrier = initializerMapData->serialized_barriers(i);
+        const BarrierColliderAttr& barrierAttr = barrier.attr(); 
+        const SerializableConvexPolygon* convexPolygon = &(barrier.polygon());
+        const CookedStaticCollider& cooked = (*cookedStaticMap)[i];
         const uint64_t staticColliderUd = calcStaticColliderUserData(staticColliderId); // As [BodyManager::AddBody](https://github.com/jrouwe/JoltPhysics/blob/v5.3.0/Jolt/Physics/Body/BodyManager.cpp#L285) maintains "BodyID" counting by , in rollback netcode with a reused "BaseBattle" instance, even the same "static collider" might NOT get the same "BodyID" at different battles, we MUST use custom ids to distinguish "Body" instances!
         if (barrierAttr.provides_slip_jump()) {
             transientSlipJumpableUds.insert(staticColliderUd);
@@ -2117,220 +2193,50 @@ bool BaseBattle::ResetStartRdf(WsReq* initializerMapData) {
         if (barrierAttr.prohibits_wall_grabbing()) {
             transientWallGrabProhibitingUds.insert(staticColliderUd);
         }
-        const BodyID* newBodyID = nullptr;
-        int pointsCnt = convexPolygon->points_size();
-        double recalcAnchorX = 0, recalcAnchorY = 0;
-        if (convexPolygon->is_box()) {
-            JPH::Quat boxQ = cIdentityQ;
-            if (0 != convexPolygon->box_q_x()   
-            || 0 != convexPolygon->box_q_y()
-            || 0 != convexPolygon->box_q_z()
-            || 0 != convexPolygon->box_q_w()
-            ) {
-                boxQ = JPH::Quat(convexPolygon->box_q_x(), convexPolygon->box_q_y(), convexPolygon->box_q_z(), convexPolygon->box_q_w());
-            }
-
-            float xExtent = 0.f, yExtent = 0.f;
-            for (int i = 0; i < convexPolygon->points_size(); i++) {
-                auto& pi = convexPolygon->points(i);
-                for (int j = i + 1; j < convexPolygon->points_size(); j++) {
-                    auto& pj = convexPolygon->points(j);
-                    float dxAbs = std::abs(pj.x() - pi.x());
-                    float dyAbs = std::abs(pj.y() - pi.y());
-                    if (dxAbs > xExtent) xExtent = dxAbs;
-                    if (dyAbs > yExtent) yExtent = dyAbs;
-                }
-                recalcAnchorX += pi.x();
-                recalcAnchorY += pi.y();
-
-                if (pi.y() < fallenDeathHeight) {
-                    fallenDeathHeight = pi.y();
-                }
-            }
-            
-            // [REMINDER] When "is_box == true", the anchor (i.e. the mid-center) is rotational invariant 
-            const double anchorX = (recalcAnchorX / pointsCnt);
-            const double anchorY = (recalcAnchorY / pointsCnt);
-            float xHalfExtent = 0.5f * xExtent, yHalfExtent = 0.5f * yExtent;
-            float convexRadius = (xHalfExtent + yHalfExtent) * 0.5;
-            if (cDefaultBarrierHalfThickness < convexRadius) {
-                convexRadius = cDefaultBarrierHalfThickness; // Required by the underlying body creation 
+        for (auto& p : convexPolygon->points()) {
+            if (p.y() < fallenDeathHeight) {
+                fallenDeathHeight = p.y();
             }
-            Vec3 halfExtent(xHalfExtent, yHalfExtent, cDefaultBarrierHalfThickness);
-            BoxShapeSettings bodyShapeSettings(halfExtent, convexRadius); // transient, to be discarded after creating "body"
-            BoxShapeSettings::ShapeResult shapeResult;
-            /*
-                "Body" and "BodyCreationSettings" will handle lifecycle of the following "bodyShape", i.e.
-                - by "RefConst<Shape> Body::mShape" (note that "Body" does NOT hold a member variable "BodyCreationSettings") or
-                - by "RefConst<ShapeSettings> BodyCreationSettings::mShape".
+        }
 
-                See "<proj-root>/JoltBindings/RefConst_destructor_trick.md" for details.
-            */
-            const BoxShape* bodyShape = new BoxShape(bodyShapeSettings, shapeResult);
-            BodyCreationSettings bodyCreationSettings(bodyShape, Vec3(anchorX, anchorY, 0), boxQ, EMotionType::Static, MyObjectLayers::NON_MOVING);
-            bodyCreationSettings.mUserData = staticColliderUd;
-            bodyCreationSettings.mFriction = globalPrimitiveConsts->default_barrier_friction();
-            bodyCreationSettings.mRestitution = globalPrimitiveConsts->default_barrier_restitution();
+        /*
+            "Body" will handle lifecycle of the shared "cooked.shape" by "RefConst<Shape> Body::mShape" (note that "Body" does NOT hold a member variable "BodyCreationSettings"), while "StaticMapShapeCache" holds another reference for later battles of the same map.
 
+            See "<proj-root>/JoltBindings/RefConst_destructor_trick.md" for details.
+        */
+        BodyCreationSettings bodyCreationSettings(cooked.shape, cooked.position, cooked.rotation, EMotionType::Static, MyObjectLayers::NON_MOVING);
+        bodyCreationSettings.mUserData = staticColliderUd;
+        bodyCreationSettings.mFriction = globalPrimitiveConsts->default_barrier_friction();
+        bodyCreationSettings.mRestitution = globalPrimitiveConsts->default_barrier_restitution();
+        if (convexPolygon->is_box()) {
             if (barrierAttr.provides_stairs_n()) {
-                transientUdToStairsN[staticColliderUd] = boxQ*cYAxis;
+                transientUdToStairsN[staticColliderUd] = cooked.rotation*cYAxis;
             }
-
-            Body* body = biNoLock->CreateBody(bodyCreationSettings);
-            newBodyID = &(body->GetID());
-            staticColliderBodyIDs.push_back(*newBodyID);
-        } else {
-            std::vector<PbVec2> effConvexPolygonPoints;
-            effConvexPolygonPoints.reserve(pointsCnt);
-            for (auto& srcPoint : convexPolygon->points()) {
-                effConvexPolygonPoints.push_back(srcPoint);
-                recalcAnchorX += srcPoint.x();
-                recalcAnchorY += srcPoint.y();
-            }
-            const double anchorX = (recalcAnchorX / pointsCnt);
-            const double anchorY = (recalcAnchorY / pointsCnt);
-            std::sort(effConvexPolygonPoints.begin(), effConvexPolygonPoints.end(), [anchorX, anchorY](const PbVec2& a, const PbVec2& b) {
-                const double dxA = (a.x() - anchorX);
-                const double dyA = (a.y() - anchorY);
-                const double dxB = (b.x() - anchorX);
-                const double dyB = (b.y() - anchorY);
-                double crossProduct = dxA * dyB - dyA * dxB;
-
-                if (crossProduct != 0) {
-                    return (crossProduct < 0);
-                } else {
-                    double distA2 = dxA * dxA + dyA * dyA;
-                    double distB2 = dxB * dxB + dyB * dyB;
-                    return (distA2 < distB2);
-                }
-            });
-
-            if (convexPolygon->is_parallelepiped()) {
-                Vec3 slopeEdgeNorm;
-                float slopeEdgeBestDot = FLT_MIN;
-
-                std::vector<JPH::Vec3> parsedPoints;
-                parsedPoints.reserve(2 * pointsCnt);
-                for (int pi = 0; pi < pointsCnt; pi++) {
-                    auto fromI = pi;
-                    auto toI = fromI + 1;
-                    if (toI >= pointsCnt) {
-                        toI = 0;
-                    }
-
-                    auto& p1 = effConvexPolygonPoints[fromI];
-                    if (p1.y() < fallenDeathHeight) {
-                        fallenDeathHeight = p1.y();
-                    }
-
-                    auto& p2 = effConvexPolygonPoints[toI];
-
-                    auto x1 = p1.x() - anchorX;
-                    auto y1 = p1.y() - anchorY;
-                    auto x2 = p2.x() - anchorX;
-                    auto y2 = p2.y() - anchorY;
-
-                    Vec3 candidateSlopeEdge(x2-x1, y2-y1, 0);
-                    Vec3 candidateSlopeEdgeNorm = candidateSlopeEdge.Normalized();
-            
-                    float dot1 = candidateSlopeEdgeNorm.Dot(yTurned45DegsAroundZAxis);
-                    float dot2 = candidateSlopeEdgeNorm.Dot(yTurnedNegative45DegsAroundZAxis);
-                    float dot3 = candidateSlopeEdgeNorm.Dot(yTurned135DegsAroundZAxis);
-                    float dot4 = candidateSlopeEdgeNorm.Dot(yTurnedNegative135DegsAroundZAxis);
-
-                    float candidateDot = max(max(dot1, dot2), max(dot3, dot4));
-                    if (candidateDot > slopeEdgeBestDot) {
-                        slopeEdgeNorm = candidateSlopeEdgeNorm;
-                        slopeEdgeBestDot = candidateDot;
-                    }
-
-                    parsedPoints.push_back(Vec3(x1, y1, +cDefaultBarrierHalfThickness));
-                    parsedPoints.push_back(Vec3(x1, y1, -cDefaultBarrierHalfThickness));
-                }
-
-                Vec3 slopeEdgeOutwardNorm = (cTurn90DegsAroundZAxis * slopeEdgeNorm);
-                if (0 > slopeEdgeOutwardNorm.GetY()) {
-                    slopeEdgeOutwardNorm = -slopeEdgeOutwardNorm;
-                }
-
-                ConvexHullShapeSettings bodyShapeSettings(parsedPoints.data(), parsedPoints.size());
-                ConvexHullShapeSettings::ShapeResult shapeResult;
-                const ConvexHullShape* bodyShape = new ConvexHullShape(bodyShapeSettings, shapeResult);
-                BodyCreationSettings bodyCreationSettings(bodyShape, Vec3(anchorX, anchorY, 0), JPH::Quat::sIdentity(), EMotionType::Static, MyObjectLayers::NON_MOVING);
-                bodyCreationSettings.mUserData = staticColliderUd;
-                bodyCreationSettings.mRestitution = globalPrimitiveConsts->default_barrier_restitution();
-                bodyCreationSettings.mFriction = 5.0f*globalPrimitiveConsts->default_barrier_friction();
-                
-                if (barrierAttr.provides_stairs_p()) {
-                    transientUdToStairsP[staticColliderUd] = slopeEdgeOutwardNorm;
+        } else if (convexPolygon->is_parallelepiped()) {
+            bodyCreationSettings.mFriction = 5.0f*globalPrimitiveConsts->default_barrier_friction();
+            if (barrierAttr.provides_stairs_p()) {
+                transientUdToStairsP[staticColliderUd] = cooked.slopeEdgeOutwardNorm;
 #ifndef NDEBUG
-                    std::ostringstream oss;
-                    oss << "The " << i + 1 << "-th static collider with ud=" << staticColliderUd << ", isParallelePiped=" << convexPolygon->is_parallelepiped() << " provides p-type staris:\n\t";
-                    for (int pi = 0; pi < effConvexPolygonPoints.size(); pi ++) {
-                        auto& p = effConvexPolygonPoints[pi];
-                        auto x = p.x();
-                        auto y = p.y();
-                        oss << "(" << x << "," << y << ") ";
-                    }
-                    oss << ", slopeEdgeOutwardNorm=(" << slopeEdgeOutwardNorm.GetX() << "," << slopeEdgeOutwardNorm.GetY() << ")";
-                    Debug::Log(oss.str(), DColor::Orange);
+                std::ostringstream oss;
+                oss << "The " << i + 1 << "-th static collider with ud=" << staticColliderUd << ", isParallelePiped=" << convexPolygon->is_parallelepiped() << " provides p-type staris, slopeEdgeOutwardNorm=(" << cooked.slopeEdgeOutwardNorm.GetX() << "," << cooked.slopeEdgeOutwardNorm.GetY() << ")";
+                Debug::Log(oss.str(), DColor::Orange);
 #endif
-                } else {
-                    transientUdToSlope[staticColliderUd] = slopeEdgeOutwardNorm;
-                }
-
-                Body* body = biNoLock->CreateBody(bodyCreationSettings);
-                newBodyID = &(body->GetID());
-                staticColliderBodyIDs.push_back(*newBodyID);
             } else {
-                TriangleList triangles;
-                for (int pi = 0; pi < pointsCnt; pi++) {
-                    auto fromI = pi;
-                    auto toI = fromI + 1;
-                    if (toI >= pointsCnt) {
-                        toI = 0;
-                    }
-                    auto& p1 = effConvexPolygonPoints[fromI];
-                    auto& p2 = effConvexPolygonPoints[toI];
-
-                    auto x1 = p1.x() - anchorX;
-                    auto y1 = p1.y() - anchorY;
-                    auto x2 = p2.x() - anchorX;
-                    auto y2 = p2.y() - anchorY;
-                    
-                    // According to https://github.com/jrouwe/JoltPhysics/blob/v5.3.0/Jolt/Physics/Collision/Shape/MeshShape.cpp#L440, the surface normal (outward) of a "JPH::Triangle" is "(v3 - v2).Cross(v1 - v2).Normalized()".
-                    {
-                        Float3 v1(x1, y1, -cDefaultBarrierHalfThickness);
-                        Float3 v2(x1, y1, +cDefaultBarrierHalfThickness);
-                        Float3 v3(x2, y2, +cDefaultBarrierHalfThickness);
-                        triangles.push_back(Triangle(v1, v2, v3));
-                    }
-                    {
-                        Float3 v1(x2, y2, +cDefaultBarrierHalfThickness);
-                        Float3 v2(x2, y2, -cDefaultBarrierHalfThickness);
-                        Float3 v3(x1, y1, -cDefaultBarrierHalfThickness);
-                        triangles.push_back(Triangle(v1, v2, v3));
-                    }
-
-                    if (p1.y() < fallenDeathHeight) {
-                        fallenDeathHeight = p1.y();
-                    }
-                    if (p2.y() < fallenDeathHeight) {
-                        fallenDeathHeight = p2.y();
-                    }
-                }
-                MeshShapeSettings bodyShapeSettings(triangles);
-                MeshShapeSettings::ShapeResult shapeResult;
-                const MeshShape* bodyShape = new MeshShape(bodyShapeSettings, shapeResult);
-                BodyCreationSettings bodyCreationSettings(bodyShape, Vec3(anchorX, anchorY, 0), JPH::Quat::sIdentity(), EMotionType::Static, MyObjectLayers::NON_MOVING);
-                bodyCreationSettings.mUserData = staticColliderUd;
-                bodyCreationSettings.mFriction = globalPrimitiveConsts->default_barrier_friction();
-                bodyCreationSettings.mRestitution = globalPrimitiveConsts->default_barrier_restitution();
-                Body* body = biNoLock->CreateBody(bodyCreationSettings);
-                newBodyID = &(body->GetID());
-                staticColliderBodyIDs.push_back(*newBodyID);
+                transientUdToSlope[staticColliderUd] = cooked.slopeEdgeOutwardNorm;
             }
         }
+
+        const bool mergeable = (staticBarrierMergeEnabled && !convexPolygon->is_parallelepiped() && !barrierAttr.provides_stairs_n() && !barrierAttr.provides_slip_jump() && !barrierAttr.prohibits_wall_grabbing()); // [WARNING] Only "plain" barriers, i.e. whose ud is never looked up by "transientUdToXxx" or "transientXxxUds", otherwise the merged body's own ud would be mistaken for them
+        if (mergeable) {
+            mergeableStaticColliderIds.push_back(staticColliderId);
+            mergeableStaticColliderIndices.push_back(i);
+            staticColliderId++;
+            continue;
+        }
+
+        Body* body = biNoLock->CreateBody(bodyCreationSettings);
+        const BodyID* newBodyID = &(body->GetID());
+        staticColliderBodyIDs.push_back(*newBodyID);
         staticColliderUdToBodyID[staticColliderUd] = newBodyID;
 
 #ifndef NDEBUG
@@ -2347,6 +2253,58 @@ bool BaseBattle::ResetStartRdf(WsReq* initializerMapData) {
         staticColliderId++;
     }
 
+    if (!mergeableStaticColliderIds.empty()) {
+        /*
+        [REMINDER] Merging reduces the count of "NON_MOVING" bodies in the broadphase, at the cost of resolving the original static collider ud of a hit by its "SubShapeID" (see "resolveSubShapeUd"). A single mergeable barrier is NOT worth it.
+        */
+        StaticCompoundShapeSettings mergedShapeSettings;
+        for (int k = 0; k < (int)mergeableStaticColliderIndices.size(); k++) {
+            const CookedStaticCollider& cooked = (*cookedStaticMap)[mergeableStaticColliderIndices[k]];
+            mergedShapeSettings.AddShape(cooked.position, cooked.rotation, cooked.shape, mergeableStaticColliderIds[k]);
+        }
+        StaticCompoundShapeSettings::ShapeResult mergedShapeResult;
+        if (2 <= mergeableStaticColliderIds.size()) {
+            mergedShapeResult = mergedShapeSettings.Create();
+        }
+        if (mergedShapeResult.IsValid()) {
+            mergedStaticColliderShape = static_cast<const StaticCompoundShape*>(mergedShapeResult.Get().GetPtr());
+            BodyCreationSettings bodyCreationSettings(mergedStaticColliderShape, Vec3::sZero(), JPH::Quat::sIdentity(), EMotionType::Static, MyObjectLayers::NON_MOVING);
+            bodyCreationSettings.mUserData = calcStaticColliderUserData(mergeableStaticColliderIds[0]);
+            bodyCreationSettings.mFriction = globalPrimitiveConsts->default_barrier_friction();
+            bodyCreationSettings.mRestitution = globalPrimitiveConsts->default_barrier_restitution();
+            Body* body = biNoLock->CreateBody(bodyCreationSettings);
+            mergedStaticColliderBodyID = body->GetID();
+            staticColliderBodyIDs.push_back(mergedStaticColliderBodyID);
+            for (uint32_t mergedStaticColliderId : mergeableStaticColliderIds) {
+                staticColliderUdToBodyID[calcStaticColliderUserData(mergedStaticColliderId)] = &(body->GetID());
+            }
+#ifndef NDEBUG
+            std::ostringstream oss;
+            oss << "Merged " << mergeableStaticColliderIds.size() << " static colliders into bodyID=" << mergedStaticColliderBodyID.GetIndexAndSequenceNumber();
+            Debug::Log(oss.str(), DColor::Orange);
+#endif
+        } else {
+#ifndef NDEBUG
+            if (mergedShapeResult.HasError()) {
+                std::ostringstream oss;
+                oss << "Failed to merge " << mergeableStaticColliderIds.size() << " static colliders, error=" << mergedShapeResult.GetError() << ", falling back to individual bodies";
+                Debug::Log(oss.str(), DColor::Orange);
+            }
+#endif
+            for (int k = 0; k < (int)mergeableStaticColliderIndices.size(); k++) {
+                const CookedStaticCollider& cooked = (*cookedStaticMap)[mergeableStaticColliderIndices[k]];
+                const uint64_t staticColliderUd = calcStaticColliderUserData(mergeableStaticColliderIds[k]);
+                BodyCreationSettings bodyCreationSettings(cooked.shape, cooked.position, cooked.rotation, EMotionType::Static, MyObjectLayers::NON_MOVING);
+                bodyCreationSettings.mUserData = staticColliderUd;
+                bodyCreationSettings.mFriction = globalPrimitiveConsts->default_barrier_friction();
+                bodyCreationSettings.mRestitution = globalPrimitiveConsts->default_barrier_restitution();
+                Body* body = biNoLock->CreateBody(bodyCreationSettings);
+                staticColliderBodyIDs.push_back(body->GetID());
+                staticColliderUdToBodyID[staticColliderUd] = &(body->GetID());
+            }
+        }
+    }
+
     auto layerState = biNoLock->AddBodiesPrepare(staticColliderBodyIDs.data(), staticColliderBodyIDs.size());
     biNoLock->AddBodiesFinalize(staticColliderBodyIDs.data(), staticColliderBodyIDs.size(), layerState, EActivation::DontActivate);
 
@@ -3860,8 +3818,7 @@ void BaseBattle::batchPutIntoPhySysFromCache(const int currRdfId, const RenderFr
         auto ud = calcUserData(currTp);
         const TrapConfig* tpConfig = nullptr;
         const TrapConfigFromTiled* tpConfigFromTile = nullptr;
-        const uint32_t tpt = currTp.tpt();
-        FindTrapConfig(tpt, currTp.id(), trapConfigFromTileDict, tpConfig, tpConfigFromTile);
+        findTrapConfig(currTp, tpConfig, tpConfigFromTile);
         JPH_ASSERT(nullptr != tpConfig);
         transientUdToCurrTrap[ud] = &currTp;
         transientUdToNextTrap[ud] = nextTp;
@@ -3933,11 +3890,10 @@ void BaseBattle::batchPutIntoPhySysFromCache(const int currRdfId, const RenderFr
         transientUdToCurrTrigger[ud] = &currTr;
         transientUdToNextTrigger[ud] = nextTr;
 
-        if (!triggerConfigFromTileDict.count(currTr.id())) continue;
+        auto* triggerConfigFromTile = findTriggerConfigFromTiled(currTr.id()); 
+        if (nullptr == triggerConfigFromTile) continue;
         if (TriggerState::TrReady != currTr.state()) continue; 
         if (!collidableTrtSet.count(currTr.trt())) continue;
-        
-        auto* triggerConfigFromTile = triggerConfigFromTileDict.at(currTr.id()); 
 
         Vec3 newPos(currTr.x(), currTr.y(), currTr.z());
         Quat newRot(triggerConfigFromTile->init_q_x(), triggerConfigFromTile->init_q_y(), triggerConfigFromTile->init_q_z(), triggerConfigFromTile->init_q_w());
@@ -4000,7 +3956,7 @@ void BaseBattle::batchPutIntoPhySysFromCache(const int currRdfId, const RenderFr
 }
 
 void BaseBattle::batchNonContactConstraintsSetupFromCache(const int currRdfId, const RenderFrame* currRdf, RenderFrame* nextRdf) {
-    JobSystem::Barrier* nonContactConstraintSetupMTBarrier = jobSys->CreateBarrier();
+    JobSystem::Barrier* nonContactConstraintSetupMTBarrier = createBarrierBlocking();
     for (int i = 0; i < currRdf->dynamic_trap_count(); i++) {
         const Trap& currTp = currRdf->dynamic_traps(i);
         if (globalPrimitiveConsts->terminating_trap_id() == currTp.id()) break;
@@ -4008,8 +3964,7 @@ void BaseBattle::batchNonContactConstraintsSetupFromCache(const int currRdfId, c
         auto ud = calcUserData(currTp);
         const TrapConfig* tpConfig = nullptr;
         const TrapConfigFromTiled* tpConfigFromTile = nullptr;
-        const uint32_t tpt = currTp.tpt();
-        FindTrapConfig(tpt, currTp.id(), trapConfigFromTileDict, tpConfig, tpConfigFromTile);
+        findTrapConfig(currTp, tpConfig, tpConfigFromTile);
         JPH_ASSERT(nullptr != tpConfig);
 
         bool isTriggerBased = (nullptr != tpConfigFromTile && globalPrimitiveConsts->terminating_trigger_id() != tpConfigFromTile->subscribes_to_trigger_id());
@@ -4395,7 +4350,7 @@ void BaseBattle::batchRemoveFromPhySysAndCache(const int currRdfId, const Render
         JPH_ASSERT(globalPrimitiveConsts->terminating_trap_id() != tp.id());
         const TrapConfig* tpConfig = nullptr;
         const TrapConfigFromTiled* tpConfigFromTile = nullptr;
-        FindTrapConfig(tp.tpt(), tp.id(), trapConfigFromTileDict, tpConfig, tpConfigFromTile);
+        findTrapConfig(tp, tpConfig, tpConfigFromTile);
         JPH_ASSERT(nullptr != tpConfig);
         if (nullptr == tpConfigFromTile) {
             calcTpCacheKey(tpConfig->default_box_half_size_x(), tpConfig->default_box_half_size_y(), single->GetMotionType(), single->IsSensor(), single->GetObjectLayer(), tpCacheKeyHolder);
@@ -4427,8 +4382,8 @@ void BaseBattle::batchRemoveFromPhySysAndCache(const int currRdfId, const Render
         JPH_ASSERT(0 < transientUdToCurrTrigger.count(ud));
         const Trigger& tr = *(transientUdToCurrTrigger.at(ud));
         JPH_ASSERT(globalPrimitiveConsts->terminating_trigger_id() != tr.id());
-        JPH_ASSERT(0 < triggerConfigFromTileDict.count(tr.id()));
-        auto* triggerConfigFromTile = triggerConfigFromTileDict.at(tr.id());
+        auto* triggerConfigFromTile = findTriggerConfigFromTiled(tr.id());
+        JPH_ASSERT(nullptr != triggerConfigFromTile);
 
         calcTrCacheKey(triggerConfigFromTile->box_half_size_x(), triggerConfigFromTile->box_half_size_y(), trCacheKeyHolder);
         auto it = cachedTrColliders.find(trCacheKeyHolder);
@@ -4874,25 +4829,21 @@ void BaseBattle::processSingleCharacterInput(const int currRdfId, float dt, int
 void BaseBattle::FindBulletConfig(const uint32_t skillId, const uint32_t skillHit, const Skill*& outSkill, const BulletConfig*& outBulletConfig) {
     if (globalPrimitiveConsts->no_skill() == skillId) return;
     if (globalPrimitiveConsts->no_skill_hit() == skillHit) return;
-    auto& skillConfigs = globalConfigConsts->skill_configs();
-    if (!skillConfigs.count(skillId)) return;
-    const Skill& outSkillVal = skillConfigs.at(skillId);
-    outSkill = &(outSkillVal);
-    if (skillHit > outSkill->hits_size()) {
+    const Skill* skill = LookupSkillConfig(skillId);
+    if (nullptr == skill) return;
+    outSkill = skill;
+    outBulletConfig = LookupBulletConfig(skillId, skillHit, skill);
+    if (nullptr == outBulletConfig) {
         outSkill = nullptr;
-        outBulletConfig = nullptr;
         return;
     }
-    const BulletConfig& targetBlConfig = outSkill->hits(skillHit - 1);
-    outBulletConfig = &targetBlConfig;
 }
 
-void BaseBattle::FindTrapConfig(const uint32_t trapSpeciesId, const uint32_t trapId, const std::unordered_map<uint32_t, const TrapConfigFromTiled*> inTrapConfigFromTileDict, const TrapConfig*& outTpConfig, const TrapConfigFromTiled*& outTpConfigFromTiled) {
+void BaseBattle::FindTrapConfig(const uint32_t trapSpeciesId, const uint32_t trapId, const std::unordered_map<uint32_t, const TrapConfigFromTiled*>& inTrapConfigFromTileDict, const TrapConfig*& outTpConfig, const TrapConfigFromTiled*& outTpConfigFromTiled) {
     if (globalPrimitiveConsts->terminating_trap_id() == trapId) return;
-    auto& trapConfigs = globalConfigConsts->trap_configs();
-    if (!trapConfigs.count(trapSpeciesId)) return;
-    const TrapConfig& outTpConfigVal = trapConfigs.at(trapSpeciesId);
-    outTpConfig = &(outTpConfigVal);
+    const TrapConfig* tpConfig = LookupTrapConfig(trapSpeciesId);
+    if (nullptr == tpConfig) return;
+    outTpConfig = tpConfig;
     if (!inTrapConfigFromTileDict.count(trapId)) return;
     outTpConfigFromTiled = inTrapConfigFromTileDict.at(trapId);
 }
@@ -5264,13 +5215,12 @@ void BaseBattle::postStepSingleChdStateCorrection(const int currRdfId, const uin
 
 void BaseBattle::leftShiftDeadNpcs(const int currRdfId, RenderFrame* nextRdf) {
     int aliveI = 0, candI = 0;
-    auto& characterConfigs = globalConfigConsts->character_configs();
     int mNextRdfNpcCountVal = mNextRdfNpcCount.load();
     while (candI < mNextRdfNpcCountVal) {
         const NpcCharacterDownsync* candidate = &(nextRdf->npcs(candI));
         if (globalPrimitiveConsts->terminating_character_id() == candidate->id()) break;
         const CharacterDownsync* chd = &(candidate->chd());
-        const CharacterConfig& candidateConfig = characterConfigs.at(chd->species_id());
+        const CharacterConfig& candidateConfig = *getCc(chd->species_id());
 
         while (candI < mNextRdfNpcCountVal && globalPrimitiveConsts->terminating_character_id() != candidate->id() && isNpcDeadToDisappear(chd)) {
             if (globalPrimitiveConsts->terminating_trigger_id() != candidate->publishing_to_trigger_id_upon_exhausted()) {
@@ -5313,15 +5263,13 @@ void BaseBattle::leftShiftDeadNpcs(const int currRdfId, RenderFrame* nextRdf) {
 }
 
 void BaseBattle::calcFallenDeath(const RenderFrame* currRdf, RenderFrame* nextRdf) {
-    auto& chConfigs = globalConfigConsts->character_configs();
-
     int currRdfId = currRdf->id();
     for (int i = 0; i < nextRdf->players_size(); i++) {
         if (i >= currRdf->players_size()) break;
         const PlayerCharacterDownsync& currPlayer = currRdf->players(i);
         auto nextPlayer = nextRdf->mutable_players(i);
         auto chd = nextPlayer->mutable_chd();
-        auto chConfig = chConfigs.at(chd->species_id());
+        const CharacterConfig& chConfig = *getCc(chd->species_id());
         float chTop = chd->y() + 2*chConfig.capsule_half_height();
         if (fallenDeathHeight > chTop && Dying != chd->ch_state()) {
             transitToDying(currRdfId, currPlayer, true, nextPlayer);
@@ -5333,7 +5281,7 @@ void BaseBattle::calcFallenDeath(const RenderFrame* currRdf, RenderFrame* nextRd
         if (globalPrimitiveConsts->terminating_character_id() == currNpc.id()) break;
         auto nextNpc = nextRdf->mutable_npcs(i);
         auto chd = nextNpc->mutable_chd();
-        const CharacterConfig& chConfig = chConfigs.at(chd->species_id());
+        const CharacterConfig& chConfig = *getCc(chd->species_id());
         float chTop = chd->y() + 2 * chConfig.capsule_half_height();
         if (fallenDeathHeight > chTop && Dying != chd->ch_state()) {
             transitToDying(currRdfId, currNpc, true, nextNpc);
@@ -5833,7 +5781,17 @@ void BaseBattle::CopyRdf(const RenderFrame* from, RenderFrame* to) {
     to->set_pickable_id_counter(from->pickable_id_counter());
     to->set_pickable_count(from->pickable_count());
     to->set_dynamic_trap_count(from->dynamic_trap_count());
-    
+    to->set_checksum(from->checksum());
+
+    /*
+    [REMINDER] Each preallocated list is only copied up to its first terminator (which is always at the "xxx_count()" index when not full), i.e. the stale slots beyond it are NOT copied, because
+    - every reader of these lists breaks upon the terminator, and
+    - every spawning site (e.g. "addNewBulletToNextFrame", "addNewNpcToNextFrame", "addNewPickableToNextFrame") fully overwrites the slot it takes.
+
+    [WARNING] However "to->xxx_size()" MUST still match "from->xxx_size()", i.e. a freshly "DryPut" slot of "rdfBuffer" is grown to the full preallocated capacity (once per slot, copying the stale ones too), because the spawning sites run in parallel jobs and each takes its slot by a "fetch_add" index -- they'd otherwise race on "add_xxx()" of the same "RepeatedPtrField" and the taken index would no longer match the real slot.
+
+    This matters a lot for "rollback-chasing" where "CopyRdf" is called once per chased frame while the preallocated capacity (e.g. "default_prealloc_bullet_capacity") is typically far larger than the alive count.
+    */
     for (int i = 0; i < from->players_size(); i++) {
         const PlayerCharacterDownsync* fromSingle = &(from->players(i));
         PlayerCharacterDownsync * toSingle = i < to->players_size() ? to->mutable_players(i) : to->add_players();
@@ -5844,53 +5802,78 @@ void BaseBattle::CopyRdf(const RenderFrame* from, RenderFrame* to) {
         toSingle->set_join_index(globalPrimitiveConsts->magic_join_index_invalid());
     }
 
-    for (int i = 0; i < from->npcs_size(); i++) {
-        const NpcCharacterDownsync* fromSingle = &(from->npcs(i));
-        NpcCharacterDownsync* toSingle = i < to->npcs_size() ? to->mutable_npcs(i) : to->add_npcs();
+    for (int i = to->npcs_size(); i < from->npcs_size(); i++) {
+        CopyNpcChd(&(from->npcs(i)), to->add_npcs());
+    }
+    int npcI = 0;
+    for (; npcI < from->npcs_size(); npcI++) {
+        const NpcCharacterDownsync* fromSingle = &(from->npcs(npcI));
+        if (globalPrimitiveConsts->terminating_character_id() == fromSingle->id()) break;
+        NpcCharacterDownsync* toSingle = to->mutable_npcs(npcI);
         CopyNpcChd(fromSingle, toSingle);
     }
-    if (to->npc_count() < to->npcs_size()) {
-        NpcCharacterDownsync* toSingle = to->mutable_npcs(to->npc_count());
+    if (npcI < to->npcs_size()) {
+        NpcCharacterDownsync* toSingle = to->mutable_npcs(npcI);
         toSingle->set_id(globalPrimitiveConsts->terminating_character_id());
     }
 
-    for (int i = 0; i < from->bullets_size(); i++) {
-        const Bullet* fromSingle = &(from->bullets(i));
-        Bullet* toSingle = i < to->bullets_size() ? to->mutable_bullets(i) : to->add_bullets();
+    for (int i = to->bullets_size(); i < from->bullets_size(); i++) {
+        CopyBullet(&(from->bullets(i)), to->add_bullets());
+    }
+    int blI = 0;
+    for (; blI < from->bullets_size(); blI++) {
+        const Bullet* fromSingle = &(from->bullets(blI));
+        if (globalPrimitiveConsts->terminating_bullet_id() == fromSingle->id()) break;
+        Bullet* toSingle = to->mutable_bullets(blI);
         CopyBullet(fromSingle, toSingle);
     }
-    if (to->bullet_count() < to->bullets_size()) {
-        Bullet* toSingle = to->mutable_bullets(to->bullet_count());
+    if (blI < to->bullets_size()) {
+        Bullet* toSingle = to->mutable_bullets(blI);
         toSingle->set_id(globalPrimitiveConsts->terminating_bullet_id());
     }
 
-    for (int i = 0; i < from->dynamic_traps_size(); i++) {
-        const Trap* fromSingle = &(from->dynamic_traps(i));
-        Trap* toSingle = i < to->dynamic_traps_size() ? to->mutable_dynamic_traps(i) : to->add_dynamic_traps();
+    for (int i = to->dynamic_traps_size(); i < from->dynamic_traps_size(); i++) {
+        CopyTrap(&(from->dynamic_traps(i)), to->add_dynamic_traps());
+    }
+    int tpI = 0;
+    for (; tpI < from->dynamic_traps_size(); tpI++) {
+        const Trap* fromSingle = &(from->dynamic_traps(tpI));
+        if (globalPrimitiveConsts->terminating_trap_id() == fromSingle->id()) break;
+        Trap* toSingle = to->mutable_dynamic_traps(tpI);
         CopyTrap(fromSingle, toSingle);
     }
-    if (to->dynamic_trap_count() < to->dynamic_traps_size()) {
-        Trap* toSingle = to->mutable_dynamic_traps(to->dynamic_trap_count());
+    if (tpI < to->dynamic_traps_size()) {
+        Trap* toSingle = to->mutable_dynamic_traps(tpI);
         toSingle->set_id(globalPrimitiveConsts->terminating_trap_id());
     }
 
-    for (int i = 0; i < from->triggers_size(); i++) {
-        const Trigger* fromSingle = &(from->triggers(i));
-        Trigger* toSingle = i < to->triggers_size() ? to->mutable_triggers(i) : to->add_triggers();
+    for (int i = to->triggers_size(); i < from->triggers_size(); i++) {
+        CopyTrigger(&(from->triggers(i)), to->add_triggers());
+    }
+    int trI = 0;
+    for (; trI < from->triggers_size(); trI++) {
+        const Trigger* fromSingle = &(from->triggers(trI));
+        if (globalPrimitiveConsts->terminating_trigger_id() == fromSingle->id()) break;
+        Trigger* toSingle = to->mutable_triggers(trI);
         CopyTrigger(fromSingle, toSingle);
     }
-    if (to->trigger_count() < to->triggers_size()) {
-        Trigger* toSingle = to->mutable_triggers(to->trigger_count());
+    if (trI < to->triggers_size()) {
+        Trigger* toSingle = to->mutable_triggers(trI);
         toSingle->set_id(globalPrimitiveConsts->terminating_trigger_id());
     }
 
-    for (int i = 0; i < from->pickables_size(); i++) {
-        const Pickable* fromSingle = &(from->pickables(i));
-        Pickable* toSingle = i < to->pickables_size() ? to->mutable_pickables(i) : to->add_pickables();
+    for (int i = to->pickables_size(); i < from->pickables_size(); i++) {
+        CopyPickable(&(from->pickables(i)), to->add_pickables());
+    }
+    int pkI = 0;
+    for (; pkI < from->pickables_size(); pkI++) {
+        const Pickable* fromSingle = &(from->pickables(pkI));
+        if (globalPrimitiveConsts->terminating_pickable_id() == fromSingle->id()) break;
+        Pickable* toSingle = to->mutable_pickables(pkI);
         CopyPickable(fromSingle, toSingle);
     }
-    if (to->pickable_count() < to->pickables_size()) {
-        Pickable* toSingle = to->mutable_pickables(to->pickable_count());
+    if (pkI < to->pickables_size()) {
+        Pickable* toSingle = to->mutable_pickables(pkI);
         toSingle->set_id(globalPrimitiveConsts->terminating_pickable_id());
     }
 }
@@ -5898,8 +5881,8 @@ void BaseBattle::CopyRdf(const RenderFrame* from, RenderFrame* to) {
 void BaseBattle::CopyPlayerChd(const PlayerCharacterDownsync* from, PlayerCharacterDownsync* to) {
     to->set_join_index(from->join_index());
 
-    to->set_beats_cnt(to->beats_cnt());
-    to->set_beaten_cnt(to->beaten_cnt());
+    to->set_beats_cnt(from->beats_cnt());
+    to->set_beaten_cnt(from->beaten_cnt());
 
     to->set_revival_x(from->revival_x());
     to->set_revival_y(from->revival_y());
@@ -5949,18 +5932,25 @@ void BaseBattle::CopyChd(const CharacterDownsync* from, CharacterDownsync* to) {
 
     // Buff list
     to->set_buff_count(from->buff_count());
-    for (int i = 0; i < from->buff_list_size(); i++) {
-        const Buff* fromSingle = &(from->buff_list(i));
-        Buff* toSingle = i < to->buff_list_size() ? to->mutable_buff_list(i) : to->add_buff_list();
+    // Grown to the full capacity of "from" before the bounded copy, see comments in "CopyRdf"
+    for (int i = to->buff_list_size(); i < from->buff_list_size(); i++) {
+        to->add_buff_list()->CopyFrom(from->buff_list(i));
+    }
+    int buffI = 0;
+    for (; buffI < from->buff_list_size(); buffI++) {
+        const Buff* fromSingle = &(from->buff_list(buffI));
+        if (globalPrimitiveConsts->terminating_buff_species_id() == fromSingle->species_id()) break;
+        Buff* toSingle = to->mutable_buff_list(buffI);
         toSingle->CopyFrom(*fromSingle); // All primitive types, no memory alloc/free would happen
     }
-    if (0 < to->buff_list_size() && to->buff_count() < to->buff_list_size()) {
-        Buff* toSingle = to->mutable_buff_list(to->buff_count());
+    if (buffI < to->buff_list_size()) {
+        Buff* toSingle = to->mutable_buff_list(buffI);
         ClearBuff(toSingle);
     }
 
     // Debuff list
     to->set_debuff_count(from->debuff_count());
+    // [WARNING] Not bounded by the terminator like "buff_list", because "debuff_list" is also accessed by fixed array indices (e.g. "debuff_array_idx_elemental").
     for (int i = 0; i < from->debuff_list_size(); i++) {
         const Debuff* fromSingle = &(from->debuff_list(i));
         Debuff* toSingle = i < to->debuff_list_size() ? to->mutable_debuff_list(i) : to->add_debuff_list();
@@ -6003,13 +5993,18 @@ void BaseBattle::CopyChd(const CharacterDownsync* from, CharacterDownsync* to) {
 
     // Bullet immune records
     to->set_bir_count(from->bir_count());
-    for (int i = 0; i < from->bullet_immune_records_size(); i++) {
-        const BulletImmuneRecord* fromSingle = &(from->bullet_immune_records(i));
-        BulletImmuneRecord* toSingle = i < to->bullet_immune_records_size() ? to->mutable_bullet_immune_records(i) : to->add_bullet_immune_records();
+    for (int i = to->bullet_immune_records_size(); i < from->bullet_immune_records_size(); i++) {
+        to->add_bullet_immune_records()->CopyFrom(from->bullet_immune_records(i));
+    }
+    int birI = 0;
+    for (; birI < from->bullet_immune_records_size(); birI++) {
+        const BulletImmuneRecord* fromSingle = &(from->bullet_immune_records(birI));
+        if (globalPrimitiveConsts->terminating_bullet_id() == fromSingle->bullet_id()) break;
+        BulletImmuneRecord* toSingle = to->mutable_bullet_immune_records(birI);
         toSingle->CopyFrom(*fromSingle);  // All primitive types, no memory alloc/free would happen
     }
-    if (0 < to->bullet_immune_records_size() && to->bir_count() < to->bullet_immune_records_size()) {
-        BulletImmuneRecord* toSingle = to->mutable_bullet_immune_records(to->bir_count());
+    if (birI < to->bullet_immune_records_size()) {
+        BulletImmuneRecord* toSingle = to->mutable_bullet_immune_records(birI);
         ClearBulletImmuneRecord(toSingle);
     }
 
@@ -6188,6 +6183,472 @@ void BaseBattle::CopyPickable(const Pickable* from, Pickable* to) {
     to->CopyFrom(*from);
 }
 
+/*
+[REMINDER] Field-wise equality used by "encodeRepeatedDelta" to detect unchanged slots without serializing them (no reflection is available with "optimize_for = LITE_RUNTIME"). Floats are compared bitwise, such that e.g. "-0.0f" vs "0.0f" is still treated as a change, i.e. "ApplyRdfDelta" reproduces the target exactly.
+
+[WARNING] Every field of these messages in "serializable_data.proto" MUST be listed here, otherwise a change of the missing field is never propagated by "RenderFrameDelta" -- in debug builds "encodeRepeatedDelta" cross-checks the result against the serialized bytes, and "BackendTest/runTestCase9" changes every field one at a time to catch this.
+*/
+static inline bool isSameBitsForDelta(const float lhs, const float rhs) {
+    uint32_t lhsBits, rhsBits;
+    memcpy(&lhsBits, &lhs, sizeof(lhsBits));
+    memcpy(&rhsBits, &rhs, sizeof(rhsBits));
+    return lhsBits == rhsBits;
+}
+
+static inline bool isSameForDelta(const Buff& lhs, const Buff& rhs) {
+    return lhs.species_id() == rhs.species_id()
+        && lhs.stock() == rhs.stock()
+        && lhs.originated_render_frame_id() == rhs.originated_render_frame_id()
+        && lhs.orig_ch_species_id() == rhs.orig_ch_species_id()
+        && lhs.orig_repel_soft_pushback() == rhs.orig_repel_soft_pushback()
+        && lhs.orig_omit_gravity() == rhs.orig_omit_gravity();
+}
+
+static inline bool isSameForDelta(const Debuff& lhs, const Debuff& rhs) {
+    return lhs.species_id() == rhs.species_id()
+        && lhs.stock() == rhs.stock();
+}
+
+static inline bool isSameForDelta(const BulletImmuneRecord& lhs, const BulletImmuneRecord& rhs) {
+    return lhs.bullet_id() == rhs.bullet_id()
+        && lhs.remaining_lifetime_rdf_count() == rhs.remaining_lifetime_rdf_count();
+}
+
+static inline bool isSameForDelta(const InventorySlot& lhs, const InventorySlot& rhs) {
+    return lhs.stock_type() == rhs.stock_type()
+        && lhs.quota() == rhs.quota()
+        && lhs.frames_to_recover() == rhs.frames_to_recover()
+        && lhs.gauge_charged() == rhs.gauge_charged()
+        && lhs.adhoc_skill_id() == rhs.adhoc_skill_id();
+}
+
+template <typename T>
+static inline bool isSameForDelta(const google::protobuf::RepeatedPtrField<T>& lhs, const google::protobuf::RepeatedPtrField<T>& rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (int i = 0; i < lhs.size(); i++) {
+        if (!isSameForDelta(lhs.Get(i), rhs.Get(i))) return false;
+    }
+    return true;
+}
+
+static inline bool isSameForDelta(const google::protobuf::RepeatedField<float>& lhs, const google::protobuf::RepeatedField<float>& rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (int i = 0; i < lhs.size(); i++) {
+        if (!isSameBitsForDelta(lhs.Get(i), rhs.Get(i))) return false;
+    }
+    return true;
+}
+
+static inline bool isSameForDelta(const CharacterDownsync& lhs, const CharacterDownsync& rhs) {
+    return isSameBitsForDelta(lhs.x(), rhs.x())
+        && isSameBitsForDelta(lhs.y(), rhs.y())
+        && isSameBitsForDelta(lhs.z(), rhs.z())
+        && isSameBitsForDelta(lhs.q_x(), rhs.q_x())
+        && isSameBitsForDelta(lhs.q_y(), rhs.q_y())
+        && isSameBitsForDelta(lhs.q_z(), rhs.q_z())
+        && isSameBitsForDelta(lhs.q_w(), rhs.q_w())
+        && isSameBitsForDelta(lhs.vel_x(), rhs.vel_x())
+        && isSameBitsForDelta(lhs.vel_y(), rhs.vel_y())
+        && isSameBitsForDelta(lhs.vel_z(), rhs.vel_z())
+        && isSameBitsForDelta(lhs.ground_vel_x(), rhs.ground_vel_x())
+        && isSameBitsForDelta(lhs.ground_vel_y(), rhs.ground_vel_y())
+        && isSameBitsForDelta(lhs.ground_vel_z(), rhs.ground_vel_z())
+        && isSameBitsForDelta(lhs.aiming_q_x(), rhs.aiming_q_x())
+        && isSameBitsForDelta(lhs.aiming_q_y(), rhs.aiming_q_y())
+        && isSameBitsForDelta(lhs.aiming_q_z(), rhs.aiming_q_z())
+        && isSameBitsForDelta(lhs.aiming_q_w(), rhs.aiming_q_w())
+        && lhs.walkstopping_rdf_countdown() == rhs.walkstopping_rdf_countdown()
+        && lhs.fallstopping_rdf_countdown() == rhs.fallstopping_rdf_countdown()
+        && lhs.hit_self_stun_frames() == rhs.hit_self_stun_frames()
+        && lhs.omit_gravity() == rhs.omit_gravity()
+        && lhs.species_id() == rhs.species_id()
+        && lhs.ground_ud() == rhs.ground_ud()
+        && lhs.wall_ud() == rhs.wall_ud()
+        && lhs.frames_to_recover() == rhs.frames_to_recover()
+        && lhs.new_birth_rdf_countdown() == rhs.new_birth_rdf_countdown()
+        && lhs.frames_invinsible() == rhs.frames_invinsible()
+        && lhs.parry_prep_rdf_cnt_down() == rhs.parry_prep_rdf_cnt_down()
+        && lhs.mp_regen_rdf_countdown() == rhs.mp_regen_rdf_countdown()
+        && lhs.bullet_team_id() == rhs.bullet_team_id()
+        && lhs.remaining_air_jump_quota() == rhs.remaining_air_jump_quota()
+        && lhs.remaining_air_dash_quota() == rhs.remaining_air_dash_quota()
+        && lhs.damaged_hint_rdf_countdown() == rhs.damaged_hint_rdf_countdown()
+        && lhs.damaged_elemental_attrs() == rhs.damaged_elemental_attrs()
+        && lhs.remaining_def1_quota() == rhs.remaining_def1_quota()
+        && lhs.combo_hit_cnt() == rhs.combo_hit_cnt()
+        && lhs.combo_frames_remained() == rhs.combo_frames_remained()
+        && lhs.last_damaged_by_ud() == rhs.last_damaged_by_ud()
+        && lhs.last_damaged_by_bullet_team_id() == rhs.last_damaged_by_bullet_team_id()
+        && lhs.active_skill_id() == rhs.active_skill_id()
+        && lhs.active_skill_hit() == rhs.active_skill_hit()
+        && lhs.btn_a_holding_rdf_cnt() == rhs.btn_a_holding_rdf_cnt()
+        && lhs.btn_b_holding_rdf_cnt() == rhs.btn_b_holding_rdf_cnt()
+        && lhs.btn_c_holding_rdf_cnt() == rhs.btn_c_holding_rdf_cnt()
+        && lhs.btn_d_holding_rdf_cnt() == rhs.btn_d_holding_rdf_cnt()
+        && lhs.btn_e_holding_rdf_cnt() == rhs.btn_e_holding_rdf_cnt()
+        && lhs.btn_f_holding_rdf_cnt() == rhs.btn_f_holding_rdf_cnt()
+        && lhs.btn_l_holding_rdf_cnt() == rhs.btn_l_holding_rdf_cnt()
+        && lhs.btn_r_holding_rdf_cnt() == rhs.btn_r_holding_rdf_cnt()
+        && lhs.flying_rdf_countdown() == rhs.flying_rdf_countdown()
+        && lhs.ch_collision_team_id() == rhs.ch_collision_team_id()
+        && isSameBitsForDelta(lhs.speed(), rhs.speed())
+        && lhs.hp() == rhs.hp()
+        && lhs.mp() == rhs.mp()
+        && lhs.ch_state() == rhs.ch_state()
+        && lhs.frames_in_ch_state() == rhs.frames_in_ch_state()
+        && lhs.lower_part_rdf_cnt() == rhs.lower_part_rdf_cnt()
+        && lhs.locking_on_ud() == rhs.locking_on_ud()
+        && isSameBitsForDelta(lhs.ground_norm_x(), rhs.ground_norm_x())
+        && isSameBitsForDelta(lhs.ground_norm_y(), rhs.ground_norm_y())
+        && isSameBitsForDelta(lhs.ground_norm_z(), rhs.ground_norm_z())
+        && lhs.has_atk1_magazine() == rhs.has_atk1_magazine() && (!lhs.has_atk1_magazine() || isSameForDelta(lhs.atk1_magazine(), rhs.atk1_magazine()))
+        && lhs.has_super_atk_gauge() == rhs.has_super_atk_gauge() && (!lhs.has_super_atk_gauge() || isSameForDelta(lhs.super_atk_gauge(), rhs.super_atk_gauge()))
+        && isSameForDelta(lhs.buff_list(), rhs.buff_list())
+        && lhs.buff_count() == rhs.buff_count()
+        && isSameForDelta(lhs.debuff_list(), rhs.debuff_list())
+        && lhs.debuff_count() == rhs.debuff_count()
+        && isSameForDelta(lhs.inventory_slots(), rhs.inventory_slots())
+        && lhs.ivs_count() == rhs.ivs_count()
+        && isSameForDelta(lhs.bullet_immune_records(), rhs.bullet_immune_records())
+        && lhs.bir_count() == rhs.bir_count()
+        && isSameForDelta(lhs.kinematic_knobs(), rhs.kinematic_knobs())
+        && lhs.kk_count() == rhs.kk_count();
+}
+
+static inline bool isSameForDelta(const PlayerCharacterDownsync& lhs, const PlayerCharacterDownsync& rhs) {
+    return lhs.has_chd() == rhs.has_chd() && (!lhs.has_chd() || isSameForDelta(lhs.chd(), rhs.chd()))
+        && lhs.join_index() == rhs.join_index()
+        && lhs.beats_cnt() == rhs.beats_cnt()
+        && lhs.beaten_cnt() == rhs.beaten_cnt()
+        && isSameBitsForDelta(lhs.revival_x(), rhs.revival_x())
+        && isSameBitsForDelta(lhs.revival_y(), rhs.revival_y())
+        && isSameBitsForDelta(lhs.revival_z(), rhs.revival_z())
+        && lhs.revival_q_x() == rhs.revival_q_x()
+        && lhs.revival_q_y() == rhs.revival_q_y()
+        && lhs.revival_q_z() == rhs.revival_q_z()
+        && lhs.revival_q_w() == rhs.revival_q_w()
+        && lhs.not_enough_mp_hint_rdf_countdown() == rhs.not_enough_mp_hint_rdf_countdown()
+        && lhs.cached_cue_cmd() == rhs.cached_cue_cmd()
+        && lhs.goal_as_npc() == rhs.goal_as_npc();
+}
+
+static inline bool isSameForDelta(const NpcCharacterDownsync& lhs, const NpcCharacterDownsync& rhs) {
+    return lhs.has_chd() == rhs.has_chd() && (!lhs.has_chd() || isSameForDelta(lhs.chd(), rhs.chd()))
+        && lhs.id() == rhs.id()
+        && lhs.activated_rdf_id() == rhs.activated_rdf_id()
+        && lhs.cached_cue_cmd() == rhs.cached_cue_cmd()
+        && lhs.last_fled_rdf_id() == rhs.last_fled_rdf_id()
+        && lhs.goal_as_npc() == rhs.goal_as_npc()
+        && lhs.publishing_mask_upon_exhausted() == rhs.publishing_mask_upon_exhausted()
+        && lhs.publishing_to_trigger_id_upon_exhausted() == rhs.publishing_to_trigger_id_upon_exhausted()
+        && lhs.subscribes_to_trigger_id() == rhs.subscribes_to_trigger_id()
+        && lhs.captured_by_patrol_cue() == rhs.captured_by_patrol_cue()
+        && lhs.frames_in_patrol_cue() == rhs.frames_in_patrol_cue()
+        && lhs.exhausted_to_drop_pkt() == rhs.exhausted_to_drop_pkt()
+        && lhs.is_main_tower_of_team() == rhs.is_main_tower_of_team()
+        && lhs.waiving_patrol_cue_id() == rhs.waiving_patrol_cue_id();
+}
+
+static inline bool isSameForDelta(const Bullet& lhs, const Bullet& rhs) {
+    return lhs.bl_state() == rhs.bl_state()
+        && lhs.frames_in_bl_state() == rhs.frames_in_bl_state()
+        && lhs.ud() == rhs.ud()
+        && lhs.originated_render_frame_id() == rhs.originated_render_frame_id()
+        && lhs.offender_ud() == rhs.offender_ud()
+        && isSameBitsForDelta(lhs.x(), rhs.x())
+        && isSameBitsForDelta(lhs.y(), rhs.y())
+        && isSameBitsForDelta(lhs.z(), rhs.z())
+        && isSameBitsForDelta(lhs.q_x(), rhs.q_x())
+        && isSameBitsForDelta(lhs.q_y(), rhs.q_y())
+        && isSameBitsForDelta(lhs.q_z(), rhs.q_z())
+        && isSameBitsForDelta(lhs.q_w(), rhs.q_w())
+        && isSameBitsForDelta(lhs.vel_x(), rhs.vel_x())
+        && isSameBitsForDelta(lhs.vel_y(), rhs.vel_y())
+        && isSameBitsForDelta(lhs.vel_z(), rhs.vel_z())
+        && isSameBitsForDelta(lhs.originated_x(), rhs.originated_x())
+        && isSameBitsForDelta(lhs.originated_y(), rhs.originated_y())
+        && isSameBitsForDelta(lhs.originated_z(), rhs.originated_z())
+        && lhs.repeat_quota_left() == rhs.repeat_quota_left()
+        && lhs.target_ud() == rhs.target_ud()
+        && lhs.damage_dealed() == rhs.damage_dealed()
+        && lhs.hit_on_ifc() == rhs.hit_on_ifc()
+        && lhs.active_skill_hit() == rhs.active_skill_hit()
+        && lhs.skill_id() == rhs.skill_id()
+        && lhs.id() == rhs.id()
+        && lhs.team_id() == rhs.team_id()
+        && lhs.for_ally() == rhs.for_ally()
+        && isSameBitsForDelta(lhs.ground_vel_x(), rhs.ground_vel_x())
+        && isSameBitsForDelta(lhs.ground_vel_y(), rhs.ground_vel_y())
+        && isSameBitsForDelta(lhs.ground_vel_z(), rhs.ground_vel_z());
+}
+
+static inline bool isSameForDelta(const Trap& lhs, const Trap& rhs) {
+    return lhs.id() == rhs.id()
+        && lhs.tpt() == rhs.tpt()
+        && lhs.trap_state() == rhs.trap_state()
+        && lhs.frames_in_trap_state() == rhs.frames_in_trap_state()
+        && isSameBitsForDelta(lhs.x(), rhs.x())
+        && isSameBitsForDelta(lhs.y(), rhs.y())
+        && isSameBitsForDelta(lhs.z(), rhs.z())
+        && isSameBitsForDelta(lhs.q_x(), rhs.q_x())
+        && isSameBitsForDelta(lhs.q_y(), rhs.q_y())
+        && isSameBitsForDelta(lhs.q_z(), rhs.q_z())
+        && isSameBitsForDelta(lhs.q_w(), rhs.q_w())
+        && isSameBitsForDelta(lhs.vel_x(), rhs.vel_x())
+        && isSameBitsForDelta(lhs.vel_y(), rhs.vel_y())
+        && isSameBitsForDelta(lhs.vel_z(), rhs.vel_z())
+        && isSameBitsForDelta(lhs.ang_vel_x(), rhs.ang_vel_x())
+        && isSameBitsForDelta(lhs.ang_vel_y(), rhs.ang_vel_y())
+        && isSameBitsForDelta(lhs.ang_vel_z(), rhs.ang_vel_z());
+}
+
+static inline bool isSameForDelta(const Trigger& lhs, const Trigger& rhs) {
+    return lhs.id() == rhs.id()
+        && lhs.group_id() == rhs.group_id()
+        && lhs.frames_to_fire() == rhs.frames_to_fire()
+        && lhs.frames_to_recover() == rhs.frames_to_recover()
+        && lhs.quota() == rhs.quota()
+        && lhs.bullet_team_id() == rhs.bullet_team_id()
+        && lhs.sub_cycle_index() == rhs.sub_cycle_index()
+        && lhs.state() == rhs.state()
+        && lhs.frames_in_state() == rhs.frames_in_state()
+        && isSameBitsForDelta(lhs.x(), rhs.x())
+        && isSameBitsForDelta(lhs.y(), rhs.y())
+        && isSameBitsForDelta(lhs.z(), rhs.z())
+        && lhs.main_cycle_mask_to_fulfill() == rhs.main_cycle_mask_to_fulfill()
+        && lhs.sub_cycle_mask_to_fulfill() == rhs.sub_cycle_mask_to_fulfill()
+        && lhs.sub_cycle_gen_mask_counter() == rhs.sub_cycle_gen_mask_counter()
+        && lhs.offender_ud() == rhs.offender_ud()
+        && lhs.offender_bullet_team_id() == rhs.offender_bullet_team_id()
+        && lhs.trt() == rhs.trt()
+        && lhs.topo_lv() == rhs.topo_lv();
+}
+
+static inline bool isSameForDelta(const Pickable& lhs, const Pickable& rhs) {
+    return lhs.id() == rhs.id()
+        && lhs.pickup_type() == rhs.pickup_type()
+        && lhs.pk_state() == rhs.pk_state()
+        && lhs.frames_in_pk_state() == rhs.frames_in_pk_state()
+        && isSameBitsForDelta(lhs.x(), rhs.x())
+        && isSameBitsForDelta(lhs.y(), rhs.y())
+        && isSameBitsForDelta(lhs.z(), rhs.z())
+        && isSameBitsForDelta(lhs.vel_x(), rhs.vel_x())
+        && isSameBitsForDelta(lhs.vel_y(), rhs.vel_y())
+        && isSameBitsForDelta(lhs.vel_z(), rhs.vel_z())
+        && lhs.remaining_lifetime_rdf_count() == rhs.remaining_lifetime_rdf_count()
+        && lhs.remaining_recur_quota() == rhs.remaining_recur_quota()
+        && lhs.picker_ud() == rhs.picker_ud();
+}
+
+template <typename T>
+static void encodeRepeatedDelta(const google::protobuf::RepeatedPtrField<T>& baseList, const int baseCnt, const google::protobuf::RepeatedPtrField<T>& targetList, const int targetCnt, google::protobuf::RepeatedField<uint64_t>* outDirtyMask, google::protobuf::RepeatedPtrField<T>* outChanged, [[maybe_unused]] std::string& lhsScratch, [[maybe_unused]] std::string& rhsScratch) {
+    outDirtyMask->Clear();
+    outChanged->Clear();
+    outDirtyMask->Resize(((targetCnt + 63) >> 6), 0);
+    for (int i = 0; i < targetCnt; i++) {
+        const T& targetSingle = targetList.Get(i);
+        if (i < baseCnt) {
+            bool same = isSameForDelta(baseList.Get(i), targetSingle);
+#ifndef NDEBUG
+            // Serialized bytes are deterministic for messages without "map<>" fields, thus a reliable (but slow) reference of "isSameForDelta".
+            baseList.Get(i).SerializeToString(&lhsScratch);
+            targetSingle.SerializeToString(&rhsScratch);
+            JPH_ASSERT(same == (lhsScratch == rhsScratch));
+#endif
+            if (same) continue;
+        }
+        outDirtyMask->Set((i >> 6), outDirtyMask->Get(i >> 6) | (U64_1 << (i & 63)));
+        outChanged->Add()->CopyFrom(targetSingle);
+    }
+}
+
+template <typename T, typename CopyFn, typename ClearFn>
+static bool applyRepeatedDelta(const google::protobuf::RepeatedPtrField<T>& changed, const google::protobuf::RepeatedField<uint64_t>& dirtyMask, const int targetCnt, google::protobuf::RepeatedPtrField<T>* ioList, CopyFn copyFn, ClearFn clearFn) {
+    if (dirtyMask.size() != ((targetCnt + 63) >> 6)) return false;
+    int k = 0;
+    for (int i = 0; i < targetCnt; i++) {
+        bool dirty = (0 != (dirtyMask.Get(i >> 6) & (U64_1 << (i & 63))));
+        if (!dirty) {
+            if (i >= ioList->size()) return false;
+            continue;
+        }
+        if (k >= changed.size()) return false;
+        T* toSingle = i < ioList->size() ? ioList->Mutable(i) : ioList->Add();
+        copyFn(&(changed.Get(k)), toSingle);
+        ++k;
+    }
+    if (k != changed.size()) return false;
+    if (targetCnt < ioList->size()) {
+        clearFn(ioList->Mutable(targetCnt));
+    }
+    return true;
+}
+
+bool BaseBattle::EncodeRdfDelta(const RenderFrame* baseRdf, const RenderFrame* targetRdf, RenderFrameDelta* outDelta) {
+    if (nullptr == baseRdf || nullptr == targetRdf || nullptr == outDelta) return false;
+    if (baseRdf->players_size() != targetRdf->players_size()) return false;
+    outDelta->set_base_rdf_id(baseRdf->id());
+
+    RenderFrame* changed = outDelta->mutable_changed();
+    changed->set_id(targetRdf->id());
+    changed->set_countdown_nanos(targetRdf->countdown_nanos());
+    changed->set_bullet_id_counter(targetRdf->bullet_id_counter());
+    changed->set_bullet_count(targetRdf->bullet_count());
+    changed->set_npc_id_counter(targetRdf->npc_id_counter());
+    changed->set_npc_count(targetRdf->npc_count());
+    changed->set_trigger_count(targetRdf->trigger_count());
+    changed->set_pickable_id_counter(targetRdf->pickable_id_counter());
+    changed->set_pickable_count(targetRdf->pickable_count());
+    changed->set_dynamic_trap_count(targetRdf->dynamic_trap_count());
+    changed->set_checksum(targetRdf->checksum());
+
+    encodeRepeatedDelta(baseRdf->players(), baseRdf->players_size(), targetRdf->players(), targetRdf->players_size(), outDelta->mutable_player_dirty_mask(), changed->mutable_players(), rdfDeltaLhsScratch, rdfDeltaRhsScratch);
+    encodeRepeatedDelta(baseRdf->npcs(), std::min((int)baseRdf->npc_count(), baseRdf->npcs_size()), targetRdf->npcs(), std::min((int)targetRdf->npc_count(), targetRdf->npcs_size()), outDelta->mutable_npc_dirty_mask(), changed->mutable_npcs(), rdfDeltaLhsScratch, rdfDeltaRhsScratch);
+    encodeRepeatedDelta(baseRdf->bullets(), std::min((int)baseRdf->bullet_count(), baseRdf->bullets_size()), targetRdf->bullets(), std::min((int)targetRdf->bullet_count(), targetRdf->bullets_size()), outDelta->mutable_bullet_dirty_mask(), changed->mutable_bullets(), rdfDeltaLhsScratch, rdfDeltaRhsScratch);
+    encodeRepeatedDelta(baseRdf->dynamic_traps(), std::min((int)baseRdf->dynamic_trap_count(), baseRdf->dynamic_traps_size()), targetRdf->dynamic_traps(), std::min((int)targetRdf->dynamic_trap_count(), targetRdf->dynamic_traps_size()), outDelta->mutable_dynamic_trap_dirty_mask(), changed->mutable_dynamic_traps(), rdfDeltaLhsScratch, rdfDeltaRhsScratch);
+    encodeRepeatedDelta(baseRdf->triggers(), std::min((int)baseRdf->trigger_count(), baseRdf->triggers_size()), targetRdf->triggers(), std::min((int)targetRdf->trigger_count(), targetRdf->triggers_size()), outDelta->mutable_trigger_dirty_mask(), changed->mutable_triggers(), rdfDeltaLhsScratch, rdfDeltaRhsScratch);
+    encodeRepeatedDelta(baseRdf->pickables(), std::min((int)baseRdf->pickable_count(), baseRdf->pickables_size()), targetRdf->pickables(), std::min((int)targetRdf->pickable_count(), targetRdf->pickables_size()), outDelta->mutable_pickable_dirty_mask(), changed->mutable_pickables(), rdfDeltaLhsScratch, rdfDeltaRhsScratch);
+
+    return true;
+}
+
+bool BaseBattle::ApplyRdfDelta(const RenderFrameDelta& delta, RenderFrame* ioRdf) {
+    if (nullptr == ioRdf || delta.base_rdf_id() != ioRdf->id()) return false;
+    const RenderFrame& changed = delta.changed();
+    if (changed.players_size() > ioRdf->players_size()) return false;
+
+    ioRdf->set_id(changed.id());
+    ioRdf->set_countdown_nanos(changed.countdown_nanos());
+    ioRdf->set_bullet_id_counter(changed.bullet_id_counter());
+    ioRdf->set_bullet_count(changed.bullet_count());
+    ioRdf->set_npc_id_counter(changed.npc_id_counter());
+    ioRdf->set_npc_count(changed.npc_count());
+    ioRdf->set_trigger_count(changed.trigger_count());
+    ioRdf->set_pickable_id_counter(changed.pickable_id_counter());
+    ioRdf->set_pickable_count(changed.pickable_count());
+    ioRdf->set_dynamic_trap_count(changed.dynamic_trap_count());
+    ioRdf->set_checksum(changed.checksum());
+
+    bool res = applyRepeatedDelta(changed.players(), delta.player_dirty_mask(), ioRdf->players_size(), ioRdf->mutable_players(), [this](const PlayerCharacterDownsync* from, PlayerCharacterDownsync* to) { CopyPlayerChd(from, to); }, [](PlayerCharacterDownsync*) {})
+            && applyRepeatedDelta(changed.npcs(), delta.npc_dirty_mask(), (int)changed.npc_count(), ioRdf->mutable_npcs(), [this](const NpcCharacterDownsync* from, NpcCharacterDownsync* to) { CopyNpcChd(from, to); }, [](NpcCharacterDownsync* single) { single->set_id(globalPrimitiveConsts->terminating_character_id()); })
+            && applyRepeatedDelta(changed.bullets(), delta.bullet_dirty_mask(), (int)changed.bullet_count(), ioRdf->mutable_bullets(), [this](const Bullet* from, Bullet* to) { CopyBullet(from, to); }, [this](Bullet* single) { ClearBullet(single); })
+            && applyRepeatedDelta(changed.dynamic_traps(), delta.dynamic_trap_dirty_mask(), (int)changed.dynamic_trap_count(), ioRdf->mutable_dynamic_traps(), [this](const Trap* from, Trap* to) { CopyTrap(from, to); }, [this](Trap* single) { ClearDynamicTrap(single); })
+            && applyRepeatedDelta(changed.triggers(), delta.trigger_dirty_mask(), (int)changed.trigger_count(), ioRdf->mutable_triggers(), [this](const Trigger* from, Trigger* to) { CopyTrigger(from, to); }, [this](Trigger* single) { ClearTrigger(single); })
+            && applyRepeatedDelta(changed.pickables(), delta.pickable_dirty_mask(), (int)changed.pickable_count(), ioRdf->mutable_pickables(), [this](const Pickable* from, Pickable* to) { CopyPickable(from, to); }, [this](Pickable* single) { ClearPickable(single); });
+
+    if (!res) {
+#ifndef NDEBUG
+        std::ostringstream oss;
+        oss << "ApplyRdfDelta/baseRdfId=" << delta.base_rdf_id() << ", targetRdfId=" << changed.id() << ": malformed delta, the holder is invalidated";
+        Debug::Log(oss.str(), DColor::Orange);
+#endif
+        ioRdf->set_id(globalPrimitiveConsts->terminating_render_frame_id());
+    }
+    return res;
+}
+
+/*
+[REMINDER] Floats are quantized onto a grid of "cLengthNearlySameEps" before hashing, i.e. the same tolerance used by "AssertNearlySame". It's NOT an exact equivalent of "isNearlySame" (2 values straddling a grid boundary still hash differently), but deterministic simulation is expected to produce bitwise identical values anyway, the quantization is only there to absorb "-0.0f vs +0.0f" and last-bit noise.
+*/
+static inline uint64_t mixChecksum(uint64_t h, uint64_t v) {
+    // The finalizer of "splitmix64", cheap and well-distributed enough for desync detection (NOT for security).
+    h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+    h ^= (h >> 30); h *= 0xbf58476d1ce4e5b9ull;
+    h ^= (h >> 27); h *= 0x94d049bb133111ebull;
+    h ^= (h >> 31);
+    return h;
+}
+
+static inline uint64_t mixChecksum(uint64_t h, float v) {
+    return mixChecksum(h, (uint64_t)std::llround((double)v / cLengthNearlySameEps));
+}
+
+static inline uint64_t mixChecksum(uint64_t h, float x, float y, float z) {
+    return mixChecksum(mixChecksum(mixChecksum(h, x), y), z);
+}
+
+static inline uint64_t mixChdChecksum(uint64_t h, const CharacterDownsync& chd) {
+    h = mixChecksum(h, (uint64_t)chd.species_id());
+    h = mixChecksum(h, (uint64_t)chd.ch_state());
+    h = mixChecksum(h, (uint64_t)chd.frames_in_ch_state());
+    h = mixChecksum(h, (uint64_t)chd.hp());
+    h = mixChecksum(h, (uint64_t)chd.mp());
+    h = mixChecksum(h, chd.x(), chd.y(), chd.z());
+    h = mixChecksum(h, chd.vel_x(), chd.vel_y(), chd.vel_z());
+    h = mixChecksum(h, chd.q_x(), chd.q_y(), chd.q_z());
+    h = mixChecksum(h, chd.q_w());
+    return h;
+}
+
+uint64_t BaseBattle::CalcRdfChecksum(const RenderFrame* rdf) {
+    uint64_t h = mixChecksum(0, (uint64_t)rdf->id());
+    h = mixChecksum(h, (uint64_t)rdf->npc_count());
+    h = mixChecksum(h, (uint64_t)rdf->npc_id_counter());
+    h = mixChecksum(h, (uint64_t)rdf->bullet_count());
+    h = mixChecksum(h, (uint64_t)rdf->bullet_id_counter());
+    h = mixChecksum(h, (uint64_t)rdf->pickable_count());
+    h = mixChecksum(h, (uint64_t)rdf->pickable_id_counter());
+    h = mixChecksum(h, (uint64_t)rdf->trigger_count());
+    h = mixChecksum(h, (uint64_t)rdf->dynamic_trap_count());
+
+    for (int i = 0; i < rdf->players_size(); i++) {
+        h = mixChdChecksum(h, rdf->players(i).chd());
+    }
+
+    // [WARNING] Same as "AssertNearlySame", "NpcCharacterDownsync.id", "Bullet.id" and "Pickable.id" are NOT covered because they can be different due to local thread scheduling differences. So is the slot order of npcs, bullets and pickables (see "addNewNpcToNextFrame", "addNewBulletToNextFrame" and "addNewPickableToNextFrame"), hence each of them is hashed from 0 and combined by a commutative sum.
+    uint64_t npcSum = 0;
+    for (int i = 0; i < rdf->npcs_size(); i++) {
+        const NpcCharacterDownsync& single = rdf->npcs(i);
+        if (globalPrimitiveConsts->terminating_character_id() == single.id()) break;
+        npcSum += mixChdChecksum(0, single.chd());
+    }
+    h = mixChecksum(h, npcSum);
+
+    uint64_t blSum = 0;
+    for (int i = 0; i < rdf->bullets_size(); i++) {
+        const Bullet& single = rdf->bullets(i);
+        if (globalPrimitiveConsts->terminating_bullet_id() == single.id()) break;
+        uint64_t blH = mixChecksum(0, (uint64_t)single.bl_state());
+        blH = mixChecksum(blH, (uint64_t)single.frames_in_bl_state());
+        blH = mixChecksum(blH, (uint64_t)single.originated_render_frame_id());
+        blH = mixChecksum(blH, single.x(), single.y(), single.z());
+        blH = mixChecksum(blH, single.vel_x(), single.vel_y(), single.vel_z());
+        blSum += blH;
+    }
+    h = mixChecksum(h, blSum);
+
+    for (int i = 0; i < rdf->dynamic_traps_size(); i++) {
+        const Trap& single = rdf->dynamic_traps(i);
+        if (globalPrimitiveConsts->terminating_trap_id() == single.id()) break;
+        h = mixChecksum(h, (uint64_t)single.id());
+        h = mixChecksum(h, (uint64_t)single.trap_state());
+        h = mixChecksum(h, (uint64_t)single.frames_in_trap_state());
+        h = mixChecksum(h, single.x(), single.y(), single.z());
+        h = mixChecksum(h, single.vel_x(), single.vel_y(), single.vel_z());
+    }
+
+    for (int i = 0; i < rdf->triggers_size(); i++) {
+        const Trigger& single = rdf->triggers(i);
+        if (globalPrimitiveConsts->terminating_trigger_id() == single.id()) break;
+        h = mixChecksum(h, (uint64_t)single.id());
+        h = mixChecksum(h, (uint64_t)single.state());
+        h = mixChecksum(h, (uint64_t)single.frames_in_state());
+    }
+
+    uint64_t pkSum = 0;
+    for (int i = 0; i < rdf->pickables_size(); i++) {
+        const Pickable& single = rdf->pickables(i);
+        if (globalPrimitiveConsts->terminating_pickable_id() == single.id()) break;
+        uint64_t pkH = mixChecksum(0, (uint64_t)single.pk_state());
+        pkH = mixChecksum(pkH, (uint64_t)single.frames_in_pk_state());
+        pkH = mixChecksum(pkH, single.x(), single.y(), single.z());
+        pkSum += pkH;
+    }
+    h = mixChecksum(h, pkSum);
+
+    return h;
+}
+
 bool BaseBattle::useSkill(const int currRdfId, RenderFrame* nextRdf, const CharacterDownsync& currChd, const Vec3& currChdFacing, uint64_t ud, const CharacterConfig* cc, const CharacterBattleSpecificConfig* chOverride, CharacterDownsync* nextChd, int effDx, int effDy, int patternId, bool currEffInAir, bool currCrouching, bool currOnWall, bool currDashing, bool currWalking, bool currInBlockStun, bool currAtked, bool currParalyzed, int& outSkillId, const Skill*& outSkill, const BulletConfig*& outPivotBc) {
     if (globalPrimitiveConsts->pattern_id_no_op() == patternId || globalPrimitiveConsts->pattern_id_unable_to_op() == patternId) {
         return false;
@@ -6203,7 +6664,6 @@ bool BaseBattle::useSkill(const int currRdfId, RenderFrame* nextRdf, const Chara
         notRecovered = (currChd.frames_in_ch_state() >= globalPrimitiveConsts->parried_frames_to_start_cancellable());
     }
 
-    const google::protobuf::Map<uint32, Skill>& skillConfigs = globalConfigConsts->skill_configs();
     const Skill* activeSkillConfig = nullptr;
     const BulletConfig* activeBulletConfig = nullptr;
     int currActiveSkillId = currChd.active_skill_id();
@@ -6298,16 +6758,17 @@ bool BaseBattle::useSkill(const int currRdfId, RenderFrame* nextRdf, const Chara
 */
     }
 
-    if (!skillConfigs.count(targetSkillId)) {
+    const Skill* targetSkillConfigPtr = LookupSkillConfig(targetSkillId);
+    if (nullptr == targetSkillConfigPtr) {
 #ifndef NDEBUG
          std::ostringstream oss;
-         oss << "@currRdfId=" << currRdfId << ", ud=" << ud << ", skillConfigs size=" << skillConfigs.size() << " doesn't contain targetSkillId=" << targetSkillId;
+         oss << "@currRdfId=" << currRdfId << ", ud=" << ud << ", skillConfigs size=" << globalConfigConsts->skill_configs().size() << " doesn't contain targetSkillId=" << targetSkillId;
          Debug::Log(oss.str(), DColor::Yellow);
 #endif // !NDEBUG
         return false;
     }
 
-    const Skill& targetSkillConfig = skillConfigs.at(targetSkillId);
+    const Skill& targetSkillConfig = *targetSkillConfigPtr;
     CharacterState skillBoundChState = targetSkillConfig.bound_ch_state();
 
     if (InAirDashing == skillBoundChState) {
@@ -6881,7 +7342,7 @@ void BaseBattle::stepSingleChdState(const int currRdfId, const RenderFrame* curr
         CollisionUdHolder_ThreadSafe* holder = transientUdToCollisionUdHolder.at(ud);
         int cntNow = holder->GetCnt_Realtime();
         uint64_t udRhs;
-        ContactPoints contactPointsLhs;
+        ContactPointsView contactPointsLhs;
         Vec3 worldSpaceNormIntoPeer;
         BodyID peerBodyID;
         SubShapeID peerSubShapeID;
@@ -6952,16 +7413,18 @@ void BaseBattle::stepSingleChdState(const int currRdfId, const RenderFrame* curr
                 Debug::Log(oss.str(), DColor::Orange);
 #endif // ! NDEBUG
 
-                if (globalPrimitiveConsts->pkts().hp_small() == currPk->pickup_type()) {
-                    const PickableConfig& pkConfig = globalConfigConsts->pickable_configs().at(currPk->pickup_type());
-                    int newHp = nextChd->hp() + pkConfig.amount_1();
+                const PickableConfig* pkConfig = LookupPickableConfig(currPk->pickup_type());
+                JPH_ASSERT(nullptr != pkConfig);
+                if (nullptr == pkConfig) {
+                    // Unknown "pickup_type", consumed without effect.
+                } else if (globalPrimitiveConsts->pkts().hp_small() == currPk->pickup_type()) {
+                    int newHp = nextChd->hp() + pkConfig->amount_1();
                     if (newHp > cc->hp()) {
                         newHp = cc->hp();
                     }
                     nextChd->set_hp(newHp);
                 } else if (globalPrimitiveConsts->pkts().mp_small() == currPk->pickup_type()) {
-                    const PickableConfig& pkConfig = globalConfigConsts->pickable_configs().at(currPk->pickup_type());
-                    int newMp = nextChd->mp() + pkConfig.amount_1();
+                    int newMp = nextChd->mp() + pkConfig->amount_1();
                     if (newMp > cc->mp()) {
                         newMp = cc->mp();
                     }
@@ -7043,7 +7506,7 @@ void BaseBattle::stepSingleChdState(const int currRdfId, const RenderFrame* curr
     }
 
     if (cvSupported) {
-        const TransformedShape& newGroundTs = biNoLock->GetTransformedShape(newGroundBodyID);
+        const TransformedShape& newGroundTs = getSubShapeTransformedShape(newGroundBodyID, collector.mGroundBodySubShapeID);
         const AABox& newGroundAABB = newGroundTs.GetWorldSpaceBounds();
         const bool roughlyOnGroundTop = isLhsCharacterRoughlyOnRhsTop(currChd, newGroundAABB);
         newGroundVel = biNoLock->GetLinearVelocity(newGroundBodyID);
@@ -7277,7 +7740,7 @@ void BaseBattle::stepSingleChdState(const int currRdfId, const RenderFrame* curr
         /* 
         [WARNING] A character might've already been pushed away from its "groundUd" by [ghost-collisions](https://jrouwe.github.io/JoltPhysics/index.html#ghost-collisions) due to multiple-same-direction-impulses from position-&velocity-constraint-solving in the same RenderFrame. 
         */
-        const TransformedShape& groundTs = biNoLock->GetTransformedShape(newGroundBodyID);
+        const TransformedShape& groundTs = getSubShapeTransformedShape(newGroundBodyID, collector.mGroundBodySubShapeID);
 
         const AABox& groundAABB = groundTs.GetWorldSpaceBounds();
 
@@ -7323,10 +7786,7 @@ void BaseBattle::stepOtherSingleTriggerState(const int currRdfId, const Trigger&
     bool subCycleFulfilled = (TriggerState::TrSubCycleReady == currTrigger.state() && 0 == currTrigger.sub_cycle_mask_to_fulfill() && 0 >= currTrigger.frames_to_recover());
     bool mainCycleExhausted = false;
 
-    TriggerConfigFromTiled* triggerConfigFromTiled = nullptr;
-    if (triggerConfigFromTileDict.count(steppingTriggerId)) {
-        triggerConfigFromTiled = triggerConfigFromTileDict.at(steppingTriggerId);
-    }
+    TriggerConfigFromTiled* triggerConfigFromTiled = findTriggerConfigFromTiled(steppingTriggerId);
 
     int newFramesToRecover = globalPrimitiveConsts->default_tr_recovery_frames();
     if (nullptr != triggerConfigFromTiled) {
@@ -7415,8 +7875,8 @@ void BaseBattle::stepOtherSingleTriggerState(const int currRdfId, const Trigger&
 
 void BaseBattle::stepSingleIndiWavePickableSpawner(const int currRdfId, const Trigger& currTrigger, Trigger* nextTrigger, RenderFrame* nextRdf, StepResult* stepResult) {
     uint32_t steppingTriggerId = currTrigger.id();
-    JPH_ASSERT(triggerConfigFromTileDict.count(steppingTriggerId));
-    auto* triggerConfigFromTiled = triggerConfigFromTileDict.at(steppingTriggerId);
+    auto* triggerConfigFromTiled = findTriggerConfigFromTiled(steppingTriggerId);
+    JPH_ASSERT(nullptr != triggerConfigFromTiled);
     
     bool mainCycleFulfilled = (TriggerState::TrReady == currTrigger.state()  && 0 == currTrigger.main_cycle_mask_to_fulfill());
     bool mainCycleExhaustedYetFulfilled = (TriggerState::TrExhaustedYetListening == currTrigger.state() && 0 == currTrigger.main_cycle_mask_to_fulfill());
@@ -7526,8 +7986,8 @@ void BaseBattle::stepSingleIndiWavePickableSpawner(const int currRdfId, const Tr
 
 void BaseBattle::stepSingleIndiWaveNpcSpawner(const int currRdfId, const Trigger& currTrigger, Trigger* nextTrigger, RenderFrame* nextRdf, StepResult* stepResult) {
     uint32_t steppingTriggerId = currTrigger.id();
-    JPH_ASSERT(triggerConfigFromTileDict.count(steppingTriggerId));
-    auto* triggerConfigFromTiled = triggerConfigFromTileDict.at(steppingTriggerId);
+    auto* triggerConfigFromTiled = findTriggerConfigFromTiled(steppingTriggerId);
+    JPH_ASSERT(nullptr != triggerConfigFromTiled);
     
     bool mainCycleFulfilled = (TriggerState::TrReady == currTrigger.state()  && 0 == currTrigger.main_cycle_mask_to_fulfill());
     bool mainCycleExhaustedYetFulfilled = (TriggerState::TrExhaustedYetListening == currTrigger.state() && 0 == currTrigger.main_cycle_mask_to_fulfill());
@@ -7716,7 +8176,7 @@ void BaseBattle::handleLhsCharacterCollisionWithRhsBullet(
     RenderFrame* nextRdf,
     const uint64_t udLhs, const uint64_t udtLhs, const CharacterDownsync* currChd, const bool currIsFlying, CharacterDownsync* nextChd, const Vec3& nextChdFacing,
     const uint64_t udRhs, const uint64_t udtRhs, 
-    const ContactPoints& contactPointsLhs,
+    const ContactPointsView& contactPointsLhs,
     uint32_t& outNewEffDebuffSpeciesId, int& outNewDamage, bool& outNewEffBlownUp, int& outNewEffFramesToRecover, int& outEffDef1QuotaReduction, float& outNewEffPushbackVelX, float& outNewEffPushbackVelY, uint64_t& outClosestOffenderUd, float& outClosestOffenderScore, Vec3& outClosestOffenderPosDiff, bool &outShouldSkipGroundServing, bool &outShouldSkipWallServing) {
 
     if (!transientUdToCurrBl.count(udRhs)) {
@@ -7908,6 +8368,60 @@ void BaseBattle::handleLhsCharacterCollisionWithRhsBullet(
     }
 }
 
+std::atomic<int> BaseBattle::sharedJobSysBorrowersCnt = 0;
+
+bool BaseBattle::allocJobSys(JobSystemThreadPool* inSharedJobSys) {
+    if (nullptr != jobSys) return false;
+    /*
+    [WARNING] The process-wide pool is sized for at most "cMaxConcurrentBattlesPerSharedJobSys" battles, i.e. "cMaxPhysicsJobs" jobs and "cMaxPhysicsBarriers" barriers each. Beyond that "JobSystemThreadPool::CreateBarrier" could return nullptr (which "PhysicsSystem::Update" doesn't check), hence the excess battles fall back to a private pool instead of borrowing.
+    */
+    if (nullptr != inSharedJobSys && (int)cMaxConcurrentBattlesPerSharedJobSys > sharedJobSysBorrowersCnt.fetch_add(1)) {
+        /*
+        [REMINDER] 
+        
+        All barriers are created per battle per phase (i.e. "prePhysicsUpdateMTBarrier", "nonContactConstraintSetupMTBarrier", "postPhysicsUpdateMTBarrier" and those created within "PhysicsSystem::Update"), hence multiple battles can step concurrently on the same "JobSystemThreadPool" without waiting for each other's jobs. 
+        */
+        jobSys = inSharedJobSys;
+        jobSysShared = true;
+    } else {
+        if (nullptr != inSharedJobSys) {
+            sharedJobSysBorrowersCnt.fetch_sub(1);
+#ifndef NDEBUG
+            std::ostringstream oss;
+            oss << "allocJobSys/the shared JobSystemThreadPool already has " << cMaxConcurrentBattlesPerSharedJobSys << " borrowers, falling back to a private one";
+            Debug::Log(oss.str(), DColor::Orange);
+#endif
+        }
+        jobSys = new JobSystemThreadPool(cMaxPhysicsJobs, cMaxPhysicsBarriers, thread::hardware_concurrency() - 1);
+        jobSysShared = false;
+    }
+    return true;
+}
+
+bool BaseBattle::deallocJobSys() {
+    if (nullptr == jobSys) return false;
+    if (!jobSysShared) {
+        delete jobSys;
+    } else {
+        sharedJobSysBorrowersCnt.fetch_sub(1);
+    }
+    jobSys = nullptr;
+    jobSysShared = false;
+    return true;
+}
+
+JobSystem::Barrier* BaseBattle::createBarrierBlocking() {
+    /*
+    [WARNING] "JobSystemThreadPool::CreateBarrier" returns nullptr when all barriers are in use, which shouldn't happen given the borrower cap in "allocJobSys" -- but if it does (e.g. "cMaxPhysicsBarriers" underestimated), waiting is safe because every barrier holder is another battle in the middle of a phase that never waits on ours.
+    */
+    JobSystem::Barrier* barrier = jobSys->CreateBarrier();
+    while (nullptr == barrier) {
+        std::this_thread::yield();
+        barrier = jobSys->CreateBarrier();
+    }
+    return barrier;
+}
+
 bool BaseBattle::deallocPhySys() {
     if (nullptr == phySys) return false;
     delete phySys;
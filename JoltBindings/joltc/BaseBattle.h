@@ -9,12 +9,14 @@
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/Core/JobSystemThreadPool.h>
 #include "CharacterCollisionCollector.h"
+#include "BaseNpcReaction.h"
+#include "StepProfiler.h"
 #include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/StaticCompoundShape.h>
 
 #include <vector>
 #include <map>
-#include <set>
 #include <deque>
 
 #ifndef NDEBUG
@@ -33,32 +35,28 @@ My current choice is to
 - use the collected "CollisionUdHolder_ThreadSafe" per character to handle application specific state transitions.
 */
 
-typedef struct VectorFloatHasher {
-    std::size_t operator()(const std::vector<float>& v) const {
-        std::size_t seed = v.size(); // Start with the size of the vector
-        for (float i : v) {
-            seed ^= std::hash<float>()(i) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-        }
-        return seed;
-    }
-} VectorFloatHasher;
-
 // All Jolt symbols are in the JPH namespace
 using namespace JPH;
 using namespace jtshared;
 
 class JOLTC_EXPORT BaseBattle : public JPH::ContactListener, public BaseBattleCollisionFilter {
 public:
-    BaseBattle(int renderBufferSize, int inputBufferSize, TempAllocator* inGlobalTempAllocator, ALLOC_T_FUNC<StepResult, google::protobuf::Arena> arenaAllocStepResultFunc);
+    BaseBattle(int renderBufferSize, int inputBufferSize, TempAllocator* inGlobalTempAllocator, int nBytesForOwnTempAllocator, ALLOC_T_FUNC<StepResult, google::protobuf::Arena> arenaAllocStepResultFunc);
     virtual ~BaseBattle();
 
 public:
     google::protobuf::Arena pbTempAllocator;
-    TempAllocator* globalTempAllocator;
+    TempAllocator* globalTempAllocator; // [WARNING] Shared by all battles in the same process, hence only safe when battles are NOT stepped concurrently -- kept as a fallback when "ownTempAllocator" is not requested.
+    TempAllocatorImplWithMallocFallback* ownTempAllocator; // Owned by this battle, allocated only if "nBytesForOwnTempAllocator > 0" upon construction.
+    TempAllocator* effTempAllocator; // Either "ownTempAllocator" or "globalTempAllocator", the one actually passed to "PhysicsSystem::Update".
 
     google::protobuf::Arena pbSemiPermAllocator; // This is a special pb-arena which shares same lifecycle as the "Battle" object itself w.r.t. memory alloc/free
 
     bool frameLogEnabled = false;
+    /*
+    [WARNING] When "staticBarrierMergeEnabled", all "plain" barriers (i.e. NOT slopes, stairs, slip-jumpable or wall-grab-prohibiting) are merged into a single "StaticCompoundShape" body upon "ResetStartRdf", see "mergedStaticColliderBodyID". It changes "CharacterDownsync.ground_ud/wall_ud" tie-breaking subtly, hence MUST be set identically by all peers of the same battle before "ResetStartRdf".
+    */
+    bool staticBarrierMergeEnabled = false;
     int playersCnt;
     uint64_t allConfirmedMask;
     atomic<uint64_t> inactiveJoinMask; // realtime information
@@ -116,9 +114,17 @@ public:
 
     std::vector<uint64_t> prefabbedInputList;
     std::vector<int> playerInputFrontIds;
-    std::multiset<int> playerInputFrontIdsSorted;
     std::vector<uint64_t> playerInputFronts;
 
+    /*
+    [REMINDER] "minPlayerInputFrontId" and "maxPlayerInputFrontId" are taken over the players whose "playerInputFrontIds" have been updated at least once, i.e. the set bits of "playerInputFrontIdsUpdatedMask" (indexed by "joinIndexArrIdx").
+
+    There're at most 64 join indices and each front only increases, hence "maxPlayerInputFrontId" never needs a rescan and "minPlayerInputFrontId" only needs an O(playersCnt) rescan when the player holding it advances -- no allocation on the per-packet input path.
+    */
+    uint64_t playerInputFrontIdsUpdatedMask = 0;
+    int minPlayerInputFrontId = 0;
+    int maxPlayerInputFrontId = 0;
+
     /*
     [WARNING/BACKEND] At any point of time it's maintained that "lcacIfdId + 1 >= ifdBuffer.StFrameId", i.e. if "StFrameId eviction upon DryPut() of ifdBuffer" occurs, then "lcacIfdId" should also be incremented (along with "currDynamicsRdfId").
 
@@ -142,8 +148,12 @@ public:
     BodyInterface* biNoLock;
     const NarrowPhaseQuery* narrowPhaseQueryNoLock;
     JobSystemThreadPool* jobSys;
+    bool jobSysShared; // When true, "jobSys" is borrowed from the process-wide pool created by "JPH_InitSharedJobSystem" and MUST NOT be deleted by this battle.
+    static std::atomic<int> sharedJobSysBorrowersCnt; // Battles currently holding the process-wide pool, capped by "cMaxConcurrentBattlesPerSharedJobSys" in "allocJobSys"
     DefaultBroadPhaseLayerFilter defaultBplf; 
     DefaultObjectLayerFilter defaultOlf;
+    NpcVisionQueryBatch npcVisionQueryBatch; // Rebuilt per "CalcSingleStep" right before the "npc-post-physics-update" jobs, see "NpcVisionQueryBatch"
+    StepProfiler stepProfiler; // Accumulated over all "CalcSingleStep" calls of this battle (including rollback-chasing), see "APP_GetStepProfile"
 
     /*
     [WARNING] Unlike "AbstractCacheableAnimNodeTemplate", the "activeXxx & cachedXxx" have little to none shared features compared to their GUI counterparts (e.g. handling of "cachedChColliders" is significantly different from that of "cachedTpColliders", and handling of "activeNonContactConstraints & cachedNonContactConstraints" is totally different from all the others), hence NOT suitable for abstracting a shared interface or wrapper class -- at least by the time of writing. 
@@ -171,7 +181,7 @@ public:
 
     Moreover, by using this approach to manage multi-shape character I dropped the "shared shapes across bodies" feature of Jolt.
     */
-    std::unordered_map< CH_CACHE_KEY_T, CH_COLLIDER_Q, VectorFloatHasher > cachedChColliders; // Key is "{(default state) radius, halfHeight}", kindly note that position and orientation of "Character" are mutable during reuse, thus not using "RefConst<>".
+    std::unordered_map< CH_CACHE_KEY_T, CH_COLLIDER_Q > cachedChColliders; // Key is "{(default state) radius, halfHeight}" packed by "calcChCacheKey", kindly note that position and orientation of "Character" are mutable during reuse, thus not using "RefConst<>".
 
     /////////////////////////////////////////////////////Trap Collider Cache/////////////////////////////////////////////////////
     TP_COLLIDER_Q  activeTpColliders;
@@ -206,10 +216,28 @@ public:
         ioYVal *= multiplier;
     }
 
-    static void FindTrapConfig(const uint32_t trapSpeciesId, const uint32_t trapId, const std::unordered_map<uint32_t, const TrapConfigFromTiled*> inTrapConfigFromTileDict, const TrapConfig*& outTpConfig, const TrapConfigFromTiled*& outTpConfigFromTiled);
+    static void FindTrapConfig(const uint32_t trapSpeciesId, const uint32_t trapId, const std::unordered_map<uint32_t, const TrapConfigFromTiled*>& inTrapConfigFromTileDict, const TrapConfig*& outTpConfig, const TrapConfigFromTiled*& outTpConfigFromTiled);
 
     static void FindBulletConfig(const uint32_t skillId, const uint32_t skillHit, const Skill*& outSkill, const BulletConfig*& outBulletConfig);
 
+    virtual uint64_t resolveSubShapeUd(const BodyID& bodyID, const uint64_t bodyUd, const SubShapeID& subShapeID) const override {
+        if (mergedStaticColliderBodyID.IsInvalid() || bodyID != mergedStaticColliderBodyID) {
+            return bodyUd;
+        }
+        SubShapeID remainder;
+        uint32 subShapeIdx = mergedStaticColliderShape->GetSubShapeIndexFromID(subShapeID, remainder);
+        return calcStaticColliderUserData(mergedStaticColliderShape->GetCompoundUserData(subShapeIdx));
+    }
+
+    virtual TransformedShape getSubShapeTransformedShape(const BodyID& bodyID, const SubShapeID& subShapeID) const override {
+        TransformedShape ts = biNoLock->GetTransformedShape(bodyID);
+        if (mergedStaticColliderBodyID.IsInvalid() || bodyID != mergedStaticColliderBodyID) {
+            return ts;
+        }
+        SubShapeID remainder;
+        return ts.GetSubShapeTransformedShape(subShapeID, remainder);
+    }
+
     virtual float calcTerrainPriority(const uint64_t ud) const {
 
         if (transientUdToStairsP.count(ud)) {
@@ -357,6 +385,12 @@ public:
         return oldVal;
     }
 
+    inline bool SetStaticBarrierMergeEnabled(bool val) {
+        bool oldVal = staticBarrierMergeEnabled;
+        staticBarrierMergeEnabled = val;
+        return oldVal;
+    }
+
     inline const CharacterSpawnerConfig* lowerBoundForSpawnerConfig(int rdfId, const google::protobuf::RepeatedPtrField< ::jtshared::CharacterSpawnerConfig >& characterSpawnerTimeSeq) {
         int sz = characterSpawnerTimeSeq.size();
         int l = 0, r = sz;
@@ -404,6 +438,11 @@ public:
 
     virtual bool initTriggerMainAndSubCycles(RenderFrame* startRdf);
 
+    /*
+    A 64-bit hash of the authoritative part of "rdf" (counters, states and quantized kinematics of all alive entities), stable w.r.t. slot order where "AssertNearlySame" is. Written into "RenderFrame.checksum" at the end of "CalcSingleStep", such that desyncs can be detected by comparing a single "uint64_t" per frame instead of the whole frame.
+    */
+    static uint64_t CalcRdfChecksum(const RenderFrame* rdf);
+
     inline static void AssertNearlySame(const RenderFrame* lhs, const RenderFrame* rhs) {
         JPH_ASSERT(lhs->players_size() == rhs->players_size());
         for (int i = 0; i < lhs->players_size(); i++) {
@@ -538,7 +577,7 @@ public:
     }
     
 protected:
-    CH_CACHE_KEY_T chCacheKeyHolder = { 0, 0 };
+    CH_CACHE_KEY_T chCacheKeyHolder = 0;
     BL_CACHE_KEY_T blCacheKeyHolder = BL_CACHE_KEY_T(BulletType::Undetermined, 0, 0);
     TP_CACHE_KEY_T tpCacheKeyHolder = TP_CACHE_KEY_T(cDefaultTpHalfLength, cDefaultTpHalfLength, EMotionType::Dynamic, false, MyObjectLayers::MOVING);
     TR_CACHE_KEY_T trCacheKeyHolder = { 0, 0 };
@@ -549,6 +588,8 @@ protected:
 
     BodyIDVector staticColliderBodyIDs;
     std::unordered_map<uint64_t, const BodyID*> staticColliderUdToBodyID;
+    BodyID mergedStaticColliderBodyID; // Invalid unless "staticBarrierMergeEnabled", in which case all merged static collider uds map to it in "staticColliderUdToBodyID"
+    const StaticCompoundShape* mergedStaticColliderShape = nullptr; // Lifecycle managed by the body of "mergedStaticColliderBodyID", the "CompoundShape::GetCompoundUserData" of each sub-shape is its "staticColliderId"
 
     BodyIDVector bodyIDsToClear;
     BodyIDVector bodyIDsToAdd;
@@ -591,6 +632,37 @@ protected:
     std::unordered_map<uint32_t, const TrapConfigFromTiled*> trapConfigFromTileDict;
     std::unordered_map<uint32_t, TriggerConfigFromTiled*> triggerConfigFromTileDict;
 
+    /*
+    [REMINDER] Dense views of "trapConfigFromTileDict" and "triggerConfigFromTileDict" indexed by trap/trigger id, built once per battle by "buildConfigFromTileTables" in "ResetStartRdf", such that the per-frame paths never hash into the dicts.
+
+    They're indexed by id instead of by slot of "RenderFrame.dynamic_traps/triggers", because "leftShiftDeadDynamicTraps" and "leftShiftDeadTriggers" compact the slots while the ids stay stable throughout a battle.
+    */
+    std::vector<const TrapConfigFromTiled*> trapConfigFromTileTable;
+    std::vector<TriggerConfigFromTiled*> triggerConfigFromTileTable;
+    void buildConfigFromTileTables();
+
+    inline const TrapConfigFromTiled* findTrapConfigFromTiled(const uint32_t trapId) const {
+        if (trapId < trapConfigFromTileTable.size()) return trapConfigFromTileTable[trapId];
+        if (trapId < cMaxDenseConfigId) return nullptr;
+        auto it = trapConfigFromTileDict.find(trapId);
+        return (trapConfigFromTileDict.end() == it ? nullptr : it->second);
+    }
+
+    inline TriggerConfigFromTiled* findTriggerConfigFromTiled(const uint32_t triggerId) const {
+        if (triggerId < triggerConfigFromTileTable.size()) return triggerConfigFromTileTable[triggerId];
+        if (triggerId < cMaxDenseConfigId) return nullptr;
+        auto it = triggerConfigFromTileDict.find(triggerId);
+        return (triggerConfigFromTileDict.end() == it ? nullptr : it->second);
+    }
+
+    inline void findTrapConfig(const Trap& tp, const TrapConfig*& outTpConfig, const TrapConfigFromTiled*& outTpConfigFromTiled) const {
+        // Same semantics as "FindTrapConfig", but never touches "trapConfigFromTileDict".
+        if (globalPrimitiveConsts->terminating_trap_id() == tp.id()) return;
+        outTpConfig = LookupTrapConfig(tp.tpt());
+        if (nullptr == outTpConfig) return;
+        outTpConfigFromTiled = findTrapConfigFromTiled(tp.id());
+    }
+
     InputInducedMotionStockCache inputInducedMotionStockCache;
     CollisionUdHolderStockCache_ThreadSafe collisionUdHolderStockCache;
     
@@ -599,42 +671,42 @@ protected:
 
     std::unordered_set<uint64_t> transientSlipJumpableUds;
     // The tricky terrain "StairsP/N" increases player control complexity, use with caution, recommended to use only in non-battle.
-    std::unordered_map<uint64_t, Vec3> transientUdToSlope;
-    std::unordered_map<uint64_t, Vec3> transientUdToStairsP;
-    std::unordered_map<uint64_t, Vec3> transientUdToStairsN;
+    UdFlatMap<Vec3> transientUdToSlope;
+    UdFlatMap<Vec3> transientUdToStairsP;
+    UdFlatMap<Vec3> transientUdToStairsN;
     std::unordered_set<uint64_t> transientWallGrabProhibitingUds;
     std::unordered_set<uint64_t> transientPreparedTriggerUds;
 
-    std::unordered_map<uint64_t, CH_COLLIDER_T*> transientUdToChCollider;
-    std::unordered_map<uint64_t, const BodyID*> transientUdToBodyID;
-    std::unordered_map<uint64_t, TP_COLLIDER_T*> transientUdToTpCollider;
-    std::unordered_map<uint64_t, const BodyID*> transientUdToConstraintHelperBodyID;
-    std::unordered_map<uint64_t, Body*> transientUdToConstraintHelperBody;
-    std::unordered_map<uint64_t, const BodyID*> transientUdToConstraintObsIfaceBodyID;
-    std::unordered_map<uint64_t, Body*> transientUdToConstraintObsIfaceBody;
+    UdFlatMap<CH_COLLIDER_T*> transientUdToChCollider;
+    UdFlatMap<const BodyID*> transientUdToBodyID;
+    UdFlatMap<TP_COLLIDER_T*> transientUdToTpCollider;
+    UdFlatMap<const BodyID*> transientUdToConstraintHelperBodyID;
+    UdFlatMap<Body*> transientUdToConstraintHelperBody;
+    UdFlatMap<const BodyID*> transientUdToConstraintObsIfaceBodyID;
+    UdFlatMap<Body*> transientUdToConstraintObsIfaceBody;
 
-    std::unordered_map<uint64_t, CollisionUdHolder_ThreadSafe*> transientUdToCollisionUdHolder;
-    std::unordered_map<uint64_t, InputInducedMotion*> transientUdToInputInducedMotion;
+    UdFlatMap<CollisionUdHolder_ThreadSafe*> transientUdToCollisionUdHolder;
+    UdFlatMap<InputInducedMotion*> transientUdToInputInducedMotion;
 
-    std::unordered_map<uint64_t, const PlayerCharacterDownsync*> transientUdToCurrPlayer;
-    std::unordered_map<uint64_t, PlayerCharacterDownsync*> transientUdToNextPlayer;
+    UdFlatMap<const PlayerCharacterDownsync*> transientUdToCurrPlayer;
+    UdFlatMap<PlayerCharacterDownsync*> transientUdToNextPlayer;
 
-    std::unordered_map<uint64_t, const NpcCharacterDownsync*> transientUdToCurrNpc; // Mainly for "Bullet.offender_ud" referencing characters, and avoiding the unnecessary [joinIndex change in `leftShiftDeadNpcs` of DLLMU-v2.3.4](https://github.com/genxium/DelayNoMoreUnity/blob/v2.3.4/shared/Battle_builders.cs#L580)
-    std::unordered_map<uint64_t, NpcCharacterDownsync*> transientUdToNextNpc;
+    UdFlatMap<const NpcCharacterDownsync*> transientUdToCurrNpc; // Mainly for "Bullet.offender_ud" referencing characters, and avoiding the unnecessary [joinIndex change in `leftShiftDeadNpcs` of DLLMU-v2.3.4](https://github.com/genxium/DelayNoMoreUnity/blob/v2.3.4/shared/Battle_builders.cs#L580)
+    UdFlatMap<NpcCharacterDownsync*> transientUdToNextNpc;
 
-    std::unordered_map<uint64_t, const Bullet*> transientUdToCurrBl;
-    std::unordered_map<uint64_t, Bullet*> transientUdToNextBl;
+    UdFlatMap<const Bullet*> transientUdToCurrBl;
+    UdFlatMap<Bullet*> transientUdToNextBl;
 
-    std::unordered_map<uint64_t, const Trap*> transientUdToCurrTrap;
-    std::unordered_map<uint64_t, Trap*> transientUdToNextTrap;
+    UdFlatMap<const Trap*> transientUdToCurrTrap;
+    UdFlatMap<Trap*> transientUdToNextTrap;
 
-    std::unordered_map<uint64_t, const Trigger*> transientUdToCurrTrigger;
-    std::unordered_map<uint64_t, Trigger*> transientUdToNextTrigger;
+    UdFlatMap<const Trigger*> transientUdToCurrTrigger;
+    UdFlatMap<Trigger*> transientUdToNextTrigger;
 
-    std::unordered_map<uint64_t, const Pickable*> transientUdToCurrPickable;
-    std::unordered_map<uint64_t, Pickable*> transientUdToNextPickable;
+    UdFlatMap<const Pickable*> transientUdToCurrPickable;
+    UdFlatMap<Pickable*> transientUdToNextPickable;
 
-    std::unordered_map<uint64_t, atomic<int>> transientOffenderUdToSuperAtkGaugeInc;
+    std::unordered_map<uint64_t, atomic<int>> transientOffenderUdToSuperAtkGaugeInc; // [REMINDER] Kept as "std::unordered_map" because "atomic<int>" is not move assignable, and it's only filled once per offender upon "batchPutIntoPhySysFromCache".
 
     inline const CharacterDownsync& immutableCurrChdFromUd(uint64_t ud) {
         uint64_t udt = getUDT(ud);
@@ -662,9 +734,11 @@ protected:
         }
     }
 
+    /*
+    [REMINDER] The raw bits of "{radius, halfHeight}" are packed instead of quantized values, such that the key stays exactly as discriminative as the previous "std::vector<float>" one while being hashed and compared as a single "uint64_t" without heap allocation.
+    */
     inline void calcChCacheKey(const CharacterConfig* cc, CH_CACHE_KEY_T& ioCacheKey) {
-        ioCacheKey[0] = cc->capsule_radius();
-        ioCacheKey[1] = cc->capsule_half_height();
+        ioCacheKey = ((uint64_t)BitCast<uint32>(cc->capsule_radius()) << 32) | (uint64_t)BitCast<uint32>(cc->capsule_half_height());
     }
 
     inline void calcBlCacheKey(const BulletType immediateBType, const float immediateBoxHalfSizeX, const float immediateBoxHalfSizeY, BL_CACHE_KEY_T& ioCacheKey) {
@@ -779,7 +853,7 @@ protected:
         RenderFrame* nextRdf,
         const uint64_t udLhs, const uint64_t udtLhs, const CharacterDownsync* currChd, const bool currIsFlying, CharacterDownsync* nextChd, const Vec3& nextChdFacing,
         const uint64_t udRhs, const uint64_t udtRhs,
-        const ContactPoints& inContactPoints,
+        const ContactPointsView& inContactPoints,
         uint32_t& outNewEffDebuffSpeciesId, int& outNewDamage, bool& outNewEffBlownUp, int& outNewEffFramesToRecover, int& outEffDef1QuotaReduction, float& outNewEffPushbackVelX, float& outNewEffPushbackVelY, uint64_t& outClosestOffenderUd, float& outClosestOffenderScore, Vec3& outClosestOffenderPosDiff, bool& outShouldSkipGroundServing, bool& outShouldSkipWallServing);
 
     bool addBlHitToNextFrame(const int currRdfId, RenderFrame* nextRdf, const Bullet* referenceBullet, const Vec3& newPos, const int damageDealed);
@@ -909,6 +983,12 @@ protected:
     void CopyTrigger(const Trigger* from, Trigger* to);
     void CopyPickable(const Pickable* from, Pickable* to);
 
+public:
+    bool EncodeRdfDelta(const RenderFrame* baseRdf, const RenderFrame* targetRdf, RenderFrameDelta* outDelta); // See comments of "RenderFrameDelta" in "serializable_data.proto"
+    bool ApplyRdfDelta(const RenderFrameDelta& delta, RenderFrame* ioRdf); // "ioRdf" MUST hold the "RenderFrame" of "delta.base_rdf_id()" upon calling, and upon failure its "id" is reset to "terminating_render_frame_id" since it'd be partially patched
+protected:
+    std::string rdfDeltaLhsScratch, rdfDeltaRhsScratch;
+
     bool FillInventorySlotFromConfig(const InventorySlotConfig* from, InventorySlot* to);
     bool FillInventoryFromConfig(const CharacterConfig* chConfig, CharacterDownsync* mutableChd, const CharacterBattleSpecificConfig* ccOverride);
 
@@ -925,10 +1005,9 @@ protected:
     }
 
     inline const CharacterConfig* getCc(uint32_t speciesId) const {
-        auto& ccs = globalConfigConsts->character_configs();
-        JPH_ASSERT(ccs.contains(speciesId));
-        auto& v = ccs.at(speciesId);
-        return &v;
+        const CharacterConfig* cc = LookupCharacterConfig(speciesId);
+        JPH_ASSERT(nullptr != cc);
+        return cc;
     }
 
     inline const TriggerConfig* getTriggerConfig(uint32_t tt) {
@@ -1007,13 +1086,33 @@ protected:
         if (inIfdId <= existingPlayerInputFrontId) {
             return false;
         }
-        auto it = playerInputFrontIdsSorted.find(existingPlayerInputFrontId);
-        if (it != playerInputFrontIdsSorted.end()) {
-            playerInputFrontIdsSorted.erase(it);
-        }
         playerInputFrontIds[inSingleJoinIndexArrIdx] = inIfdId;
         playerInputFronts[inSingleJoinIndexArrIdx] = inSingleInput;
-        playerInputFrontIdsSorted.insert(inIfdId);
+
+        const uint64_t arrIdxBit = (1ULL << inSingleJoinIndexArrIdx);
+        if (0 == playerInputFrontIdsUpdatedMask) {
+            minPlayerInputFrontId = inIfdId;
+            maxPlayerInputFrontId = inIfdId;
+        } else {
+            if (inIfdId > maxPlayerInputFrontId) {
+                maxPlayerInputFrontId = inIfdId;
+            }
+            if (0 == (playerInputFrontIdsUpdatedMask & arrIdxBit)) {
+                if (inIfdId < minPlayerInputFrontId) {
+                    minPlayerInputFrontId = inIfdId;
+                }
+            } else if (existingPlayerInputFrontId == minPlayerInputFrontId) {
+                // The advanced player might've been the only one holding the min.
+                minPlayerInputFrontId = inIfdId;
+                for (int k = 0; k < (int)playerInputFrontIds.size(); ++k) {
+                    if (0 == (playerInputFrontIdsUpdatedMask & (1ULL << k))) continue;
+                    if (playerInputFrontIds[k] < minPlayerInputFrontId) {
+                        minPlayerInputFrontId = playerInputFrontIds[k];
+                    }
+                }
+            }
+        }
+        playerInputFrontIdsUpdatedMask |= arrIdxBit;
         return true;
     }
 
@@ -1079,6 +1178,10 @@ protected:
     virtual bool allocPhySys() = 0;
     virtual bool deallocPhySys();
 
+    bool allocJobSys(JobSystemThreadPool* inSharedJobSys);
+    bool deallocJobSys();
+    JobSystem::Barrier* createBarrierBlocking();
+
     void stringifyPlayerInputsInIfdBuffer(std::ostringstream& oss, int joinIndexArrIdx) {
         if (0 >= ifdBuffer.Cnt) return;
         bool nonEmpty = false;
@@ -1651,19 +1754,19 @@ public:
         if (transientCollisionHolderApplicableUdtPairs.count({ udt1, udt2 })) {
             if (transientUdToCollisionUdHolder.count(ud1)) {
                 CollisionUdHolder_ThreadSafe* udHolder = transientUdToCollisionUdHolder.at(ud1);
-                udHolder->Add_ThreadSafe(ud2, inManifold.mRelativeContactPointsOn1, inManifold.mWorldSpaceNormal, inBody2.GetID(), inManifold.mSubShapeID2);
+                udHolder->Add_ThreadSafe(resolveSubShapeUd(inBody2.GetID(), ud2, inManifold.mSubShapeID2), inManifold.mRelativeContactPointsOn1, inManifold.mWorldSpaceNormal, inBody2.GetID(), inManifold.mSubShapeID2);
             }
 
             if (transientUdToCollisionUdHolder.count(ud2)) {
                 CollisionUdHolder_ThreadSafe* udHolder = transientUdToCollisionUdHolder.at(ud2);
-                udHolder->Add_ThreadSafe(ud1, inManifold.mRelativeContactPointsOn2, -inManifold.mWorldSpaceNormal, inBody1.GetID(), inManifold.mSubShapeID1);
+                udHolder->Add_ThreadSafe(resolveSubShapeUd(inBody1.GetID(), ud1, inManifold.mSubShapeID1), inManifold.mRelativeContactPointsOn2, -inManifold.mWorldSpaceNormal, inBody1.GetID(), inManifold.mSubShapeID1);
             }
         }
 
         if (UDT_TRAP == udt1) {
             uint32_t trapId = getUDPayload(ud1);
-            if (trapConfigFromTileDict.count(trapId)) {
-                const TrapConfigFromTiled* trapConfigFromTiled = trapConfigFromTileDict.at(trapId);
+            const TrapConfigFromTiled* trapConfigFromTiled = findTrapConfigFromTiled(trapId);
+            if (nullptr != trapConfigFromTiled) {
                 if (globalPrimitiveConsts->tpts().conveyor_belt() == trapConfigFromTiled->tpt()) {
                     const AABox& trapAABB = inBody1.GetWorldSpaceBounds();
                     const AABox& rhsAABB = inBody2.GetWorldSpaceBounds();
@@ -1678,8 +1781,8 @@ public:
 
         if (UDT_TRAP == udt2) {
             uint32_t trapId = getUDPayload(ud2);
-            if (trapConfigFromTileDict.count(trapId)) {
-                const TrapConfigFromTiled* trapConfigFromTiled = trapConfigFromTileDict.at(trapId);
+            const TrapConfigFromTiled* trapConfigFromTiled = findTrapConfigFromTiled(trapId);
+            if (nullptr != trapConfigFromTiled) {
                 if (globalPrimitiveConsts->tpts().conveyor_belt() == trapConfigFromTiled->tpt()) {
                     const AABox& lhsAABB = inBody1.GetWorldSpaceBounds();
                     const AABox& trapAABB = inBody2.GetWorldSpaceBounds();
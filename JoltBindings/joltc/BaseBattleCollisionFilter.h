@@ -2,6 +2,7 @@
 #define BASE_BATTLE_COLLISION_FILTER_H_ 1
 
 #include "CppOnlyConsts.h"
+#include "UdFlatMap.h"
 
 #include <atomic>
 #include <utility> // for "std::pair"
@@ -149,7 +150,7 @@ typedef struct PkCacheKeyHasher {
 } PkCacheKeyHasher;
 #define PK_COLLIDER_Q std::vector<PK_COLLIDER_T*>
 
-#define CH_CACHE_KEY_T std::vector<float>
+#define CH_CACHE_KEY_T uint64_t
 #define CH_COLLIDER_T JPH::Character
 #define CH_COLLIDER_Q std::vector<CH_COLLIDER_T*>
 
@@ -342,6 +343,12 @@ public:
 
     virtual float calcTerrainPriority(const uint64_t ud) const = 0;
 
+    /*
+    [REMINDER] A merged static body (see "BaseBattle.staticBarrierMergeEnabled") only carries the ud of its first sub-shape in "Body::GetUserData()", the following resolve the original static collider ud and the leaf "TransformedShape" (e.g. for its AABB) of the hit sub-shape. Both are no-ops for any other body.
+    */
+    virtual uint64_t resolveSubShapeUd(const BodyID& bodyID, const uint64_t bodyUd, const SubShapeID& subShapeID) const = 0;
+    virtual TransformedShape getSubShapeTransformedShape(const BodyID& bodyID, const SubShapeID& subShapeID) const = 0;
+
     inline const uint64_t calcPublishingToTriggerUd(const NpcCharacterDownsync& npcChd) {
         return calcTriggerUserData(npcChd.publishing_to_trigger_id_upon_exhausted());
     }
@@ -14,7 +14,107 @@
 #include "DebugLog.h"
 #endif
 
-void BaseNpcReaction::postStepDeriveNpcVisionReaction(int currRdfId, const Vec3& antiGravityNorm, const float gravityMagnitude, std::unordered_map<uint64_t, const PlayerCharacterDownsync*>& currPlayersMap, std::unordered_map<uint64_t, const NpcCharacterDownsync*>& currNpcsMap, std::unordered_map<uint64_t, const Bullet*>& currBulletsMap, const BodyInterface* biNoLock, const NarrowPhaseQuery* narrowPhaseQuery, const BaseBattleCollisionFilter* baseBattleFilter, const DefaultBroadPhaseLayerFilter& bplf, const DefaultObjectLayerFilter& olf, const CH_COLLIDER_T* selfNpcCollider, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const NpcGoal currNpcGoal, const uint64_t currNpcCachedCueCmd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const uint64_t toRevengeOppoUdt, const uint64_t toRevengeOppoUd, const Vec3& positionDiffForToRevengeOppoUd, NpcGoal& outNextNpcGoal, uint64_t& outCmd, int& outLastFledRdfId) {
+void NpcVisionQueryBatch::Reset() {
+    for (int i = 0; i < clustersCnt; ++i) {
+        clusters[i].candidates.clear();
+    }
+    clustersCnt = 0;
+    broadPhaseQuery = nullptr;
+    bodyLockInterface = nullptr;
+    bplf = nullptr;
+    olf = nullptr;
+    broadPhaseCollector.Reset();
+}
+
+void NpcVisionQueryBatch::Include(const AABox& conservativeVisionAABB) {
+    const float incomingSurfaceArea = conservativeVisionAABB.GetSurfaceArea();
+    for (int i = 0; i < clustersCnt; ++i) {
+        Cluster& cluster = clusters[i];
+        AABox merged = cluster.bounds;
+        merged.Encapsulate(conservativeVisionAABB);
+        if (merged.GetSurfaceArea() <= cClusterMergeSurfaceAreaRatio * (cluster.bounds.GetSurfaceArea() + incomingSurfaceArea)) {
+            cluster.bounds = merged;
+            return;
+        }
+    }
+    if (clustersCnt >= (int)clusters.size()) {
+        clusters.emplace_back();
+    }
+    Cluster& cluster = clusters[clustersCnt++];
+    cluster.bounds = conservativeVisionAABB;
+    cluster.candidates.clear();
+}
+
+void NpcVisionQueryBatch::Gather(const BroadPhaseQuery& inBroadPhaseQuery, const BodyLockInterface& inBodyLockInterface, const BroadPhaseLayerFilter& inBplf, const ObjectLayerFilter& inOlf) {
+    broadPhaseQuery = &inBroadPhaseQuery;
+    bodyLockInterface = &inBodyLockInterface;
+    bplf = &inBplf;
+    olf = &inOlf;
+    for (int i = 0; i < clustersCnt; ++i) {
+        Cluster& cluster = clusters[i];
+        cluster.candidates.clear();
+        cluster.bounds.ExpandBy(Vec3::sReplicate(cCollisionTolerance)); // Same as the "mMaxSeparationDistance" used by "postStepDeriveNpcVisionReaction"
+        broadPhaseCollector.Reset();
+        inBroadPhaseQuery.CollideAABox(cluster.bounds, broadPhaseCollector, inBplf, inOlf);
+        cluster.candidates.reserve(broadPhaseCollector.mHits.size());
+        for (const BodyID& bodyID : broadPhaseCollector.mHits) {
+            BodyLockRead lock(inBodyLockInterface, bodyID);
+            if (!lock.SucceededAndIsInBroadPhase()) continue;
+            cluster.candidates.push_back({ bodyID, lock.GetBody().GetWorldSpaceBounds() });
+        }
+    }
+}
+
+void NpcVisionQueryBatch::collideCandidate(const BodyID& bodyID, const Shape* inShape, Vec3Arg inShapeScale, RMat44Arg inCenterOfMassTransform, const CollideShapeSettings& inCollideShapeSettings, RVec3Arg inBaseOffset, CollideShapeCollector& ioCollector, const BodyFilter& inBodyFilter, const ShapeFilter& inShapeFilter) const {
+    // [REMINDER] Mimics "NarrowPhaseQuery::CollideShape" (https://github.com/jrouwe/JoltPhysics/blob/v5.3.0/Jolt/Physics/Collision/NarrowPhaseQuery.cpp#L219) except for the broadphase traversal.
+    if (!inBodyFilter.ShouldCollide(bodyID)) return;
+    BodyLockRead lock(*bodyLockInterface, bodyID);
+    if (!lock.SucceededAndIsInBroadPhase()) return;
+    const Body& body = lock.GetBody();
+    if (!inBodyFilter.ShouldCollideLocked(body)) return;
+    TransformedShape ts = body.GetTransformedShape();
+    ioCollector.OnBody(body);
+    lock.ReleaseLock();
+    ts.CollideShape(inShape, inShapeScale, inCenterOfMassTransform, inCollideShapeSettings, inBaseOffset, ioCollector, inShapeFilter);
+    ioCollector.OnBodyEnd();
+}
+
+void NpcVisionQueryBatch::CollideShape(const Shape* inShape, Vec3Arg inShapeScale, RMat44Arg inCenterOfMassTransform, const CollideShapeSettings& inCollideShapeSettings, RVec3Arg inBaseOffset, CollideShapeCollector& ioCollector, const BodyFilter& inBodyFilter, const ShapeFilter& inShapeFilter) const {
+    AABox bounds = inShape->GetWorldSpaceBounds(inCenterOfMassTransform, inShapeScale);
+    bounds.ExpandBy(Vec3::sReplicate(inCollideShapeSettings.mMaxSeparationDistance));
+
+    for (int i = 0; i < clustersCnt; ++i) {
+        const Cluster& cluster = clusters[i];
+        if (!cluster.bounds.Contains(bounds)) continue;
+        // Every body overlapping "bounds" also overlaps "cluster.bounds", i.e. is already among "cluster.candidates".
+        for (const Candidate& candidate : cluster.candidates) {
+            if (ioCollector.ShouldEarlyOut()) break;
+            if (!candidate.bounds.Overlaps(bounds)) continue;
+            collideCandidate(candidate.bodyID, inShape, inShapeScale, inCenterOfMassTransform, inCollideShapeSettings, inBaseOffset, ioCollector, inBodyFilter, inShapeFilter);
+        }
+        return;
+    }
+
+#ifndef NDEBUG
+    Debug::Log("NpcVisionQueryBatch::CollideShape/C++ found no containing cluster, falling back to a direct broadphase query", DColor::Orange);
+#endif
+    if (nullptr == broadPhaseQuery) return;
+    AllHitCollisionCollector<CollideShapeBodyCollector> fallbackCollector;
+    broadPhaseQuery->CollideAABox(bounds, fallbackCollector, *bplf, *olf);
+    for (const BodyID& bodyID : fallbackCollector.mHits) {
+        if (ioCollector.ShouldEarlyOut()) break;
+        collideCandidate(bodyID, inShape, inShapeScale, inCenterOfMassTransform, inCollideShapeSettings, inBaseOffset, ioCollector, inBodyFilter, inShapeFilter);
+    }
+}
+
+AABox BaseNpcReaction::CalcConservativeVisionAABB(const CharacterDownsync& currChd, const CharacterConfig* cc) {
+    // The vision shape is a "TaperedCylinderShape" translated by "vision_offset" and rotated arbitrarily (see "postStepDeriveNpcVisionReaction"), hence bounded by a cube of this half extent around the NPC.
+    float visionMaxRadius = (cc->vision_top_radius() > cc->vision_bottom_radius() ? cc->vision_top_radius() : cc->vision_bottom_radius());
+    float halfExtent = std::abs(cc->vision_offset_x()) + std::abs(cc->vision_offset_y()) + cc->vision_half_height() + visionMaxRadius;
+    return AABox::sFromTwoPoints(Vec3(currChd.x() - halfExtent, currChd.y() - halfExtent, currChd.z() - halfExtent), Vec3(currChd.x() + halfExtent, currChd.y() + halfExtent, currChd.z() + halfExtent));
+}
+
+void BaseNpcReaction::postStepDeriveNpcVisionReaction(int currRdfId, const Vec3& antiGravityNorm, const float gravityMagnitude, UdFlatMap<const PlayerCharacterDownsync*>& currPlayersMap, UdFlatMap<const NpcCharacterDownsync*>& currNpcsMap, UdFlatMap<const Bullet*>& currBulletsMap, const BodyInterface* biNoLock, const NarrowPhaseQuery* narrowPhaseQuery, const NpcVisionQueryBatch* visionQueryBatch, const BaseBattleCollisionFilter* baseBattleFilter, const DefaultBroadPhaseLayerFilter& bplf, const DefaultObjectLayerFilter& olf, const CH_COLLIDER_T* selfNpcCollider, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const NpcGoal currNpcGoal, const uint64_t currNpcCachedCueCmd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const uint64_t toRevengeOppoUdt, const uint64_t toRevengeOppoUd, const Vec3& positionDiffForToRevengeOppoUd, NpcGoal& outNextNpcGoal, uint64_t& outCmd, int& outLastFledRdfId) {
 
     Vec3 initVisionOffset(cc->vision_offset_x(), cc->vision_offset_y(), 0);
     auto visionInitTransform = cTurn90DegsAroundZAxisMat.PostTranslated(initVisionOffset); // Rotate, and then translate
@@ -69,7 +169,11 @@ void BaseNpcReaction::postStepDeriveNpcVisionReaction(int currRdfId, const Vec3&
     - using "narrowPhaseInBaseOffset = centerOfMassTranslationOfBody1InWorldSpace" makes "CollideShapeResult.mContactPointOn[1|2]" in "body1 local space"
     */
 
-    narrowPhaseQuery->CollideShape(effVisionShape, scaling, visionCOMTransform, settings, visionNarrowPhaseInBaseOffset, visionHitCollector, bplf, olf, visionBodyFilter);
+    if (nullptr != visionQueryBatch) {
+        visionQueryBatch->CollideShape(effVisionShape, scaling, visionCOMTransform, settings, visionNarrowPhaseInBaseOffset, visionHitCollector, visionBodyFilter);
+    } else {
+        narrowPhaseQuery->CollideShape(effVisionShape, scaling, visionCOMTransform, settings, visionNarrowPhaseInBaseOffset, visionHitCollector, bplf, olf, visionBodyFilter);
+    }
     
     bool hasVisionHit = visionHitCollector.HadHit();
     initVisionShape.Release();
@@ -463,7 +567,7 @@ void BaseNpcReaction::postStepDeriveNpcVisionReaction(int currRdfId, const Vec3&
     outCmd = newCachedCueCmd;
 }
 
-void BaseNpcReaction::extractKeyEntitiesInVision(int currRdfId, const Vec3& antiGravityNorm, std::unordered_map<uint64_t, const PlayerCharacterDownsync*>& currPlayersMap, std::unordered_map<uint64_t, const NpcCharacterDownsync*>& currNpcsMap, std::unordered_map<uint64_t, const Bullet*>& currBulletsMap, const BodyInterface* biNoLock, const NarrowPhaseQuery* narrowPhaseQuery, const BaseBattleCollisionFilter* baseBattleFilter, const CH_COLLIDER_T* selfNpcCollider, const AABox* selfNpcAABB, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const AABox& visionAABB, const Vec3Arg& effVisionOffsetFromNpcChd, const Vec3Arg& visionNarrowPhaseInBaseOffset, const Vec3Arg& visionDirection, const VISION_HIT_COLLECTOR_T& visionHitCollector, uint64_t& outToHandleAllyUd, Vec3& outSelfNpcPositionDiffForAllyUd, uint64_t& outToHandleOppoChUd, Vec3& outSelfNpcPositionDiffForOppoChUd, uint64_t& outToHandleOppoBlUd, Vec3& outSelfNpcPositionDiffForOppoBlUd, uint64_t& outToHandleMvBlockerUd, BodyID& outToHandleMvBlockerBodyID, GapToJump& outCurrGapToJump, GapToJump& outMinGapToJump, GapToJump& outCurrGroundMvTolerance) {
+void BaseNpcReaction::extractKeyEntitiesInVision(int currRdfId, const Vec3& antiGravityNorm, UdFlatMap<const PlayerCharacterDownsync*>& currPlayersMap, UdFlatMap<const NpcCharacterDownsync*>& currNpcsMap, UdFlatMap<const Bullet*>& currBulletsMap, const BodyInterface* biNoLock, const NarrowPhaseQuery* narrowPhaseQuery, const BaseBattleCollisionFilter* baseBattleFilter, const CH_COLLIDER_T* selfNpcCollider, const AABox* selfNpcAABB, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const AABox& visionAABB, const Vec3Arg& effVisionOffsetFromNpcChd, const Vec3Arg& visionNarrowPhaseInBaseOffset, const Vec3Arg& visionDirection, const VISION_HIT_COLLECTOR_T& visionHitCollector, uint64_t& outToHandleAllyUd, Vec3& outSelfNpcPositionDiffForAllyUd, uint64_t& outToHandleOppoChUd, Vec3& outSelfNpcPositionDiffForOppoChUd, uint64_t& outToHandleOppoBlUd, Vec3& outSelfNpcPositionDiffForOppoBlUd, uint64_t& outToHandleMvBlockerUd, BodyID& outToHandleMvBlockerBodyID, GapToJump& outCurrGapToJump, GapToJump& outMinGapToJump, GapToJump& outCurrGroundMvTolerance) {
     if (!visionHitCollector.HadHit()) return;
 
     float selfNpcAABBJumpingAxisAlignment1 = selfNpcAABB->mMax.Dot(antiGravityNorm);
@@ -484,7 +588,7 @@ void BaseNpcReaction::extractKeyEntitiesInVision(int currRdfId, const Vec3& anti
     float selfNpcGroundAABBVisionAlignment1 = 0;
     float selfNpcGroundAABBVisionAlignment2 = 0;
     if (!selfNpcGroundBodyID.IsInvalid()) {
-        const TransformedShape& selfNpcGroundTransformedShape = biNoLock->GetTransformedShape(selfNpcGroundBodyID);
+        const TransformedShape& selfNpcGroundTransformedShape = baseBattleFilter->getSubShapeTransformedShape(selfNpcGroundBodyID, selfNpcCollider->GetGroundSubShapeID());
         const AABox& selfNpcGroundAABB = selfNpcGroundTransformedShape.GetWorldSpaceBounds();
         selfNpcGroundAABBJumpingAxisAlignment1 = selfNpcGroundAABB.mMax.Dot(antiGravityNorm);
         selfNpcGroundAABBJumpingAxisAlignment2 = selfNpcGroundAABB.mMin.Dot(antiGravityNorm);
@@ -496,16 +600,16 @@ void BaseNpcReaction::extractKeyEntitiesInVision(int currRdfId, const Vec3& anti
         const CollideShapeCollector::ResultType hit = visionHitCollector.mHits.at(i);
         const BodyID rhsBodyID = hit.mBodyID2;
         float rhsVisionAlignmentFromNpcChdPosition = visionDirection.Dot(hit.mContactPointOn1 + effVisionOffsetFromNpcChd);
-        if (!rhsBodyID.IsInvalid() && rhsBodyID == selfNpcGroundBodyID) {
+        const uint64_t udRhs = baseBattleFilter->resolveSubShapeUd(rhsBodyID, biNoLock->GetUserData(rhsBodyID), hit.mSubShapeID2);
+        if (!rhsBodyID.IsInvalid() && rhsBodyID == selfNpcGroundBodyID && udRhs == baseBattleFilter->resolveSubShapeUd(selfNpcGroundBodyID, udRhs, selfNpcCollider->GetGroundSubShapeID())) {
             // [WARNING] When "selfNpcGroundBody" is of complicated shape, it's too inefficient to traverse all its vertices and find the largest projected value on "visionDirection", instead we can just allow "selfNpcGroundBody" to collide with "effVisionShape" and use the immediately visible distance as "currGroundMvTolerance" to roughly decide whether or not we can move on.
             outCurrGroundMvTolerance.set_vision_alignment(rhsVisionAlignmentFromNpcChdPosition);
             continue;
             // [WARNING] Intentionally NOT proceeding from here even if the "rhsBodyID" refers to an opponent character or bullet.
         }
         
-        const TransformedShape& rhsTransformedShape = biNoLock->GetTransformedShape(rhsBodyID);
+        const TransformedShape& rhsTransformedShape = baseBattleFilter->getSubShapeTransformedShape(rhsBodyID, hit.mSubShapeID2);
         const AABox& rhsAABB = rhsTransformedShape.GetWorldSpaceBounds();
-        const uint64_t udRhs = biNoLock->GetUserData(rhsBodyID);
         const uint64_t udtRhs = BaseBattleCollisionFilter::getUDT(udRhs);
         switch (udtRhs) {
         case UDT_PLAYER: 
@@ -730,7 +834,7 @@ void BaseNpcReaction::extractKeyEntitiesInVision(int currRdfId, const Vec3& anti
     }
 }
 
-int BaseNpcReaction::deriveNpcVisionReactionAgainstOppoChUd(int currRdfId, std::unordered_map<uint64_t, const PlayerCharacterDownsync*>& currPlayersMap, std::unordered_map<uint64_t, const NpcCharacterDownsync*>& currNpcsMap, const CH_COLLIDER_T* selfNpcCollider, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const bool canJumpWithinInertia, const Vec3& visionDirection, const uint64_t toHandleOppoChUd, const Vec3& selfNpcPositionDiffForOppoChUd, bool& outOpponentBehindMe, bool& outOpponentAboveMe, bool& outOpponentIsAttacking, bool& outOpponentIsFacingMe) {
+int BaseNpcReaction::deriveNpcVisionReactionAgainstOppoChUd(int currRdfId, UdFlatMap<const PlayerCharacterDownsync*>& currPlayersMap, UdFlatMap<const NpcCharacterDownsync*>& currNpcsMap, const CH_COLLIDER_T* selfNpcCollider, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const bool canJumpWithinInertia, const Vec3& visionDirection, const uint64_t toHandleOppoChUd, const Vec3& selfNpcPositionDiffForOppoChUd, bool& outOpponentBehindMe, bool& outOpponentAboveMe, bool& outOpponentIsAttacking, bool& outOpponentIsFacingMe) {
     int ret = TARGET_CH_REACTION_UNCHANGED;
     outOpponentBehindMe = (0 > (selfNpcPositionDiffForOppoChUd.GetX() * visionDirection.GetX()));
     outOpponentAboveMe = cc->capsule_half_height() < selfNpcPositionDiffForOppoChUd.GetY();
@@ -6,7 +6,10 @@
 #include <Jolt/Physics/Body/BodyInterface.h>
 #include <Jolt/Physics/Collision/NarrowPhaseQuery.h>
 #include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+#include <Jolt/Physics/Collision/BroadPhase/BroadPhaseQuery.h>
+#include <Jolt/Physics/Body/BodyLockInterface.h>
 #include <map>
+#include <vector>
 
 using namespace jtshared;
 using namespace JPH;
@@ -42,6 +45,57 @@ const int VISION_SEARCH_RDF_RANDOMIZE_MASK = (1 << 4) + (1 << 3) + (1 << 1);
 const float OPPO_DX_OFFSET = 10.0f; 
 const float TURNAROUND_FROM_MV_BLOCKER_DX_THRESHOLD = 24.0f;
 
+/*
+[REMINDER] Broadphase queries shared by all NPC vision queries of the same "CalcSingleStep".
+
+- "Include(...)" is called (single-threaded) for every NPC that will search its vision in the current step, with a conservative bound of its vision shape, see "BaseNpcReaction::CalcConservativeVisionAABB". Nearby bounds are greedily merged into the same "Cluster" as long as the merged bound isn't much larger than the two parts (see "cClusterMergeSurfaceAreaRatio"), i.e. NPCs far apart never share a cluster.
+- "Gather(...)" then queries the broadphase ONCE per cluster, and records the world-space bounds of each candidate body of that cluster in the broadphase traversal order.
+- "CollideShape(...)" is a drop-in replacement of "NarrowPhaseQuery::CollideShape(...)" for each NPC (read-only, thus safe to be called concurrently from "npc-post-physics-update" jobs), which only tests the candidates of the cluster containing its own vision bounds, i.e. the cost per NPC is bounded by the bodies around its own group instead of those around all NPCs. If no cluster contains its vision bounds (which shouldn't happen), it falls back to a direct broadphase query.
+
+Because pruning a broadphase traversal doesn't reorder the surviving leaves, the hits are collected in exactly the same order as those of "NarrowPhaseQuery::CollideShape(...)", i.e. the tie-breaking of "BaseNpcReaction::extractKeyEntitiesInVision" is unchanged.
+*/
+class NpcVisionQueryBatch {
+public:
+    struct Candidate {
+        BodyID bodyID;
+        AABox bounds;
+    };
+
+    struct Cluster {
+        AABox bounds;
+        std::vector<Candidate> candidates;
+    };
+
+    static constexpr float cClusterMergeSurfaceAreaRatio = 1.0f; // Merges if "SurfaceArea(merged) <= cClusterMergeSurfaceAreaRatio*(SurfaceArea(cluster) + SurfaceArea(incoming))", e.g. 2 equal cubes are merged only if the gap between them is within half of their side length
+
+    NpcVisionQueryBatch() : clustersCnt(0), broadPhaseQuery(nullptr), bodyLockInterface(nullptr), bplf(nullptr), olf(nullptr) {}
+
+    void Reset();
+    void Include(const AABox& conservativeVisionAABB);
+    void Gather(const BroadPhaseQuery& inBroadPhaseQuery, const BodyLockInterface& inBodyLockInterface, const BroadPhaseLayerFilter& inBplf, const ObjectLayerFilter& inOlf);
+    void CollideShape(const Shape* inShape, Vec3Arg inShapeScale, RMat44Arg inCenterOfMassTransform, const CollideShapeSettings& inCollideShapeSettings, RVec3Arg inBaseOffset, CollideShapeCollector& ioCollector, const BodyFilter& inBodyFilter, const ShapeFilter& inShapeFilter = { }) const;
+
+    inline int GetClustersCnt() const { return clustersCnt; }
+    inline int GetCandidatesCnt() const {
+        int res = 0;
+        for (int i = 0; i < clustersCnt; ++i) {
+            res += (int)clusters[i].candidates.size();
+        }
+        return res;
+    }
+
+protected:
+    std::vector<Cluster> clusters; // [REMINDER] Never shrunk, only the first "clustersCnt" are in use, such that "Cluster.candidates" keep their capacities across steps.
+    int clustersCnt;
+    const BroadPhaseQuery* broadPhaseQuery;
+    const BodyLockInterface* bodyLockInterface;
+    const BroadPhaseLayerFilter* bplf;
+    const ObjectLayerFilter* olf;
+    AllHitCollisionCollector<CollideShapeBodyCollector> broadPhaseCollector;
+
+    void collideCandidate(const BodyID& bodyID, const Shape* inShape, Vec3Arg inShapeScale, RMat44Arg inCenterOfMassTransform, const CollideShapeSettings& inCollideShapeSettings, RVec3Arg inBaseOffset, CollideShapeCollector& ioCollector, const BodyFilter& inBodyFilter, const ShapeFilter& inShapeFilter) const;
+};
+
 /*
 [WARNING] The default implementation DOESN'T take into consideration flying/flyable-on-ground NPCs!
 */
@@ -53,16 +107,28 @@ public:
     /*
     [WARNING] Intentionally NOT using "const NpcCharacterDownsync& currNpc" or "NpcCharacterDownsync* nextNpc" in parameters, because I want this class to be also reusable by "PlayerCharacterDownsync" for mocking Player inputs in an online arena when real-player-matching is difficult.
     */
-    virtual void postStepDeriveNpcVisionReaction(int currRdfId, const Vec3& antiGravityNorm, const float gravityMagnitude, std::unordered_map<uint64_t, const PlayerCharacterDownsync*>& currPlayersMap, std::unordered_map<uint64_t, const NpcCharacterDownsync*>& currNpcsMap, std::unordered_map<uint64_t, const Bullet*>& currBulletsMap, const BodyInterface* biNoLock, const NarrowPhaseQuery* narrowPhaseQuery, const BaseBattleCollisionFilter* baseBattleFilter, const DefaultBroadPhaseLayerFilter& bplf, const DefaultObjectLayerFilter& olf, const CH_COLLIDER_T* selfNpcCollider, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const NpcGoal currNpcGoal, const uint64_t currNpcCachedCueCmd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const uint64_t toRevengeOppoUdt, const uint64_t toRevengeOppoUd, const Vec3& positionDiffForToRevengeOppoUd, NpcGoal& outNextNpcGoal, uint64_t& outCmd, int& outLastFledRdfId);
+    virtual void postStepDeriveNpcVisionReaction(int currRdfId, const Vec3& antiGravityNorm, const float gravityMagnitude, UdFlatMap<const PlayerCharacterDownsync*>& currPlayersMap, UdFlatMap<const NpcCharacterDownsync*>& currNpcsMap, UdFlatMap<const Bullet*>& currBulletsMap, const BodyInterface* biNoLock, const NarrowPhaseQuery* narrowPhaseQuery, const NpcVisionQueryBatch* visionQueryBatch, const BaseBattleCollisionFilter* baseBattleFilter, const DefaultBroadPhaseLayerFilter& bplf, const DefaultObjectLayerFilter& olf, const CH_COLLIDER_T* selfNpcCollider, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const NpcGoal currNpcGoal, const uint64_t currNpcCachedCueCmd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const uint64_t toRevengeOppoUdt, const uint64_t toRevengeOppoUd, const Vec3& positionDiffForToRevengeOppoUd, NpcGoal& outNextNpcGoal, uint64_t& outCmd, int& outLastFledRdfId);
 
-    void extractKeyEntitiesInVision(int currRdfId, const Vec3& antiGravityNorm, std::unordered_map<uint64_t, const PlayerCharacterDownsync*>& currPlayersMap, std::unordered_map<uint64_t, const NpcCharacterDownsync*>& currNpcsMap, std::unordered_map<uint64_t, const Bullet*>& currBulletsMap, const BodyInterface* biNoLock, const NarrowPhaseQuery* narrowPhaseQuery, const BaseBattleCollisionFilter* baseBattleFilter, const CH_COLLIDER_T* selfNpcCollider, const AABox* selfNpcAABB, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const AABox& visionAABB, const Vec3Arg& effVisionOffsetFromNpcChd, const Vec3Arg& visionNarrowPhaseInBaseOffset, const Vec3Arg& visionDirection, const VISION_HIT_COLLECTOR_T& visionCastResultCollector, uint64_t& outToHandleAllyUd, Vec3& outSelfNpcPositionDiffForAllyUd, uint64_t& outToHandleOppoChUd, Vec3& outSelfNpcPositionDiffForOppoChUd, uint64_t& outToHandleOppoBlUd, Vec3& outSelfNpcPositionDiffForOppoBlUd, uint64_t& outToHandleMvBlockerUd, BodyID& outToHandleMvBlockerBodyID, GapToJump& outCurrGapToJump, GapToJump& outMinGapToJump, GapToJump& outCurrGroundMvTolerance);
+    void extractKeyEntitiesInVision(int currRdfId, const Vec3& antiGravityNorm, UdFlatMap<const PlayerCharacterDownsync*>& currPlayersMap, UdFlatMap<const NpcCharacterDownsync*>& currNpcsMap, UdFlatMap<const Bullet*>& currBulletsMap, const BodyInterface* biNoLock, const NarrowPhaseQuery* narrowPhaseQuery, const BaseBattleCollisionFilter* baseBattleFilter, const CH_COLLIDER_T* selfNpcCollider, const AABox* selfNpcAABB, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const AABox& visionAABB, const Vec3Arg& effVisionOffsetFromNpcChd, const Vec3Arg& visionNarrowPhaseInBaseOffset, const Vec3Arg& visionDirection, const VISION_HIT_COLLECTOR_T& visionCastResultCollector, uint64_t& outToHandleAllyUd, Vec3& outSelfNpcPositionDiffForAllyUd, uint64_t& outToHandleOppoChUd, Vec3& outSelfNpcPositionDiffForOppoChUd, uint64_t& outToHandleOppoBlUd, Vec3& outSelfNpcPositionDiffForOppoBlUd, uint64_t& outToHandleMvBlockerUd, BodyID& outToHandleMvBlockerBodyID, GapToJump& outCurrGapToJump, GapToJump& outMinGapToJump, GapToJump& outCurrGroundMvTolerance);
 
-    virtual int deriveNpcVisionReactionAgainstOppoChUd(int rdfId, std::unordered_map<uint64_t, const PlayerCharacterDownsync*>& currPlayersMap, std::unordered_map<uint64_t, const NpcCharacterDownsync*>& currNpcsMap, const CH_COLLIDER_T* selfNpcCollider, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const bool canJumpWithinInertia, const Vec3& visionDirection, const uint64_t toHandleOppoChUd, const Vec3& selfNpcPositionDiffForOppoChUd, bool& outOpponentBehindMe, bool& outOpponentAboveMe, bool& outOpponentIsAttacking, bool& outOpponentIsFacingMe);
+    virtual int deriveNpcVisionReactionAgainstOppoChUd(int rdfId, UdFlatMap<const PlayerCharacterDownsync*>& currPlayersMap, UdFlatMap<const NpcCharacterDownsync*>& currNpcsMap, const CH_COLLIDER_T* selfNpcCollider, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const bool canJumpWithinInertia, const Vec3& visionDirection, const uint64_t toHandleOppoChUd, const Vec3& selfNpcPositionDiffForOppoChUd, bool& outOpponentBehindMe, bool& outOpponentAboveMe, bool& outOpponentIsAttacking, bool& outOpponentIsFacingMe);
 
     virtual int deriveReactionAgainstGroundAndMvBlocker(int currRdfId, const Vec3& antiGravityNorm, const float gravityMagnitude, const BodyInterface* biNoLock, const CH_COLLIDER_T* selfNpcCollider, const AABox* selfNpcAABB, const BodyID& selfNpcBodyID, const uint64_t selfNpcUd, const NpcGoal inNpcGoal, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const CharacterConfig* cc, CharacterDownsync* nextChd, const bool cvSupported, const bool cvInAir, const bool cvOnWall, const bool currNotDashing, const bool currEffInAir, const bool currIsFlying, const bool oldNextNotDashing, const bool oldNextEffInAir, const bool inJumpStartupOrJustEnded, CharacterBase::EGroundState cvGroundState, const bool canJumpWithinInertia, const AABox& visionAABB, const Vec3Arg& visionNarrowPhaseInBaseOffset, const Vec3& visionDirection, const BodyID& toHandleMvBlockerBodyID, const uint64_t toHandleMvBlockerUd, const GapToJump& currGapToJump, const GapToJump& minGapToJump, const GapToJump& currGroundMvTolerance, const int visionReactionByFar, const uint64_t toHandleOppoChUd, const Vec3& selfNpcPositionDiffForOppoChUd, const bool opponentBehindMe, const bool opponentAboveMe, const bool opponentIsAttacking, const bool opponentIsFacingMe, const int lastFledRdfId);
 
     virtual int deriveReactionAgainstMvBlockerAfterApproximation(int currRdfId, const Vec3& antiGravityNorm, const uint64_t selfNpcUd, const CharacterDownsync& currChd, const MassProperties& massProps, const Vec3& currChdFacing, const bool cvSupported, const bool canJumpWithinInertia, const bool isMinGapJumpable, const bool isCurrGapJumpable, const bool currGroundCanHoldMeIfWalkOn, const bool toHandleMvBlockerCanHoldMeIfWalkOn, const float currGapToJumpVisionAlignment, const bool temptingToMove, const bool inFleeingGracePeriod, const int visionReactionByFar);
 
+    /*
+    Whether or not an NPC at "npcSlotIdx" of "RenderFrame.npcs" should search its vision at "currRdfId", i.e. once every "vision_search_interval_pow2Minus1U + 1" rdfs, staggered by the slot index such that NPCs of the same species don't all search at the same rdf. When skipped, "NpcCharacterDownsync.goal_as_npc" and "NpcCharacterDownsync.cached_cue_cmd" are just carried over from the current rdf.
+
+    [WARNING] Only deterministic inputs are used here (i.e. NOT "NpcCharacterDownsync.id", which can be different due to local thread scheduling), otherwise frontend and backend might disagree on the derived "cached_cue_cmd".
+    */
+    inline static bool ShouldSearchVision(const int currRdfId, const int npcSlotIdx, const CharacterConfig* cc) {
+        const uint32_t intervalMask = cc->vision_search_interval_pow2minus1u();
+        return 0 == (((uint32_t)currRdfId + ((uint32_t)npcSlotIdx & VISION_SEARCH_RDF_RANDOMIZE_MASK)) & intervalMask);
+    }
+
+    static AABox CalcConservativeVisionAABB(const CharacterDownsync& currChd, const CharacterConfig* cc);
+
     bool isGapJumpable(const float gravityMagnitude, const float forwardDistanceAbs, const float jumpingAxisDistance, const float forwardSpeed, const float chJumpAccSeconds, const float chJumpInitSpeed, const float extraAccendingY);
 };
 
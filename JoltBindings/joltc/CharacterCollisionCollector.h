@@ -121,84 +121,175 @@ public:
 };
 
 using ContactPoints = StaticArray<Vec3, 64>;
+
+/*
+A read-only window into "ContactPointArena_ThreadSafe", exposing the same "size()/at(k)" as "ContactPoints" for the readers.
+*/
+struct ContactPointsView {
+    const Vec3* data = nullptr;
+    int cnt = 0;
+
+    int size() const {
+        return cnt;
+    }
+
+    const Vec3& at(const int k) const {
+        JPH_ASSERT(0 <= k && k < cnt);
+        return data[k];
+    }
+};
+
+/*
+[REMINDER] A pooled storage of contact points shared by all "CollisionUdHolder_ThreadSafe" instances of a "CollisionUdHolderStockCache_ThreadSafe", appended lock-free during "phySys->Update(...)" and reset along with the stock cache per step.
+
+Jolt reduces each "ContactManifold" to at most 4 points for convex pairs (see "PruneContactPoints"), hence the arena is sized by "cAvgContactPointsPerEntry" instead of reserving a whole "ContactPoints" (i.e. 64 points) per entry. Once exhausted, the overflowing contact points are truncated (and the entry itself is still recorded).
+*/
+class ContactPointArena_ThreadSafe {
+private:
+    std::vector<Vec3> points;
+    atomic<int> cnt;
+    int size;
+
+public:
+    static constexpr int cAvgContactPointsPerEntry = 4;
+
+    ContactPointArena_ThreadSafe(const int inSize) : points(inSize, Vec3::sZero()), size(inSize) {
+        cnt = 0;
+    }
+
+    ContactPointsView Append_ThreadSafe(const ContactPoints& inContactPoints) {
+        ContactPointsView res;
+        const int n = (int)inContactPoints.size();
+        if (0 >= n) {
+            return res;
+        }
+        const int st = cnt.fetch_add(n);
+        if (st >= size) {
+            return res;
+        }
+        res.data = points.data() + st;
+        res.cnt = (st + n <= size ? n : size - st);
+        for (int k = 0; k < res.cnt; ++k) {
+            points[st + k] = inContactPoints[k];
+        }
+        return res;
+    }
+
+    void Clear_ThreadSafe() {
+        cnt = 0;
+    }
+};
+
+/*
+[REMINDER] Structure-of-arrays per collided peer, with deduplication by "ud" done once at insertion by a small lock-free open-addressing set, such that readers in the post-physics jobs only walk "[0, GetCnt_Realtime())" without copying contact points or rehashing. 
+
+When several manifolds of a same "ud" are reported, only the one winning the insertion is kept, i.e. equivalent to the previous "first-seen-during-reading" deduplication.
+*/
 class CollisionUdHolder_ThreadSafe {
 private:
+    static constexpr uint64_t cEmptyUdSlot = UINT64_MAX; // Never a valid "ud", because "getUDT(ud)" is always a small index shifted by 32 bits.
+
     std::vector<uint64_t> uds;
-    std::vector<ContactPoints> contactPointsPerUd;
+    std::vector<ContactPointsView> contactPointsPerUd;
     std::vector<Vec3> worldSpaceNorms;
     std::vector<BodyID> bodyIDs;
     std::vector<SubShapeID> subShapeIDs;
     atomic<int> cnt;
     int size;
 
-    std::unordered_set<uint64_t> seenUdsDuringReading_NotThreadSafe;
+    ContactPointArena_ThreadSafe* pointArena;
+
+    std::vector<atomic<uint64_t>> seenUdSlots; // Size is a power of 2 no less than "2*size"
+    uint32_t seenUdSlotsMask;
+
+    // Returns false if "inUd" is already inserted.
+    bool markSeen_ThreadSafe(const uint64_t inUd) {
+        uint32_t slot = (uint32_t)(((inUd ^ (inUd >> 29)) * 0x9E3779B97F4A7C15ull) >> 40) & seenUdSlotsMask;
+        for (uint32_t probe = 0; probe <= seenUdSlotsMask; ++probe, slot = ((slot + 1) & seenUdSlotsMask)) {
+            uint64_t existing = seenUdSlots[slot].load(std::memory_order_relaxed);
+            if (cEmptyUdSlot == existing && seenUdSlots[slot].compare_exchange_strong(existing, inUd, std::memory_order_acq_rel)) {
+                return true;
+            }
+            if (inUd == existing) {
+                return false;
+            }
+        }
+        // Unreachable as long as "seenUdSlots.size() > size", but a full set shouldn't drop the contact.
+        return true;
+    }
 
 public:
-    CollisionUdHolder_ThreadSafe(const int inSize) {
-        size = inSize;
-        uds.reserve(inSize);
-        contactPointsPerUd.reserve(inSize);
-        for (int i = 0; i < inSize; ++i) {
-            uds.push_back(0);
-            contactPointsPerUd.push_back(ContactPoints());
-            worldSpaceNorms.push_back(Vec3::sZero());
-            bodyIDs.push_back(BodyID());
-            subShapeIDs.push_back(SubShapeID());
+    CollisionUdHolder_ThreadSafe(const int inSize, ContactPointArena_ThreadSafe* inPointArena) : uds(inSize, 0), contactPointsPerUd(inSize), worldSpaceNorms(inSize, Vec3::sZero()), bodyIDs(inSize), subShapeIDs(inSize), size(inSize), pointArena(inPointArena) {
+        uint32_t slotsCnt = 1;
+        while (slotsCnt < 2 * (uint32_t)inSize) {
+            slotsCnt <<= 1;
+        }
+        seenUdSlots = std::vector<atomic<uint64_t>>(slotsCnt);
+        seenUdSlotsMask = slotsCnt - 1;
+        for (auto& seenUdSlot : seenUdSlots) {
+            seenUdSlot.store(cEmptyUdSlot, std::memory_order_relaxed);
         }
         cnt = 0;
     }
 
-    // [WARNING] All fields, including "contactPointsPerUd", will be destructed implicitly when "delete holder" is called in "~CollisionUdHolderStockCache_ThreadSafe". See https://github.com/jrouwe/JoltPhysics/blob/v5.3.0/Jolt/Core/StaticArray.h#L44 for more information.
-
     bool Add_ThreadSafe(const uint64_t inUd, const ContactPoints& inContactPoints, const Vec3& inWorldSpaceNorm, const BodyID& inBodyID, const SubShapeID& inSubShapeID) {
+        if (cnt.load(std::memory_order_relaxed) >= size) {
+            return false;
+        }
+        if (!markSeen_ThreadSafe(inUd)) {
+            return false;
+        }
         int idx = cnt.fetch_add(1);
         if (idx >= size) {
             --cnt;
             return false;
         }
         uds[idx] = inUd;
-        contactPointsPerUd[idx] = inContactPoints; // It does work this way, see https://github.com/jrouwe/JoltPhysics/blob/v5.3.0/Jolt/Core/StaticArray.h#L225.
+        contactPointsPerUd[idx] = pointArena->Append_ThreadSafe(inContactPoints);
         worldSpaceNorms[idx] = inWorldSpaceNorm;
         bodyIDs[idx] = inBodyID;
         subShapeIDs[idx] = inSubShapeID;
         return true;
     }
 
-
     int GetCnt_Realtime() const {
         return cnt;
     }
 
-    bool GetUd_NotThreadSafe(const int idx, uint64_t& outUd, ContactPoints& outContactPoints, Vec3& outWorldSpaceNorm, BodyID& outBodyID, SubShapeID& outSubShapeID) {
-        uint64_t cand = uds[idx];
-        if (seenUdsDuringReading_NotThreadSafe.count(cand)) return false;
-        outUd = cand;
+    /*
+    [WARNING] Only valid after "phySys->Update(...)" returns and before the owning "CollisionUdHolderStockCache_ThreadSafe" is cleared, the returned "outContactPoints" points into the shared arena.
+    */
+    bool GetUd_NotThreadSafe(const int idx, uint64_t& outUd, ContactPointsView& outContactPoints, Vec3& outWorldSpaceNorm, BodyID& outBodyID, SubShapeID& outSubShapeID) const {
+        if (0 > idx || idx >= size) return false;
+        outUd = uds[idx];
         outContactPoints = contactPointsPerUd[idx];
         outWorldSpaceNorm = worldSpaceNorms[idx];
         outBodyID = bodyIDs[idx];
         outSubShapeID = subShapeIDs[idx];
-        seenUdsDuringReading_NotThreadSafe.insert(cand);
         return true;
     }
 
     void Clear_ThreadSafe() {
         cnt = 0;
-        seenUdsDuringReading_NotThreadSafe.clear();
+        for (auto& seenUdSlot : seenUdSlots) {
+            seenUdSlot.store(cEmptyUdSlot, std::memory_order_relaxed);
+        }
     }
 };
 
 class CollisionUdHolderStockCache_ThreadSafe {
 private:
     std::vector<CollisionUdHolder_ThreadSafe*> holders;
+    ContactPointArena_ThreadSafe pointArena;
     atomic<int> cnt;
     int size;
 
 public:
-    CollisionUdHolderStockCache_ThreadSafe(const int inSize, const int holderSize) {
+    CollisionUdHolderStockCache_ThreadSafe(const int inSize, const int holderSize) : pointArena(inSize * holderSize * ContactPointArena_ThreadSafe::cAvgContactPointsPerEntry) {
         size = inSize;
         holders.reserve(inSize);
         for (int i = 0; i < inSize; ++i) {
-            holders.push_back(new CollisionUdHolder_ThreadSafe(holderSize));
+            holders.push_back(new CollisionUdHolder_ThreadSafe(holderSize, &pointArena));
         }
         cnt = 0;
     }
@@ -216,6 +307,7 @@ public:
 
     void Clear_ThreadSafe() {
         cnt = 0;
+        pointArena.Clear_ThreadSafe();
     }
 
     ~CollisionUdHolderStockCache_ThreadSafe() {
@@ -276,7 +368,7 @@ public:
     bool                    mCurrIsFlying = false;
     
     virtual void		AddHit(const JPH::CollideShapeResult& inResult) override {
-        const uint64_t udRhs = mBi->GetUserData(inResult.mBodyID2);
+        const uint64_t udRhs = mBaseBattleFilter->resolveSubShapeUd(inResult.mBodyID2, mBi->GetUserData(inResult.mBodyID2), inResult.mSubShapeID2);
         const uint64_t udtRhs = mBaseBattleFilter->getUDT(udRhs);
         AddHit(udRhs, udtRhs, inResult.mBodyID2, inResult.mSubShapeID2, mBaseOffset + inResult.mContactPointOn1, inResult.mPenetrationAxis.Normalized(), false, false);
     }
@@ -16,26 +16,28 @@ namespace MyObjectLayers
     static constexpr ObjectLayer NUM_LAYERS = 4;
 };
 
+/*
+[REMINDER] Row is "inObject1", column is "inObject2", kept symmetric. Looked up per broadphase/narrowphase pair, hence a flat table instead of branching.
+*/
+static constexpr bool cObjectLayerPairCollidable[MyObjectLayers::NUM_LAYERS][MyObjectLayers::NUM_LAYERS] = {
+    /*                            NON_MOVING, MOVING, TRAP_OBSTACLE_INTERFACE, TRAP_HELPER */
+    /* NON_MOVING */              { false,      true,   true,                    false },
+    /* MOVING */                  { true,       true,   false,                   false },
+    /* TRAP_OBSTACLE_INTERFACE */ { true,       false,  true,                    false },
+    /* TRAP_HELPER */             { false,      false,  false,                   false },
+};
+
 /// Class that determines if two object layers can collide
 class JOLTC_EXPORT ObjectLayerPairFilterImpl : public ObjectLayerPairFilter
 {
 public:
     virtual bool ShouldCollide(ObjectLayer inObject1, ObjectLayer inObject2) const override
     {
-        switch (inObject1)
-        {
-        case MyObjectLayers::NON_MOVING:
-            return (inObject2 == MyObjectLayers::MOVING || inObject2 == MyObjectLayers::TRAP_OBSTACLE_INTERFACE);
-        case MyObjectLayers::MOVING:
-            return (inObject2 == MyObjectLayers::MOVING || inObject2 == MyObjectLayers::NON_MOVING);
-        case MyObjectLayers::TRAP_OBSTACLE_INTERFACE:
-            return (inObject2 == MyObjectLayers::NON_MOVING || inObject2 == MyObjectLayers::TRAP_OBSTACLE_INTERFACE);
-        case MyObjectLayers::TRAP_HELPER:
-            return false;
-        default:
+        if (inObject1 >= MyObjectLayers::NUM_LAYERS || inObject2 >= MyObjectLayers::NUM_LAYERS) {
             JPH_ASSERT(false);
             return false;
         }
+        return cObjectLayerPairCollidable[inObject1][inObject2];
     }
 };
 
@@ -96,26 +98,29 @@ private:
     BroadPhaseLayer mObjectToBroadPhase[MyObjectLayers::NUM_LAYERS];
 };
 
+/*
+[REMINDER] Row is the object layer, column is the broadphase layer, see "BPLayerInterfaceImpl" for the 1-on-1 mapping between them.
+*/
+static constexpr bool cObjectVsBroadPhaseLayerCollidable[MyObjectLayers::NUM_LAYERS][MyBPLayers::NUM_LAYERS] = {
+    /*                            NON_MOVING, MOVING, TRAP_OBSTACLE_INTERFACE, TRAP_HELPER */
+    /* NON_MOVING */              { false,      true,   true,                    false },
+    /* MOVING */                  { true,       true,   false,                   false },
+    /* TRAP_OBSTACLE_INTERFACE */ { true,       false,  true,                    false },
+    /* TRAP_HELPER */             { false,      false,  false,                   false },
+};
+
 /// Class that determines if an object layer can collide with a broadphase layer
 class JOLTC_EXPORT ObjectVsBroadPhaseLayerFilterImpl : public ObjectVsBroadPhaseLayerFilter
 {
 public:
     virtual bool ShouldCollide(ObjectLayer inLayer1, BroadPhaseLayer inLayer2) const override
     {
-        switch (inLayer1)
-        {
-        case MyObjectLayers::NON_MOVING:
-            return (inLayer2 == MyBPLayers::MOVING || inLayer2 == MyBPLayers::TRAP_OBSTACLE_INTERFACE);
-        case MyObjectLayers::MOVING:
-            return (inLayer2 == MyBPLayers::MOVING || inLayer2 == MyBPLayers::NON_MOVING);
-        case MyObjectLayers::TRAP_OBSTACLE_INTERFACE:
-            return (inLayer2 == MyBPLayers::NON_MOVING || inLayer2 == MyBPLayers::TRAP_OBSTACLE_INTERFACE);
-        case MyObjectLayers::TRAP_HELPER:
-            return false;
-        default:
+        const BroadPhaseLayer::Type bpLayer2 = (BroadPhaseLayer::Type)inLayer2;
+        if (inLayer1 >= MyObjectLayers::NUM_LAYERS || bpLayer2 >= MyBPLayers::NUM_LAYERS) {
             JPH_ASSERT(false);
             return false;
         }
+        return cObjectVsBroadPhaseLayerCollidable[inLayer1][bpLayer2];
     }
 };
 
@@ -3,6 +3,8 @@
 
 #include "PbConsts.h"
 #include <vector>
+#include <utility>
+#include <initializer_list>
 
 /*
 The "const nomenclature" is as follows.
@@ -50,6 +52,7 @@ const uint32_t cMaxBodies = 1024;
 const uint32_t cNumBodyMutexes = 0;
 const uint32_t cMaxBodyPairs = 1024;
 const uint32_t cMaxContactConstraints = 1024;
+const uint32_t cMaxConcurrentBattlesPerSharedJobSys = 64; // Used to size the process-wide "JobSystemThreadPool" created by "JPH_InitSharedJobSystem", each concurrently stepping battle might occupy up to "cMaxPhysicsJobs" jobs and "cMaxPhysicsBarriers" barriers. Enforced as a borrower cap in "BaseBattle::allocJobSys".
 const float  cDefaultWallDotThreshold = 0.10f;
 const float  cDefaultChDensity = 0.5f;
 const float  cDefaultThickness = 0.02f; // An impossibly small value
@@ -89,16 +92,29 @@ const std::vector<std::vector<int>> DIRECTION_DECODER = {
     { 0, 0 }, // 15
 };
 
-typedef struct PairUint64Hasher {
-    std::size_t operator()(const std::pair<uint64_t, uint64_t>& v) const {
-        std::size_t seed = 2; // Start with the size of the vector
-        seed ^= std::hash<float>()(v.first) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-        seed ^= std::hash<float>()(v.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-        return seed;
+/*
+[REMINDER] A compile-time boolean matrix of "(udt1, udt2)" pairs, indexed by "udt >> 32" (i.e. all UDTs defined above fit in [0, 16)), exposing the same "count({udt1, udt2})" query as the "std::unordered_set" it replaces. It's looked up for every contact manifold in "BaseBattle::OnContactCommon".
+*/
+class UdtPairTable {
+public:
+    static constexpr uint32_t cUdtIndexCnt = 16;
+
+    constexpr UdtPairTable(std::initializer_list<std::pair<uint64_t, uint64_t>> pairs) : applicable{} {
+        for (const std::pair<uint64_t, uint64_t>& p : pairs) {
+            applicable[p.first >> 32][p.second >> 32] = true;
+        }
+    }
+
+    constexpr size_t count(const std::pair<uint64_t, uint64_t>& udtPair) const {
+        const uint64_t idx1 = (udtPair.first >> 32), idx2 = (udtPair.second >> 32);
+        return (idx1 < cUdtIndexCnt && idx2 < cUdtIndexCnt && applicable[idx1][idx2]) ? 1 : 0;
     }
-} PairUint64Hasher;
 
-const std::unordered_set<std::pair<uint64_t, uint64_t>, PairUint64Hasher> transientCollisionHolderApplicableUdtPairs = {
+private:
+    bool applicable[cUdtIndexCnt][cUdtIndexCnt];
+};
+
+constexpr UdtPairTable transientCollisionHolderApplicableUdtPairs = {
     {UDT_PLAYER, UDT_TRIGGER},
     {UDT_NPC,    UDT_TRIGGER},
     {UDT_TRIGGER, UDT_PLAYER},
@@ -25,6 +25,7 @@ class FrameRingBuffer : public RB_T {
 
         void Clear();
         T* DryPut();
+        bool Reserve(int newN); // Grows in place, "StFrameId" and "EdFrameId" are preserved
 
     public:
         std::string toSimpleStat() {
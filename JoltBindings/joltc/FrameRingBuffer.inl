@@ -46,3 +46,9 @@ T* FrameRingBuffer<T, AllocatorType>::DryPut() {
     EdFrameId++;
     return ret;
 }
+
+template <typename T, typename AllocatorType>
+bool FrameRingBuffer<T, AllocatorType>::Reserve(int newN) {
+    // [WARNING] Only the array indices of elements are rebased, each "frameId" still maps to the same element.
+    return RB_T::Reserve(newN);
+}
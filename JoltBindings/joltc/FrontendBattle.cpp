@@ -2,6 +2,7 @@
 
 #include <Jolt/Physics/Collision/RayCast.h>
 #include <Jolt/Physics/Collision/CastResult.h>
+#include <chrono>
 
 bool FrontendBattle::UpsertSelfCmd(uint64_t inSingleInput, int* outChaserRdfId) {
     return UpsertSelfCmd(inSingleInput, outChaserRdfId, nullptr, nullptr);
@@ -92,8 +93,27 @@ bool FrontendBattle::OnDownsyncSnapshotReceived(const DownsyncSnapshot* downsync
     Debug::Log(oss1.str(), DColor::Orange);
 #endif
 */
-    if (downsyncSnapshot->has_ref_rdf() && refRdfId != globalPrimitiveConsts->terminating_render_frame_id()) {
-        const RenderFrame& refRdf = downsyncSnapshot->ref_rdf();
+    const RenderFrame* refRdfPtr = nullptr;
+    if (refRdfId != globalPrimitiveConsts->terminating_render_frame_id()) {
+        if (downsyncSnapshot->has_ref_rdf()) {
+            CopyRdf(&(downsyncSnapshot->ref_rdf()), lastRefRdfHolder);
+            refRdfPtr = lastRefRdfHolder;
+        } else if (downsyncSnapshot->has_ref_rdf_delta()) {
+            if (ApplyRdfDelta(downsyncSnapshot->ref_rdf_delta(), lastRefRdfHolder)) {
+                refRdfPtr = lastRefRdfHolder;
+            } else {
+                // [WARNING] The base is no longer held, e.g. a previous "DownsyncSnapshot" with "ref_rdf" was lost, just wait for the next full "ref_rdf" which backend will send once "acked_ref_rdf_id" mismatches.
+#ifndef NDEBUG
+                std::ostringstream oss0;
+                oss0 << "OnDownsyncSnapshotReceived @timerRdfId=" << timerRdfId << ", refRdfId=" << refRdfId << ", failed to apply ref_rdf_delta against baseRdfId=" << downsyncSnapshot->ref_rdf_delta().base_rdf_id();
+                Debug::Log(oss0.str(), DColor::Orange);
+#endif
+            }
+        }
+    }
+
+    if (nullptr != refRdfPtr) {
+        const RenderFrame& refRdf = *refRdfPtr;
         if (refRdfId >= oldChaserRdfIdLowerBound) {
             bool willEvictRdfSt = (refRdfId >= rdfBuffer.StFrameId + rdfBuffer.N);
             if (willEvictRdfSt) {
@@ -159,6 +179,12 @@ bool FrontendBattle::OnDownsyncSnapshotReceived(const DownsyncSnapshot* downsync
 #endif
 */
             const InputFrameDownsync& refIfd = downsyncSnapshot->ifd_batch(i);
+            if (nullptr != targetHolder) {
+                for (int k = 0; k < playersCnt; ++k) {
+                    if (k == selfJoinIndexArrIdx) continue;
+                    recordInputPrediction(targetHolder, k, refIfd.input_list(k));
+                }
+            }
             if (nullptr != targetHolder && -1 == firstIncorrectlyPredictedIfdId) {
 /*
 #ifndef NDEBUG
@@ -195,7 +221,7 @@ bool FrontendBattle::OnDownsyncSnapshotReceived(const DownsyncSnapshot* downsync
                     int postEvictionIfdStFrameId = ifdBuffer.StFrameId + toEvictIfdCnt;
                     bool willDragTimerRdfUsingDelayedIfdIdForward = (delayedIfdId < postEvictionIfdStFrameId);
                     if (willDragTimerRdfUsingDelayedIfdIdForward) {
-                        if (!downsyncSnapshot->has_ref_rdf()) {
+                        if (nullptr == refRdfPtr) {
                             break;
                         } else {
                             shouldDragTimerRdfUsingDelayedIfdIdForward = true;
@@ -287,14 +313,14 @@ bool FrontendBattle::OnDownsyncSnapshotReceived(const DownsyncSnapshot* downsync
         timerRdfId = refRdfId;
     }
 
-    if (!playerInputFrontIdsSorted.empty()) {
-        *outMaxPlayerInputFrontId = *playerInputFrontIdsSorted.rbegin();
-        *outMinPlayerInputFrontId = *playerInputFrontIdsSorted.begin();
+    if (0 != playerInputFrontIdsUpdatedMask) {
+        *outMaxPlayerInputFrontId = maxPlayerInputFrontId;
+        *outMinPlayerInputFrontId = minPlayerInputFrontId;
 /*
 #ifndef NDEBUG
-        Debug::Log("OnDownsyncSnapshotReceived/C++ updated maxPlayerInputFrontId=" + std::to_string(*outMaxPlayerInputFrontId) + ", minPlayerInputFrontId=" + std::to_string(*outMinPlayerInputFrontId) + " after handling with playerInputFrontIdsSorted.size=" + std::to_string(playerInputFrontIdsSorted.size()), DColor::Orange);
+        Debug::Log("OnDownsyncSnapshotReceived/C++ updated maxPlayerInputFrontId=" + std::to_string(*outMaxPlayerInputFrontId) + ", minPlayerInputFrontId=" + std::to_string(*outMinPlayerInputFrontId) + " after handling with playerInputFrontIdsUpdatedMask=" + std::to_string(playerInputFrontIdsUpdatedMask), DColor::Orange);
     } else {
-        Debug::Log("OnDownsyncSnapshotReceived/C++ got empty playerInputFrontIdsSorted after handling, sth is wrong" , DColor::Orange);
+        Debug::Log("OnDownsyncSnapshotReceived/C++ got empty playerInputFrontIdsUpdatedMask after handling, sth is wrong" , DColor::Orange);
 #endif
 */
     }
@@ -351,9 +377,10 @@ bool FrontendBattle::OnUpsyncSnapshotReceived(const uint32_t peerJoinIndex, cons
         }
 
         const uint64_t cmd = upsyncSnapshot.cmd_list(i);
+        int peerJoinIndexArrIdx = peerJoinIndex - 1;
+        recordInputPrediction(ifdBuffer.GetByFrameId(ifdId), peerJoinIndexArrIdx, cmd);
         bool outExistingInputMutated = false;
         InputFrameDownsync* ifd = getOrPrefabInputFrameDownsync(ifdId, peerJoinIndex, cmd, fromUdp, false, outExistingInputMutated);
-        int peerJoinIndexArrIdx = peerJoinIndex - 1;
         bool frontsUpdated = updatePlayerInputFronts(ifdId, peerJoinIndexArrIdx, cmd);
         if (-1 == firstIncorrectlyPredictedIfdId && outExistingInputMutated) {
             firstIncorrectlyPredictedIfdId = ifdId;
@@ -364,15 +391,15 @@ bool FrontendBattle::OnUpsyncSnapshotReceived(const uint32_t peerJoinIndex, cons
         handleIncorrectlyRenderedPrediction(firstIncorrectlyPredictedIfdId, false, fromUdp, false);
     }
 
-    if (!playerInputFrontIdsSorted.empty()) {
-        *outMaxPlayerInputFrontId = *playerInputFrontIdsSorted.rbegin();
-        *outMinPlayerInputFrontId = *playerInputFrontIdsSorted.begin();
+    if (0 != playerInputFrontIdsUpdatedMask) {
+        *outMaxPlayerInputFrontId = maxPlayerInputFrontId;
+        *outMinPlayerInputFrontId = minPlayerInputFrontId;
 /*
 #ifndef NDEBUG
-        Debug::Log("OnUpsyncSnapshotReceived/C++ updated maxPlayerInputFrontId=" + std::to_string(*outMaxPlayerInputFrontId) + ", minPlayerInputFrontId=" + std::to_string(*outMinPlayerInputFrontId) + " after handling with playerInputFrontIdsSorted.size=" + std::to_string(playerInputFrontIdsSorted.size()), DColor::Orange);
+        Debug::Log("OnUpsyncSnapshotReceived/C++ updated maxPlayerInputFrontId=" + std::to_string(*outMaxPlayerInputFrontId) + ", minPlayerInputFrontId=" + std::to_string(*outMinPlayerInputFrontId) + " after handling with playerInputFrontIdsUpdatedMask=" + std::to_string(playerInputFrontIdsUpdatedMask), DColor::Orange);
     }
     else {
-        Debug::Log("OnUpsyncSnapshotReceived/C++ got empty playerInputFrontIdsSorted after handling, sth is wrong" , DColor::Orange);
+        Debug::Log("OnUpsyncSnapshotReceived/C++ got empty playerInputFrontIdsUpdatedMask after handling, sth is wrong" , DColor::Orange);
 #endif
 */
     }
@@ -455,6 +482,26 @@ bool FrontendBattle::ProduceUpsyncSnapshotRequest(int seqNo, int proposedBatchIf
     selfUpsyncReqHolder->set_act(UpsyncAct::UA_CMD);
     UpsyncSnapshot* selfUpsyncSnapshot = selfUpsyncReqHolder->mutable_upsync_snapshot();
     selfUpsyncSnapshot->set_st_ifd_id(batchIfdIdSt);
+    selfUpsyncSnapshot->set_acked_ref_rdf_id(lastRefRdfHolder->id());
+    /*
+    [REMINDER] A "RenderFrame" is calculated from all-confirmed inputs iff
+    - its "delayedIfd" (and thus those of all its predecessors) is not beyond "lcacIfdId", and
+    - it's before "chaserRdfId", i.e. it has been re-calculated after the latest input correction.
+    */
+    int checksumRdfId = globalPrimitiveConsts->terminating_render_frame_id();
+    if (0 <= lcacIfdId) {
+        checksumRdfId = ConvertToLastUsedRenderFrameId(lcacIfdId) + 1;
+        if (checksumRdfId > chaserRdfId) checksumRdfId = chaserRdfId;
+        if (checksumRdfId > timerRdfId) checksumRdfId = timerRdfId;
+    }
+    const RenderFrame* checksumRdf = rdfBuffer.GetByFrameId(checksumRdfId);
+    if (nullptr != checksumRdf) {
+        selfUpsyncSnapshot->set_checksum_rdf_id(checksumRdfId);
+        selfUpsyncSnapshot->set_checksum(checksumRdf->checksum());
+    } else {
+        selfUpsyncSnapshot->set_checksum_rdf_id(globalPrimitiveConsts->terminating_render_frame_id());
+        selfUpsyncSnapshot->set_checksum(0);
+    }
     selfUpsyncSnapshot->clear_cmd_list();
     for (auto& cmd : cmdList) {
         selfUpsyncSnapshot->add_cmd_list(cmd);
@@ -593,21 +640,57 @@ bool FrontendBattle::ChaseRolledBackRdfs(int* outChaserRdfId, bool toTimerRdfId)
     } else if (toRdfId > timerRdfId) {
         toRdfId = timerRdfId;
     }
+    if (fromRdfId >= toRdfId) {
+        return true;
+    }
+    const auto t0 = std::chrono::steady_clock::now();
     for (int currRdfId = fromRdfId; currRdfId < toRdfId; ++currRdfId) {
-        int delayedIfdId = ConvertToDelayedInputFrameId(currRdfId);
-        InputFrameDownsync* delayedIfd = ifdBuffer.GetByFrameId(delayedIfdId);
-        JPH_ASSERT(nullptr != delayedIfd);
-        regulateCmdBeforeRender(currRdfId, delayedIfdId, delayedIfd);
-        auto nextRdf = BaseBattle::CalcSingleStep(currRdfId, delayedIfdId, delayedIfd);
-        if (frameLogEnabled) {
-            WriteSingleStepFrameLog(currRdfId, nextRdf, fromRdfId, toRdfId, delayedIfdId, delayedIfd, true);
-        }
-        chaserRdfId++;
+        chaseSingleRdf(currRdfId, fromRdfId, toRdfId);
     }
+    chasingMicros += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count();
     *outChaserRdfId = chaserRdfId;
     return true;
 }
 
+bool FrontendBattle::ChaseRolledBackRdfsWithBudget(int budgetMicros, int* outNewChaserRdfId, int* outChasedRdfCnt) {
+    *outNewChaserRdfId = chaserRdfId;
+    *outChasedRdfCnt = 0;
+    const int fromRdfId = chaserRdfId;
+    const int toRdfId = timerRdfId;
+    const auto t0 = std::chrono::steady_clock::now();
+    auto tPrev = t0;
+    for (int currRdfId = fromRdfId; currRdfId < toRdfId; ++currRdfId) {
+        if (currRdfId > fromRdfId) {
+            const float elapsedMicros = (float)std::chrono::duration_cast<std::chrono::microseconds>(tPrev - t0).count();
+            if (elapsedMicros + chasingStepCostEmaMicros > budgetMicros) {
+                break;
+            }
+        }
+        chaseSingleRdf(currRdfId, fromRdfId, toRdfId);
+        const auto tNow = std::chrono::steady_clock::now();
+        const float stepCostMicros = (float)std::chrono::duration_cast<std::chrono::microseconds>(tNow - tPrev).count();
+        tPrev = tNow;
+        chasingStepCostEmaMicros = (0 >= chasingStepCostEmaMicros ? stepCostMicros : (0.8f * chasingStepCostEmaMicros + 0.2f * stepCostMicros));
+        ++(*outChasedRdfCnt);
+    }
+    chasingMicros += std::chrono::duration_cast<std::chrono::microseconds>(tPrev - t0).count();
+    *outNewChaserRdfId = chaserRdfId;
+    return true;
+}
+
+void FrontendBattle::chaseSingleRdf(const int currRdfId, const int fromRdfId, const int toRdfId) {
+    int delayedIfdId = ConvertToDelayedInputFrameId(currRdfId);
+    InputFrameDownsync* delayedIfd = ifdBuffer.GetByFrameId(delayedIfdId);
+    JPH_ASSERT(nullptr != delayedIfd);
+    regulateCmdBeforeRender(currRdfId, delayedIfdId, delayedIfd);
+    auto nextRdf = BaseBattle::CalcSingleStep(currRdfId, delayedIfdId, delayedIfd);
+    if (frameLogEnabled) {
+        WriteSingleStepFrameLog(currRdfId, nextRdf, fromRdfId, toRdfId, delayedIfdId, delayedIfd, true);
+    }
+    ++resimulatedRdfCnt;
+    chaserRdfId++;
+}
+
 void FrontendBattle::regulateCmdBeforeRender(const int currRdfId, const int delayedIfdId, InputFrameDownsync* delayedIfd) {
     if (delayedIfdId <= lcacIfdId) {
         return;
@@ -700,17 +783,99 @@ void FrontendBattle::handleIncorrectlyRenderedPrediction(int mismatchedInputFram
     std::ostringstream oss;
     int localToGenIfdId = ConvertToGeneratingIfdId(timerRdfId);
     int localRequiredIfdId = ConvertToDelayedInputFrameId(timerRdfId);
-    oss << "@timerRdfId=" << timerRdfId << ", @localToGenIfdId=" << localToGenIfdId << ", @localRequiredIfdId=" << localRequiredIfdId << ", @maxPlayerInputFrontId=" << *playerInputFrontIdsSorted.rbegin() << ", @minPlayerInputFrontId=" << *playerInputFrontIdsSorted.begin() << ", @lcacIfdId=" << lcacIfdId << ", rewinding chaserRdfId from " << chaserRdfId << " to " << timerRdfId1 << " due to mismatchedInputFrameId=" << mismatchedInputFrameId << ", fromSelf=" << fromSelf << ", peerInputSource=" << (fromUdp ? "UDP" : "TCP") << ", fromRegulateBeforeRender=" << fromRegulateBeforeRender;
+    oss << "@timerRdfId=" << timerRdfId << ", @localToGenIfdId=" << localToGenIfdId << ", @localRequiredIfdId=" << localRequiredIfdId << ", @maxPlayerInputFrontId=" << maxPlayerInputFrontId << ", @minPlayerInputFrontId=" << minPlayerInputFrontId << ", @lcacIfdId=" << lcacIfdId << ", rewinding chaserRdfId from " << chaserRdfId << " to " << timerRdfId1 << " due to mismatchedInputFrameId=" << mismatchedInputFrameId << ", fromSelf=" << fromSelf << ", peerInputSource=" << (fromUdp ? "UDP" : "TCP") << ", fromRegulateBeforeRender=" << fromRegulateBeforeRender;
 
     Debug::Log(oss.str(), DColor::Orange);
 #endif
 */
+    recordRollback(timerRdfId - timerRdfId1, fromSelf, fromUdp, fromRegulateBeforeRender);
     chaserRdfId = timerRdfId1;
 }
 
+void FrontendBattle::resetRollbackStats() {
+    rollbackCnt = 0;
+    maxRollbackDepth = 0;
+    rollbackDepthHistogram.fill(0);
+    rollbackFromSelfCnt = 0;
+    rollbackFromUdpCnt = 0;
+    rollbackFromRegulateBeforeRenderCnt = 0;
+    resimulatedRdfCnt = 0;
+    chasingMicros = 0;
+    predictedInputCntPerPlayer.assign(playersCnt, 0);
+    mispredictedInputCntPerPlayer.assign(playersCnt, 0);
+    rollbackStatsResetAt = std::chrono::steady_clock::now();
+}
+
+void FrontendBattle::recordRollback(const int rollbackDepth, bool fromSelf, bool fromUdp, bool fromRegulateBeforeRender) {
+    ++rollbackCnt;
+    if (rollbackDepth > maxRollbackDepth) {
+        maxRollbackDepth = rollbackDepth;
+    }
+    int bucket = 0;
+    while (bucket + 1 < cRollbackDepthHistogramBucketCnt && (2 << bucket) <= rollbackDepth) {
+        ++bucket;
+    }
+    ++rollbackDepthHistogram[bucket];
+    if (fromSelf) ++rollbackFromSelfCnt;
+    if (fromUdp) ++rollbackFromUdpCnt;
+    if (fromRegulateBeforeRender) ++rollbackFromRegulateBeforeRenderCnt;
+}
+
+void FrontendBattle::recordInputPrediction(const InputFrameDownsync* existingIfd, const int joinIndexArrIdx, const uint64_t actualInput) {
+    if (nullptr == existingIfd || 0 > joinIndexArrIdx || joinIndexArrIdx >= (int)predictedInputCntPerPlayer.size() || joinIndexArrIdx >= existingIfd->input_list_size()) {
+        return;
+    }
+    const uint64_t joinMask = (U64_1 << joinIndexArrIdx);
+    if (0 < ((existingIfd->confirmed_list() | existingIfd->udp_confirmed_list()) & joinMask)) {
+        // Already the actual input, not a prediction
+        return;
+    }
+    ++predictedInputCntPerPlayer[joinIndexArrIdx];
+    if (existingIfd->input_list(joinIndexArrIdx) != actualInput) {
+        ++mispredictedInputCntPerPlayer[joinIndexArrIdx];
+    }
+}
+
+bool FrontendBattle::GetRollbackStats(char* outBytesPreallocatedStart, long* outBytesCntLimit, bool resetAfterRead) {
+    RollbackStats stats;
+    stats.set_rollback_cnt(rollbackCnt);
+    stats.set_max_rollback_depth(maxRollbackDepth);
+    for (int bucketCnt : rollbackDepthHistogram) {
+        stats.add_rollback_depth_histogram(bucketCnt);
+    }
+    stats.set_rollback_from_self_cnt(rollbackFromSelfCnt);
+    stats.set_rollback_from_udp_cnt(rollbackFromUdpCnt);
+    stats.set_rollback_from_regulate_before_render_cnt(rollbackFromRegulateBeforeRenderCnt);
+    stats.set_resimulated_rdf_cnt(resimulatedRdfCnt);
+    stats.set_chasing_micros(chasingMicros);
+    stats.set_elapsed_micros(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - rollbackStatsResetAt).count());
+    for (int k = 0; k < (int)predictedInputCntPerPlayer.size(); ++k) {
+        stats.add_predicted_input_cnt_per_player(predictedInputCntPerPlayer[k]);
+        stats.add_mispredicted_input_cnt_per_player(mispredictedInputCntPerPlayer[k]);
+    }
+
+    long byteSize = stats.ByteSizeLong();
+    if (byteSize > *outBytesCntLimit) {
+#ifndef NDEBUG
+        std::ostringstream oss;
+        oss << "couldn't serialize rollbackStats, byteSize=" << byteSize << ", outBytesCntLimit=" << *outBytesCntLimit;
+        Debug::Log(oss.str(), DColor::Orange);
+#endif
+        return false;
+    }
+    *outBytesCntLimit = byteSize;
+    stats.SerializeToArray(outBytesPreallocatedStart, byteSize);
+    if (resetAfterRead) {
+        resetRollbackStats();
+    }
+    return true;
+}
+
 void FrontendBattle::Clear() {
     BaseBattle::Clear();
     udpLcacIfdId = -1;
+    resetRollbackStats();
+    lastRefRdfHolder->set_id(globalPrimitiveConsts->terminating_render_frame_id());
 }
 
 bool FrontendBattle::ResetStartRdf(char* inBytes, int inBytesCnt, const uint32_t inSelfJoinIndex, const char * const inSelfPlayerId, const int inSelfCmdAuthKey) {
@@ -733,6 +898,7 @@ bool FrontendBattle::ResetStartRdf(WsReq* initializerMapData, const uint32_t inS
     bool res = BaseBattle::ResetStartRdf(initializerMapData);
     timerRdfId = rdfBuffer.GetLast()->id();
     chaserRdfId = chaserRdfIdLowerBound = timerRdfId;
+    resetRollbackStats();
     
     return res;
 }
@@ -760,8 +926,9 @@ void FrontendBattle::postStepSingleChdStateCorrection(const int steppingRdfId, c
 
         if (initSkillDict->count(potentialEncodedPattern)) {
             auto potentialSkillId = initSkillDict->at(potentialEncodedPattern);
-            if (globalConfigConsts->skill_configs().count(potentialSkillId)) {
-                const Skill& potentialSkillConfig = globalConfigConsts->skill_configs().at(potentialSkillId);
+            const Skill* potentialSkillConfigPtr = LookupSkillConfig(potentialSkillId);
+            if (nullptr != potentialSkillConfigPtr) {
+                const Skill& potentialSkillConfig = *potentialSkillConfigPtr;
                 const BulletConfig& potentialBulletConfig = potentialSkillConfig.hits(0);
                 BodyID bodyID = chCollider->GetBodyID();
                 AimingRayBodyFilter aimingRayCastBodyFilter(((const CharacterDownsync*)&currChd), (const CharacterDownsync*)nextChd, bodyID, ud, udt, this);
@@ -809,7 +976,7 @@ void FrontendBattle::postStepSingleChdStateCorrection(const int steppingRdfId, c
         std::ostringstream oss;
         int localToGenIfdId = ConvertToGeneratingIfdId(timerRdfId);
         int localRequiredIfdId = ConvertToDelayedInputFrameId(steppingRdfId);
-        oss << "@timerRdfId=" << timerRdfId << ", @localToGenIfdId=" << localToGenIfdId << ", @steppingRdfId=" << steppingRdfId << ", @localRequiredIfdId=" << localRequiredIfdId << ", @maxPlayerInputFrontId=" << *playerInputFrontIdsSorted.rbegin() << ", @minPlayerInputFrontId=" << *playerInputFrontIdsSorted.begin() << ", self character at(" << currChd.x() << ", " << currChd.y() << ") w / frames_in_ch_state = " << currChd.frames_in_ch_state() << ", vel = (" << currChd.vel_x() << ", " << currChd.vel_y() << ") revoked from " << currChd.ch_state() << " to " << nextChd->ch_state() << ", nextVel = (" << nextChd->vel_x() << ", " << nextChd->vel_y() << ")" << ", cvSupported = " << cvSupported << ", cvOnWall = " << cvOnWall << ", cvInAir = " << cvInAir << ", cvGroundState = " << (int)cvGroundState << " | self ifdBuffer = \n";
+        oss << "@timerRdfId=" << timerRdfId << ", @localToGenIfdId=" << localToGenIfdId << ", @steppingRdfId=" << steppingRdfId << ", @localRequiredIfdId=" << localRequiredIfdId << ", @maxPlayerInputFrontId=" << maxPlayerInputFrontId << ", @minPlayerInputFrontId=" << minPlayerInputFrontId << ", self character at(" << currChd.x() << ", " << currChd.y() << ") w / frames_in_ch_state = " << currChd.frames_in_ch_state() << ", vel = (" << currChd.vel_x() << ", " << currChd.vel_y() << ") revoked from " << currChd.ch_state() << " to " << nextChd->ch_state() << ", nextVel = (" << nextChd->vel_x() << ", " << nextChd->vel_y() << ")" << ", cvSupported = " << cvSupported << ", cvOnWall = " << cvOnWall << ", cvInAir = " << cvInAir << ", cvGroundState = " << (int)cvGroundState << " | self ifdBuffer = \n";
 
         stringifyPlayerInputsInIfdBuffer(oss, selfJoinIndexArrIdx);
         Debug::Log(oss.str(), DColor::Orange);
@@ -3,6 +3,8 @@
 
 #include "BaseBattle.h"
 #include <map>
+#include <array>
+#include <chrono>
 #ifndef NDEBUG
 #include "DebugLog.h"
 #endif
@@ -12,7 +14,7 @@ using namespace jtshared;
 
 class JOLTC_EXPORT FrontendBattle : public BaseBattle {
 public:
-    FrontendBattle(int renderBufferSize, int inputBufferSize, TempAllocator* inGlobalTempAllocator, bool isOnlineArenaMode) : BaseBattle(renderBufferSize, inputBufferSize, inGlobalTempAllocator, FrontendBattle::ArenaAllocStepResult) {
+    FrontendBattle(int renderBufferSize, int inputBufferSize, TempAllocator* inGlobalTempAllocator, bool isOnlineArenaMode, int nBytesForOwnTempAllocator = 0, JobSystemThreadPool* inSharedJobSys = nullptr) : BaseBattle(renderBufferSize, inputBufferSize, inGlobalTempAllocator, nBytesForOwnTempAllocator, FrontendBattle::ArenaAllocStepResult) {
         timerRdfId = globalPrimitiveConsts->starting_input_frame_id();
         onlineArenaMode = isOnlineArenaMode;
 
@@ -22,9 +24,11 @@ public:
         JPH_ASSERT(nullptr != downsyncSnapshotHolder->GetArena()); // [WARNING] Otherwise too inefficient in memory usage, e.g. when calling "unsafe_arena_set_allocated_xxx" would "delete" existing field first
         JPH_ASSERT(nullptr != peerUpsyncSnapshotHolder->GetArena()); // [WARNING] Otherwise too inefficient in memory usage, e.g. when calling "unsafe_arena_set_allocated_xxx" would "delete" existing field first
         JPH_ASSERT(nullptr != selfUpsyncReqHolder->GetArena()); // [WARNING] Otherwise too inefficient in memory usage, e.g. when calling "unsafe_arena_set_allocated_xxx" would "delete" existing field first
+        lastRefRdfHolder = google::protobuf::Arena::Create<RenderFrame>(&pbSemiPermAllocator);
+        lastRefRdfHolder->set_id(globalPrimitiveConsts->terminating_render_frame_id());
 
         allocPhySys();
-        jobSys = new JobSystemThreadPool(cMaxPhysicsJobs, cMaxPhysicsBarriers, thread::hardware_concurrency() - 1);
+        allocJobSys(inSharedJobSys);
     }
 
     virtual ~FrontendBattle() {
@@ -38,6 +42,9 @@ public:
         if (nullptr != selfUpsyncReqHolder) {
             selfUpsyncReqHolder = nullptr;
         }
+        if (nullptr != lastRefRdfHolder) {
+            lastRefRdfHolder = nullptr;
+        }
 #ifndef NDEBUG
         Debug::Log("~FrontendBattle/C++", DColor::Green);
 #endif
@@ -76,6 +83,16 @@ public:
     bool Step(); // [WARNING] Implicitly calls "handleIncorrectlyRenderedPrediction" if needed
     bool ChaseRolledBackRdfs(int* outNewChaserRdfId, bool toTimerRdfId = false);
 
+    /*
+    [REMINDER] A time-budgeted variant of "ChaseRolledBackRdfs", chasing towards "timerRdfId" as many RenderFrames as the estimated "CalcSingleStep" cost fits in "budgetMicros" (but at least 1 if "chaserRdfId < timerRdfId", to guarantee progress). The estimate is an exponential moving average of the measured cost of each chased RenderFrame, kept across calls.
+    */
+    bool ChaseRolledBackRdfsWithBudget(int budgetMicros, int* outNewChaserRdfId, int* outChasedRdfCnt);
+
+    /*
+    Serializes a "RollbackStats" accumulated since the last reset (i.e. "ResetStartRdf", "Clear" or a previous call with "resetAfterRead == true") into the caller buffer, same convention as "APP_GetFrameLog".
+    */
+    bool GetRollbackStats(char* outBytesPreallocatedStart, long* outBytesCntLimit, bool resetAfterRead);
+
     inline bool GetRdfAndIfdIds(int* outTimerRdfId, int* outChaserRdfId, int* outChaserRdfIdLowerBound, int* outLcacIfdId, int* outUdpLcacIfdId, int* outTimerRdfIdGenIfdId, int* outTimerRdfIdToUseIfdId) {
         *outTimerRdfId = timerRdfId;
         *outChaserRdfId = chaserRdfId;
@@ -103,6 +120,29 @@ public:
 
 protected:
     bool onlineArenaMode = false;
+    float chasingStepCostEmaMicros = 0; // 0 means "not yet measured"
+
+    void chaseSingleRdf(const int currRdfId, const int fromRdfId, const int toRdfId);
+
+    /*
+    [REMINDER] Rollback telemetry, only plain counters updated on the (single-threaded) frontend paths, see "RollbackStats" in "serializable_data.proto" for the meaning of each field.
+    */
+    static constexpr int cRollbackDepthHistogramBucketCnt = 8;
+    int rollbackCnt = 0;
+    int maxRollbackDepth = 0;
+    std::array<int, cRollbackDepthHistogramBucketCnt> rollbackDepthHistogram = {};
+    int rollbackFromSelfCnt = 0;
+    int rollbackFromUdpCnt = 0;
+    int rollbackFromRegulateBeforeRenderCnt = 0;
+    int64_t resimulatedRdfCnt = 0;
+    int64_t chasingMicros = 0;
+    std::vector<int> predictedInputCntPerPlayer;
+    std::vector<int> mispredictedInputCntPerPlayer;
+    std::chrono::steady_clock::time_point rollbackStatsResetAt = std::chrono::steady_clock::now();
+
+    void resetRollbackStats();
+    void recordRollback(const int rollbackDepth, bool fromSelf, bool fromUdp, bool fromRegulateBeforeRender);
+    void recordInputPrediction(const InputFrameDownsync* existingIfd, const int joinIndexArrIdx, const uint64_t actualInput);
 
     void regulateCmdBeforeRender(const int currRdfId, const int delayedIfdId, InputFrameDownsync* delayedIfd); // [WARNING] Implicitly calls "handleIncorrectlyRenderedPrediction" if needed
 
@@ -115,6 +155,7 @@ protected:
     DownsyncSnapshot* downsyncSnapshotHolder = nullptr;
     WsReq* peerUpsyncSnapshotHolder = nullptr;
     WsReq* selfUpsyncReqHolder = nullptr;
+    RenderFrame* lastRefRdfHolder = nullptr; // The latest authoritative "RenderFrame" received from backend, i.e. the base of the next "DownsyncSnapshot.ref_rdf_delta", acknowledged via "UpsyncSnapshot.acked_ref_rdf_id"
 
     virtual bool allocPhySys() override {
         if (nullptr != phySys) return false;
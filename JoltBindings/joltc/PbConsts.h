@@ -7,6 +7,10 @@
 #include <set>
 #include <utility>
 #include <unordered_set>
+#include <vector>
+#include <initializer_list>
+#include <cstdint>
+#include <cstddef>
 
 using namespace jtshared;
 
@@ -17,19 +21,98 @@ extern JOLTC_EXPORT std::unordered_set<uint32_t> mixedMainAndSubCycleTrtSet;
 extern JOLTC_EXPORT std::unordered_set<uint32_t> directSpawnerTrtSet;
 extern JOLTC_EXPORT std::unordered_set<uint32_t> collidableTrtSet;
 
-const std::unordered_set<CharacterState> onWallSet = {
+/*
+[REMINDER] Dense pointer tables into "globalConfigConsts", indexed by id and rebuilt by every "ConfigConsts_Init", such that per-frame lookups on the hot paths avoid "google::protobuf::Map" hashing.
+
+- "globalPickableConfigTable" is indexed by "Pickable.pickup_type".
+- "globalBulletConfigTable" is flattened, i.e. the "BulletConfig*" of "(skillId, skillHit)" resides at "globalBulletConfigOffsetTable[skillId] + skillHit - 1".
+- An id absent from the config maps to nullptr, and an id beyond "cMaxDenseConfigId" is never put into a table but looked up from "globalConfigConsts" instead -- the ids in use are small by far, the cap only guards against a single sparse id blowing up the tables.
+*/
+constexpr uint32_t cMaxDenseConfigId = (1u << 16);
+extern JOLTC_EXPORT std::vector<const Skill*> globalSkillConfigTable;
+extern JOLTC_EXPORT std::vector<int> globalBulletConfigOffsetTable;
+extern JOLTC_EXPORT std::vector<const BulletConfig*> globalBulletConfigTable;
+extern JOLTC_EXPORT std::vector<const CharacterConfig*> globalCharacterConfigTable;
+extern JOLTC_EXPORT std::vector<const TrapConfig*> globalTrapConfigTable;
+extern JOLTC_EXPORT std::vector<const PickableConfig*> globalPickableConfigTable;
+
+inline const Skill* LookupSkillConfig(const uint32_t skillId) {
+    if (skillId < globalSkillConfigTable.size()) return globalSkillConfigTable[skillId];
+    if (skillId < cMaxDenseConfigId) return nullptr;
+    auto& skillConfigs = globalConfigConsts->skill_configs();
+    auto it = skillConfigs.find(skillId);
+    return (skillConfigs.end() == it ? nullptr : &(it->second));
+}
+
+inline const BulletConfig* LookupBulletConfig(const uint32_t skillId, const uint32_t skillHit, const Skill* skill) {
+    // "skill" MUST be the result of "LookupSkillConfig(skillId)".
+    if (nullptr == skill || 0 >= skillHit || skillHit > (uint32_t)skill->hits_size()) return nullptr;
+    if (skillId < globalSkillConfigTable.size()) return globalBulletConfigTable[globalBulletConfigOffsetTable[skillId] + skillHit - 1];
+    return &(skill->hits(skillHit - 1));
+}
+
+inline const CharacterConfig* LookupCharacterConfig(const uint32_t speciesId) {
+    if (speciesId < globalCharacterConfigTable.size()) return globalCharacterConfigTable[speciesId];
+    if (speciesId < cMaxDenseConfigId) return nullptr;
+    auto& chConfigs = globalConfigConsts->character_configs();
+    auto it = chConfigs.find(speciesId);
+    return (chConfigs.end() == it ? nullptr : &(it->second));
+}
+
+inline const TrapConfig* LookupTrapConfig(const uint32_t tpt) {
+    if (tpt < globalTrapConfigTable.size()) return globalTrapConfigTable[tpt];
+    if (tpt < cMaxDenseConfigId) return nullptr;
+    auto& trapConfigs = globalConfigConsts->trap_configs();
+    auto it = trapConfigs.find(tpt);
+    return (trapConfigs.end() == it ? nullptr : &(it->second));
+}
+
+inline const PickableConfig* LookupPickableConfig(const uint32_t pickupType) {
+    if (pickupType < globalPickableConfigTable.size()) return globalPickableConfigTable[pickupType];
+    if (pickupType < cMaxDenseConfigId) return nullptr;
+    auto& pkConfigs = globalConfigConsts->pickable_configs();
+    auto it = pkConfigs.find(pickupType);
+    return (pkConfigs.end() == it ? nullptr : &(it->second));
+}
+
+/*
+[REMINDER] A compile-time bitset of enum values, exposing the same "count(...)" query as "std::unordered_set" such that call sites stay unchanged, but each query is a single load-and-test instead of hashing. Values out of "[0, N)" are never members.
+*/
+template <typename EnumT, int N>
+class EnumBitset {
+public:
+    constexpr EnumBitset(std::initializer_list<EnumT> members) : words{} {
+        for (EnumT m : members) {
+            words[static_cast<uint32_t>(m) >> 6] |= (static_cast<uint64_t>(1) << (static_cast<uint32_t>(m) & 63));
+        }
+    }
+
+    constexpr size_t count(const EnumT v) const {
+        const uint32_t u = static_cast<uint32_t>(v);
+        return (u < static_cast<uint32_t>(N) && 0 != ((words[u >> 6] >> (u & 63)) & 1)) ? 1 : 0;
+    }
+
+private:
+    uint64_t words[(N + 63) >> 6];
+};
+
+typedef EnumBitset<CharacterState, CharacterState_ARRAYSIZE> CharacterStateSet;
+typedef EnumBitset<NpcGoal, NpcGoal_ARRAYSIZE> NpcGoalSet;
+typedef EnumBitset<TriggerState, TriggerState_ARRAYSIZE> TriggerStateSet;
+
+constexpr CharacterStateSet onWallSet = {
     OnWallIdle1, 
     OnWallAtk1, 
 };
 
-const std::unordered_set<CharacterState> proactiveJumpingSet = {
+constexpr CharacterStateSet proactiveJumpingSet = {
     InAirIdle1ByJump,
     InAirIdle1ByWallJump,
     InAirIdle2ByJump,
     InAirIdle1BySlipJump,
 };
 
-const std::unordered_set<CharacterState> inAirSet = {
+constexpr CharacterStateSet inAirSet = {
     InAirIdle1NoJump,
     InAirIdle1ByJump,
     InAirIdle1ByWallJump,
@@ -48,14 +131,14 @@ const std::unordered_set<CharacterState> inAirSet = {
     InAirTurnAround,
 };
 
-const std::unordered_set<CharacterState> atkedSet = {
+constexpr CharacterStateSet atkedSet = {
     Atked1,
     InAirAtked1,
     CrouchAtked1,
     Def1Broken,
 };
 
-const std::unordered_set<CharacterState> noOpSet = {
+constexpr CharacterStateSet noOpSet = {
     BlownUp1,
     LayDown1,
     // [WARNING] During the invinsible frames of GetUp1, the player is allowed to take any action
@@ -64,7 +147,7 @@ const std::unordered_set<CharacterState> noOpSet = {
     Awaking,
 };
 
-const std::unordered_set<CharacterState> walkingSet = {
+constexpr CharacterStateSet walkingSet = {
     Walking,
     WalkingAtk1,
     WalkingAtk1_Charging,
@@ -79,7 +162,7 @@ const std::unordered_set<CharacterState> walkingSet = {
     InAirWalkingAtk4,
 };
 
-const std::unordered_set<CharacterState> walkingAtkSet = {
+constexpr CharacterStateSet walkingAtkSet = {
     WalkingAtk1,
     WalkingAtk1_Charging,
     WalkingAtk4,
@@ -89,7 +172,7 @@ const std::unordered_set<CharacterState> walkingAtkSet = {
     InAirWalkingAtk4,
 };
 
-const std::unordered_set<CharacterState> invinsibleSet = {
+constexpr CharacterStateSet invinsibleSet = {
     BlownUp1,
     LayDown1,
     GetUp1,
@@ -97,7 +180,7 @@ const std::unordered_set<CharacterState> invinsibleSet = {
     TransformingInto
 };
 
-const std::unordered_set<CharacterState> nonAttackingSet = {
+constexpr CharacterStateSet nonAttackingSet = {
     Idle1,
     Walking,
     WalkingAtk1_Charging,
@@ -140,7 +223,7 @@ const std::unordered_set<CharacterState> nonAttackingSet = {
     Parried
 };
 
-const std::unordered_set<CharacterState> shrinkedSizeSet = {
+constexpr CharacterStateSet shrinkedSizeSet = {
     BlownUp1,
     LayDown1,
     InAirIdle1NoJump,
@@ -168,7 +251,7 @@ const std::unordered_set<CharacterState> shrinkedSizeSet = {
     */
 };
 
-const std::unordered_set<NpcGoal> temptingToMoveNpcGoalSet = {
+constexpr NpcGoalSet temptingToMoveNpcGoalSet = {
     NPatrol, 
     NPathPatrol, 
     NHuntThenIdle,
@@ -177,19 +260,19 @@ const std::unordered_set<NpcGoal> temptingToMoveNpcGoalSet = {
     NHuntThenFollowAlly,
 };
 
-const std::unordered_set<TriggerState> trSubCycleStates = {
+constexpr TriggerStateSet trSubCycleStates = {
     TriggerState::TrSubCycleReady,
     TriggerState::TrSubCycleCoolingDown,
     TriggerState::TrSubCycleCooledDown,
     TriggerState::TrSubCycleExhausted,
 };
 
-const std::unordered_set<TriggerState> trActiveSubCycleStates = {
+constexpr TriggerStateSet trActiveSubCycleStates = {
     TriggerState::TrSubCycleReady,
     TriggerState::TrSubCycleCooledDown,
 };
 
-const std::unordered_set<TriggerState> trMainCycleStates = {
+constexpr TriggerStateSet trMainCycleStates = {
     TriggerState::TrReady,
     TriggerState::TrCoolingDown,
     TriggerState::TrCooledDown,
@@ -197,7 +280,7 @@ const std::unordered_set<TriggerState> trMainCycleStates = {
     TriggerState::TrExhaustedYetListening,
 };
 
-const std::unordered_set<TriggerState> trActiveMainCycleStates = {
+constexpr TriggerStateSet trActiveMainCycleStates = {
     TriggerState::TrReady,
     TriggerState::TrCooledDown,
     TriggerState::TrExhaustedYetListening,
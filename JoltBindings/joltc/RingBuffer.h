@@ -14,7 +14,7 @@ using FREE_T_FUNC = void (*)(ArgType*, AllocatorType*);
 
 This class is NOT thread-safe. 
 
-This class DOESN'T support resizing. 
+This class only supports growing by "Reserve(newN)", which rebases the live elements to "[0, Cnt)" without moving any "T" instance, i.e. pointers to elements held elsewhere remain valid.
 
 This class implicitly deallocates pointer-type element memory in destructor.
 */
@@ -47,6 +47,9 @@ class RingBuffer {
         // [WARNING] Always returns a non-null pointer to the slot for assignment -- when the candidate slot is nullptr, heap memory allocation will occur.
         virtual T* DryPut();  
 
+        // Returns false if "newN <= N". The new slots are NOT allocated till "DryPut()" reaches them.
+        virtual bool Reserve(int newN);
+
         virtual AllocatorType* GetAllocator() {
             return allocator;
         }
@@ -137,3 +137,25 @@ inline T* RingBuffer<T, AllocatorType>::DryPut() {
     }
     return candidateSlot;
 }
+
+template <typename T, typename AllocatorType>
+inline bool RingBuffer<T, AllocatorType>::Reserve(int newN) {
+    if (newN <= N) return false;
+    std::vector<T*> newEles(newN, nullptr);
+    /*
+    Walking all "N" slots circularly from "St" visits the "Cnt" live elements first and then the idle ones, where the idle slots might've been allocated already -- they're kept right after the live ones to be reused by "DryPut()" and freed by the destructor, i.e. ownership is unchanged.
+    */
+    int arrIdx = St;
+    for (int i = 0; i < N; i++) {
+        newEles[i] = Eles[arrIdx];
+        arrIdx++;
+        if (arrIdx >= N) {
+            arrIdx -= N;
+        }
+    }
+    Eles.swap(newEles);
+    St = 0;
+    Ed = Cnt;
+    N = newN;
+    return true;
+}
@@ -124,7 +124,7 @@ public:
 
 This class is MOSTLY NOT thread-safe (though some efforts are made). 
 
-This class DOESN'T support resizing. 
+This class DOESN'T support resizing, see "Reserve". 
 
 This class implicitly deallocates pointer-type element memory in destructor.
 */
@@ -158,6 +158,11 @@ class RingBufferMt {
         // [WARNING] Always returns a non-null pointer to the slot for assignment -- when the candidate slot is nullptr, heap memory allocation will occur.
         virtual T* DryPut();   
 
+        // [WARNING] Resizing is NOT supported under concurrent access, always returns false such that callers fall back to their non-growing paths, e.g. "BackendBattle::tryGrowIfdBuffer".
+        virtual bool Reserve(int /*newN*/) {
+            return false;
+        }
+
         virtual bool IsConsistent() {
             if (!(0 <= St && N > St)) {
                 return false;
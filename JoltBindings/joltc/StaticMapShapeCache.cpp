@@ -0,0 +1,402 @@
+#include "StaticMapShapeCache.h"
+#include "BaseBattleCollisionFilter.h"
+
+#include <Jolt/Core/StreamWrapper.h>
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
+#include <Jolt/Physics/Collision/Shape/MeshShape.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifndef NDEBUG
+#include "DebugLog.h"
+#endif
+
+std::mutex StaticMapShapeCache::cookedMapsMux;
+std::unordered_map<uint64_t, StaticMapShapeCache::CookedStaticMapEntry> StaticMapShapeCache::cookedMaps;
+
+static const uint32_t cCookedStaticMapFileMagic = 0x434D534A; // "JSMC" in little-endian
+static const uint32_t cCookedStaticMapFileVersion = 2;
+static const uint32_t cCookingLogicVersion = 1; // [WARNING] MUST be bumped upon any change of "cookBarrier" which isn't covered by the constants mixed in "GetCookingFingerprint"
+
+static inline void fnv1aMix(uint64_t& h, const void* data, size_t nBytes) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < nBytes; i++) {
+        h ^= p[i];
+        h *= 0x100000001b3ull;
+    }
+}
+
+static inline uint32_t floatBitsForKey(float v) {
+    if (0.f == v) v = 0.f; // Treats "-0.f" the same as "+0.f"
+    uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+static inline void fnv1aMixFloat(uint64_t& h, float v) {
+    uint32_t bits = floatBitsForKey(v);
+    fnv1aMix(h, &bits, sizeof(bits));
+}
+
+static inline void fnv1aMixVec3(uint64_t& h, const Vec3& v) {
+    fnv1aMixFloat(h, v.GetX());
+    fnv1aMixFloat(h, v.GetY());
+    fnv1aMixFloat(h, v.GetZ());
+}
+
+uint64_t StaticMapShapeCache::GetCookingFingerprint() {
+    static const uint64_t fingerprint = []() {
+        uint64_t h = 0xcbf29ce484222325ull;
+        uint32_t joltVersionId = JPH_VERSION_ID;
+        uint32_t realSize = sizeof(Real);
+        fnv1aMix(h, &cCookingLogicVersion, sizeof(cCookingLogicVersion));
+        fnv1aMix(h, &joltVersionId, sizeof(joltVersionId));
+        fnv1aMix(h, &realSize, sizeof(realSize));
+        fnv1aMixFloat(h, cDefaultBarrierHalfThickness);
+        fnv1aMixVec3(h, yTurned45DegsAroundZAxis);
+        fnv1aMixVec3(h, yTurnedNegative45DegsAroundZAxis);
+        fnv1aMixVec3(h, yTurned135DegsAroundZAxis);
+        fnv1aMixVec3(h, yTurnedNegative135DegsAroundZAxis);
+        fnv1aMixFloat(h, cTurn90DegsAroundZAxis.GetX());
+        fnv1aMixFloat(h, cTurn90DegsAroundZAxis.GetY());
+        fnv1aMixFloat(h, cTurn90DegsAroundZAxis.GetZ());
+        fnv1aMixFloat(h, cTurn90DegsAroundZAxis.GetW());
+        return h;
+    }();
+    return fingerprint;
+}
+
+/*
+Only "SerializableConvexPolygon" affects the cooked shapes, hence "BarrierColliderAttr" is NOT flattened -- two maps of the same geometry but different attributes share the same cooked shapes.
+*/
+void StaticMapShapeCache::flattenGeometry(const ::google::protobuf::RepeatedPtrField<SerializedBarrierCollider>& barriers, GEOMETRY_T& outGeometry) {
+    outGeometry.clear();
+    outGeometry.push_back((uint32_t)barriers.size());
+    for (const SerializedBarrierCollider& barrier : barriers) {
+        const SerializableConvexPolygon& convexPolygon = barrier.polygon();
+        outGeometry.push_back((convexPolygon.is_box() ? 1u : 0u) | (convexPolygon.is_parallelepiped() ? 2u : 0u));
+        if (convexPolygon.is_box()) {
+            outGeometry.push_back(floatBitsForKey(convexPolygon.box_q_x()));
+            outGeometry.push_back(floatBitsForKey(convexPolygon.box_q_y()));
+            outGeometry.push_back(floatBitsForKey(convexPolygon.box_q_z()));
+            outGeometry.push_back(floatBitsForKey(convexPolygon.box_q_w()));
+        }
+        outGeometry.push_back((uint32_t)convexPolygon.points_size());
+        for (const PbVec2& p : convexPolygon.points()) {
+            outGeometry.push_back(floatBitsForKey(p.x()));
+            outGeometry.push_back(floatBitsForKey(p.y()));
+        }
+    }
+}
+
+uint64_t StaticMapShapeCache::calcGeometryKey(const GEOMETRY_T& geometry) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    uint64_t cookingFingerprint = GetCookingFingerprint();
+    fnv1aMix(h, &cookingFingerprint, sizeof(cookingFingerprint));
+    fnv1aMix(h, geometry.data(), geometry.size() * sizeof(uint32_t));
+    return h;
+}
+
+uint64_t StaticMapShapeCache::CalcMapKey(const ::google::protobuf::RepeatedPtrField<SerializedBarrierCollider>& barriers) {
+    GEOMETRY_T geometry;
+    flattenGeometry(barriers, geometry);
+    return calcGeometryKey(geometry);
+}
+
+void StaticMapShapeCache::cookBarrier(const SerializableConvexPolygon& convexPolygon, CookedStaticCollider& outCooked) {
+    int pointsCnt = convexPolygon.points_size();
+    double recalcAnchorX = 0, recalcAnchorY = 0;
+    outCooked.slopeEdgeOutwardNorm = Vec3::sZero();
+    if (convexPolygon.is_box()) {
+        JPH::Quat boxQ = cIdentityQ;
+        if (0 != convexPolygon.box_q_x()
+        || 0 != convexPolygon.box_q_y()
+        || 0 != convexPolygon.box_q_z()
+        || 0 != convexPolygon.box_q_w()
+        ) {
+            boxQ = JPH::Quat(convexPolygon.box_q_x(), convexPolygon.box_q_y(), convexPolygon.box_q_z(), convexPolygon.box_q_w());
+        }
+
+        float xExtent = 0.f, yExtent = 0.f;
+        for (int i = 0; i < convexPolygon.points_size(); i++) {
+            auto& pi = convexPolygon.points(i);
+            for (int j = i + 1; j < convexPolygon.points_size(); j++) {
+                auto& pj = convexPolygon.points(j);
+                float dxAbs = std::abs(pj.x() - pi.x());
+                float dyAbs = std::abs(pj.y() - pi.y());
+                if (dxAbs > xExtent) xExtent = dxAbs;
+                if (dyAbs > yExtent) yExtent = dyAbs;
+            }
+            recalcAnchorX += pi.x();
+            recalcAnchorY += pi.y();
+        }
+
+        // [REMINDER] When "is_box == true", the anchor (i.e. the mid-center) is rotational invariant
+        const double anchorX = (recalcAnchorX / pointsCnt);
+        const double anchorY = (recalcAnchorY / pointsCnt);
+        float xHalfExtent = 0.5f * xExtent, yHalfExtent = 0.5f * yExtent;
+        float convexRadius = (xHalfExtent + yHalfExtent) * 0.5;
+        if (cDefaultBarrierHalfThickness < convexRadius) {
+            convexRadius = cDefaultBarrierHalfThickness; // Required by the underlying body creation
+        }
+        Vec3 halfExtent(xHalfExtent, yHalfExtent, cDefaultBarrierHalfThickness);
+        BoxShapeSettings bodyShapeSettings(halfExtent, convexRadius); // transient, to be discarded after cooking
+        BoxShapeSettings::ShapeResult shapeResult;
+        outCooked.shape = new BoxShape(bodyShapeSettings, shapeResult);
+        outCooked.position = Vec3(anchorX, anchorY, 0);
+        outCooked.rotation = boxQ;
+        return;
+    }
+
+    std::vector<PbVec2> effConvexPolygonPoints;
+    effConvexPolygonPoints.reserve(pointsCnt);
+    for (auto& srcPoint : convexPolygon.points()) {
+        effConvexPolygonPoints.push_back(srcPoint);
+        recalcAnchorX += srcPoint.x();
+        recalcAnchorY += srcPoint.y();
+    }
+    const double anchorX = (recalcAnchorX / pointsCnt);
+    const double anchorY = (recalcAnchorY / pointsCnt);
+    std::sort(effConvexPolygonPoints.begin(), effConvexPolygonPoints.end(), [anchorX, anchorY](const PbVec2& a, const PbVec2& b) {
+        const double dxA = (a.x() - anchorX);
+        const double dyA = (a.y() - anchorY);
+        const double dxB = (b.x() - anchorX);
+        const double dyB = (b.y() - anchorY);
+        double crossProduct = dxA * dyB - dyA * dxB;
+
+        if (crossProduct != 0) {
+            return (crossProduct < 0);
+        } else {
+            double distA2 = dxA * dxA + dyA * dyA;
+            double distB2 = dxB * dxB + dyB * dyB;
+            return (distA2 < distB2);
+        }
+    });
+    outCooked.position = Vec3(anchorX, anchorY, 0);
+    outCooked.rotation = JPH::Quat::sIdentity();
+
+    if (convexPolygon.is_parallelepiped()) {
+        Vec3 slopeEdgeNorm;
+        float slopeEdgeBestDot = FLT_MIN;
+
+        std::vector<JPH::Vec3> parsedPoints;
+        parsedPoints.reserve(2 * pointsCnt);
+        for (int pi = 0; pi < pointsCnt; pi++) {
+            auto fromI = pi;
+            auto toI = fromI + 1;
+            if (toI >= pointsCnt) {
+                toI = 0;
+            }
+
+            auto& p1 = effConvexPolygonPoints[fromI];
+            auto& p2 = effConvexPolygonPoints[toI];
+
+            auto x1 = p1.x() - anchorX;
+            auto y1 = p1.y() - anchorY;
+            auto x2 = p2.x() - anchorX;
+            auto y2 = p2.y() - anchorY;
+
+            Vec3 candidateSlopeEdge(x2-x1, y2-y1, 0);
+            Vec3 candidateSlopeEdgeNorm = candidateSlopeEdge.Normalized();
+
+            float dot1 = candidateSlopeEdgeNorm.Dot(yTurned45DegsAroundZAxis);
+            float dot2 = candidateSlopeEdgeNorm.Dot(yTurnedNegative45DegsAroundZAxis);
+            float dot3 = candidateSlopeEdgeNorm.Dot(yTurned135DegsAroundZAxis);
+            float dot4 = candidateSlopeEdgeNorm.Dot(yTurnedNegative135DegsAroundZAxis);
+
+            float candidateDot = std::max(std::max(dot1, dot2), std::max(dot3, dot4));
+            if (candidateDot > slopeEdgeBestDot) {
+                slopeEdgeNorm = candidateSlopeEdgeNorm;
+                slopeEdgeBestDot = candidateDot;
+            }
+
+            parsedPoints.push_back(Vec3(x1, y1, +cDefaultBarrierHalfThickness));
+            parsedPoints.push_back(Vec3(x1, y1, -cDefaultBarrierHalfThickness));
+        }
+
+        Vec3 slopeEdgeOutwardNorm = (cTurn90DegsAroundZAxis * slopeEdgeNorm);
+        if (0 > slopeEdgeOutwardNorm.GetY()) {
+            slopeEdgeOutwardNorm = -slopeEdgeOutwardNorm;
+        }
+
+        ConvexHullShapeSettings bodyShapeSettings(parsedPoints.data(), parsedPoints.size());
+        ConvexHullShapeSettings::ShapeResult shapeResult;
+        outCooked.shape = new ConvexHullShape(bodyShapeSettings, shapeResult);
+        outCooked.slopeEdgeOutwardNorm = slopeEdgeOutwardNorm;
+    } else {
+        TriangleList triangles;
+        for (int pi = 0; pi < pointsCnt; pi++) {
+            auto fromI = pi;
+            auto toI = fromI + 1;
+            if (toI >= pointsCnt) {
+                toI = 0;
+            }
+            auto& p1 = effConvexPolygonPoints[fromI];
+            auto& p2 = effConvexPolygonPoints[toI];
+
+            auto x1 = p1.x() - anchorX;
+            auto y1 = p1.y() - anchorY;
+            auto x2 = p2.x() - anchorX;
+            auto y2 = p2.y() - anchorY;
+
+            // According to https://github.com/jrouwe/JoltPhysics/blob/v5.3.0/Jolt/Physics/Collision/Shape/MeshShape.cpp#L440, the surface normal (outward) of a "JPH::Triangle" is "(v3 - v2).Cross(v1 - v2).Normalized()".
+            {
+                Float3 v1(x1, y1, -cDefaultBarrierHalfThickness);
+                Float3 v2(x1, y1, +cDefaultBarrierHalfThickness);
+                Float3 v3(x2, y2, +cDefaultBarrierHalfThickness);
+                triangles.push_back(Triangle(v1, v2, v3));
+            }
+            {
+                Float3 v1(x2, y2, +cDefaultBarrierHalfThickness);
+                Float3 v2(x2, y2, -cDefaultBarrierHalfThickness);
+                Float3 v3(x1, y1, -cDefaultBarrierHalfThickness);
+                triangles.push_back(Triangle(v1, v2, v3));
+            }
+        }
+        MeshShapeSettings bodyShapeSettings(triangles);
+        MeshShapeSettings::ShapeResult shapeResult;
+        outCooked.shape = new MeshShape(bodyShapeSettings, shapeResult);
+    }
+}
+
+std::shared_ptr<const COOKED_STATIC_MAP_T> StaticMapShapeCache::GetOrCook(const ::google::protobuf::RepeatedPtrField<SerializedBarrierCollider>& barriers) {
+    GEOMETRY_T geometry;
+    flattenGeometry(barriers, geometry);
+    const uint64_t mapKey = calcGeometryKey(geometry);
+    {
+        std::lock_guard<std::mutex> lock(cookedMapsMux);
+        auto it = cookedMaps.find(mapKey);
+        if (it != cookedMaps.end() && it->second.geometry == geometry) {
+            return it->second.cooked;
+        }
+    }
+
+    // [WARNING] Cooking is intentionally NOT guarded by "cookedMapsMux", such that battles of different maps don't wait for each other. If two battles of the same new map cook concurrently, the first inserted wins and the other's result is just discarded.
+    auto cooked = std::make_shared<COOKED_STATIC_MAP_T>(barriers.size());
+    for (int i = 0; i < barriers.size(); i++) {
+        cookBarrier(barriers.Get(i).polygon(), (*cooked)[i]);
+    }
+
+    std::lock_guard<std::mutex> lock(cookedMapsMux);
+    CookedStaticMapEntry& entry = cookedMaps[mapKey];
+    if (nullptr != entry.cooked && entry.geometry == geometry) {
+        return entry.cooked;
+    }
+#ifndef NDEBUG
+    if (nullptr != entry.cooked) {
+        std::ostringstream oss;
+        oss << "StaticMapShapeCache::GetOrCook/hash collision of key=" << mapKey << ", the newer map takes over";
+        Debug::Log(oss.str(), DColor::Orange);
+    }
+#endif
+    // Either a new map, or a hash collision where the newer map takes over -- battles holding the older "cooked" are unaffected
+    entry.geometry = std::move(geometry);
+    entry.cooked = cooked;
+    return cooked;
+}
+
+bool StaticMapShapeCache::SaveToFile(const char* filePath) {
+    std::ofstream fout(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!fout.is_open()) {
+        return false;
+    }
+    StreamOutWrapper out(fout);
+    Shape::ShapeToIDMap shapeMap;
+    Shape::MaterialToIDMap materialMap;
+
+    std::lock_guard<std::mutex> lock(cookedMapsMux);
+    out.Write(cCookedStaticMapFileMagic);
+    out.Write(cCookedStaticMapFileVersion);
+    out.Write(GetCookingFingerprint());
+    out.Write((uint32_t)cookedMaps.size());
+    for (auto& [mapKey, entry] : cookedMaps) {
+        out.Write(mapKey);
+        out.Write((uint32_t)entry.geometry.size());
+        out.WriteBytes(entry.geometry.data(), entry.geometry.size() * sizeof(uint32_t));
+        out.Write((uint32_t)entry.cooked->size());
+        for (const CookedStaticCollider& single : *entry.cooked) {
+            out.Write(single.position);
+            out.Write(single.rotation);
+            out.Write(single.slopeEdgeOutwardNorm);
+            single.shape->SaveWithChildren(out, shapeMap, materialMap);
+        }
+    }
+    fout.flush();
+    return !out.IsFailed();
+}
+
+bool StaticMapShapeCache::LoadFromFile(const char* filePath) {
+    std::ifstream fin(filePath, std::ios::in | std::ios::binary);
+    if (!fin.is_open()) {
+        return false;
+    }
+    StreamInWrapper in(fin);
+    Shape::IDToShapeMap shapeMap;
+    Shape::IDToMaterialMap materialMap;
+
+    uint32_t magic = 0, version = 0, mapsCnt = 0;
+    uint64_t cookingFingerprint = 0;
+    in.Read(magic);
+    in.Read(version);
+    in.Read(cookingFingerprint);
+    in.Read(mapsCnt);
+    if (in.IsFailed() || cCookedStaticMapFileMagic != magic || cCookedStaticMapFileVersion != version || GetCookingFingerprint() != cookingFingerprint) {
+        return false;
+    }
+
+    std::unordered_map<uint64_t, CookedStaticMapEntry> loadedMaps;
+    for (uint32_t m = 0; m < mapsCnt; m++) {
+        uint64_t mapKey = 0;
+        uint32_t geometrySize = 0;
+        in.Read(mapKey);
+        in.Read(geometrySize);
+        if (in.IsFailed()) {
+            return false;
+        }
+        CookedStaticMapEntry entry;
+        entry.geometry.resize(geometrySize);
+        in.ReadBytes(entry.geometry.data(), geometrySize * sizeof(uint32_t));
+        uint32_t collidersCnt = 0;
+        in.Read(collidersCnt);
+        if (in.IsFailed() || 0 == geometrySize || collidersCnt != entry.geometry[0] || mapKey != calcGeometryKey(entry.geometry)) {
+#ifndef NDEBUG
+            std::ostringstream oss;
+            oss << "StaticMapShapeCache::LoadFromFile/inconsistent source geometry of the " << m << "-th map with key=" << mapKey << " from " << filePath;
+            Debug::Log(oss.str(), DColor::Orange);
+#endif
+            return false;
+        }
+        auto cooked = std::make_shared<COOKED_STATIC_MAP_T>(collidersCnt);
+        for (CookedStaticCollider& single : *cooked) {
+            in.Read(single.position);
+            in.Read(single.rotation);
+            in.Read(single.slopeEdgeOutwardNorm);
+            Shape::ShapeResult shapeResult = Shape::sRestoreWithChildren(in, shapeMap, materialMap);
+            if (in.IsFailed() || shapeResult.HasError()) {
+#ifndef NDEBUG
+                std::ostringstream oss;
+                oss << "StaticMapShapeCache::LoadFromFile/failed to restore the " << m << "-th map with key=" << mapKey << " from " << filePath << (shapeResult.HasError() ? ", error=" + std::string(shapeResult.GetError().c_str()) : "");
+                Debug::Log(oss.str(), DColor::Orange);
+#endif
+                return false;
+            }
+            single.shape = shapeResult.Get();
+        }
+        entry.cooked = cooked;
+        loadedMaps[mapKey] = std::move(entry);
+    }
+
+    std::lock_guard<std::mutex> lock(cookedMapsMux);
+    for (auto& [mapKey, entry] : loadedMaps) {
+        cookedMaps[mapKey] = std::move(entry);
+    }
+    return true;
+}
+
+void StaticMapShapeCache::Clear() {
+    std::lock_guard<std::mutex> lock(cookedMapsMux);
+    cookedMaps.clear();
+}
@@ -0,0 +1,66 @@
+#ifndef STATIC_MAP_SHAPE_CACHE_H_
+#define STATIC_MAP_SHAPE_CACHE_H_ 1
+
+#include "CppOnlyConsts.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace JPH;
+using namespace jtshared;
+
+/*
+The "cooked" counterpart of a "SerializedBarrierCollider", i.e. everything "BaseBattle::ResetStartRdf" needs to create its static "Body" except for the "BarrierColliderAttr" dependent parts (user data, friction, stairs/slope bookkeeping), which are still applied per battle.
+
+[REMINDER] A "Shape" is immutable once cooked and its ref-counting is atomic, hence the same "RefConst<Shape>" is safe to be shared by the static bodies of all battles of the same map, even if they're stepped concurrently on different threads -- see "<proj-root>/JoltBindings/RefConst_destructor_trick.md" for how a "Body" keeps it alive.
+*/
+struct CookedStaticCollider {
+    RefConst<Shape> shape;
+    Vec3 position;
+    Quat rotation;
+    Vec3 slopeEdgeOutwardNorm; // Only meaningful when "SerializableConvexPolygon.is_parallelepiped == true"
+};
+
+typedef std::vector<CookedStaticCollider> COOKED_STATIC_MAP_T;
+
+/*
+[REMINDER] A process-wide cache of cooked static maps keyed by "CalcMapKey(serialized_barriers)", such that the "BoxShape/ConvexHullShape/MeshShape" cooking is only paid by the first battle of each map.
+
+- "CalcMapKey" is only a 64-bit hash, hence each cache entry also keeps the flattened source geometry (see "flattenGeometry") and "GetOrCook" compares it upon a key hit -- a colliding map is cooked anew instead of being handed the wrong shapes.
+- The key and the file header both carry "GetCookingFingerprint()", i.e. a fingerprint of the cooking logic and its constants (e.g. "cDefaultBarrierHalfThickness"). [WARNING] Bump "cCookingLogicVersion" upon ANY change of "cookBarrier" not covered by the fingerprinted constants, otherwise stale cooked files would still be accepted.
+- "GetOrCook" is thread-safe, and the returned "std::shared_ptr" keeps the cooked map alive even if "Clear" is called concurrently.
+- "SaveToFile/LoadFromFile" persist the whole cache (including the source geometry) by Jolt's "Shape::SaveWithChildren/sRestoreWithChildren", e.g. to be warmed up upon server start. The file is only valid for the same cooking fingerprint, Jolt version and build flags (e.g. "JPH_DOUBLE_PRECISION"), a mismatched file is rejected as a whole by "LoadFromFile" instead of partially applied.
+- "Clear" MUST be called before "JPH::UnregisterTypes" (see "JPH_Shutdown"), all battles holding shared shapes should've been destroyed by then.
+*/
+class JOLTC_EXPORT StaticMapShapeCache {
+public:
+    static uint64_t CalcMapKey(const ::google::protobuf::RepeatedPtrField<SerializedBarrierCollider>& barriers);
+    static uint64_t GetCookingFingerprint();
+    static std::shared_ptr<const COOKED_STATIC_MAP_T> GetOrCook(const ::google::protobuf::RepeatedPtrField<SerializedBarrierCollider>& barriers);
+
+    static bool SaveToFile(const char* filePath);
+    static bool LoadFromFile(const char* filePath);
+    static void Clear();
+
+private:
+    typedef std::vector<uint32_t> GEOMETRY_T;
+
+    struct CookedStaticMapEntry {
+        GEOMETRY_T geometry; // The source of "cooked", compared upon a key hit
+        std::shared_ptr<const COOKED_STATIC_MAP_T> cooked;
+    };
+
+    static void flattenGeometry(const ::google::protobuf::RepeatedPtrField<SerializedBarrierCollider>& barriers, GEOMETRY_T& outGeometry);
+    static uint64_t calcGeometryKey(const GEOMETRY_T& geometry);
+    static void cookBarrier(const SerializableConvexPolygon& convexPolygon, CookedStaticCollider& outCooked);
+
+    static std::mutex cookedMapsMux;
+    static std::unordered_map<uint64_t, CookedStaticMapEntry> cookedMaps;
+};
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef STEP_PROFILER_H_
+#define STEP_PROFILER_H_ 1
+
+#include <cstdint>
+
+#ifdef JOLTC_STEP_PROFILER
+#include <chrono>
+#endif
+
+/*
+[REMINDER] Phases of "BaseBattle::CalcSingleStep" in execution order, the values are also the array indices used by "APP_GetStepProfile", hence only append to this list.
+*/
+enum StepPhase {
+    StepPhaseCopyRdf = 0,               // "CopyRdf" and "elapse1RdfForRdf"
+    StepPhasePutIntoPhySys,             // "batchPutIntoPhySysFromCache"
+    StepPhaseTriggers,                  // Trigger stepping before the pre-physics jobs
+    StepPhasePrePhysicsJobs,            // "xxx-pre-physics-update" jobs
+    StepPhaseNonContactConstraints,     // "batchNonContactConstraintsSetupFromCache"
+    StepPhasePhySysUpdate,              // "phySys->Update"
+    StepPhasePostPhysicsJobs,           // "xxx-post-physics-update" jobs and trigger subscriptions
+    StepPhaseFallenDeath,               // "calcFallenDeath"
+    StepPhaseLeftShiftDead,             // All "leftShiftDeadXxx" compactions
+    StepPhaseRemoveFromPhySys,          // "batchRemoveFromPhySysAndCache" and "CalcRdfChecksum"
+    StepPhaseCnt
+};
+
+/*
+[REMINDER] Accumulates wall time of each "StepPhase" per battle, only compiled in when "JOLTC_STEP_PROFILER" is defined (i.e. CMake option "STEP_PROFILER=ON"), otherwise all methods are empty inlines and "APP_GetStepProfile" returns false.
+
+Usage within a single "CalcSingleStep" is "BeginStep()" followed by one "Mark(phase)" at the end of each phase, i.e. each "Mark" attributes the time elapsed since the previous "BeginStep/Mark" to "phase".
+*/
+class StepProfiler {
+public:
+#ifdef JOLTC_STEP_PROFILER
+    static constexpr bool cEnabled = true;
+
+    StepProfiler() {
+        Reset();
+    }
+
+    inline void BeginStep() {
+        lastMarkAt = std::chrono::steady_clock::now();
+        ++stepCnt;
+    }
+
+    inline void Mark(const StepPhase phase) {
+        const auto now = std::chrono::steady_clock::now();
+        const int64_t elapsedNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastMarkAt).count();
+        lastMarkAt = now;
+        accumNanos[phase] += elapsedNanos;
+        if (elapsedNanos > maxNanos[phase]) {
+            maxNanos[phase] = elapsedNanos;
+        }
+    }
+
+    void Reset() {
+        stepCnt = 0;
+        for (int i = 0; i < StepPhaseCnt; ++i) {
+            accumNanos[i] = 0;
+            maxNanos[i] = 0;
+        }
+    }
+
+    int64_t stepCnt;
+    int64_t accumNanos[StepPhaseCnt];
+    int64_t maxNanos[StepPhaseCnt];
+
+private:
+    std::chrono::steady_clock::time_point lastMarkAt;
+#else
+    static constexpr bool cEnabled = false;
+
+    inline void BeginStep() {}
+    inline void Mark([[maybe_unused]] const StepPhase phase) {}
+    inline void Reset() {}
+#endif
+};
+
+#endif
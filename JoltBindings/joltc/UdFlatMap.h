@@ -0,0 +1,62 @@
+#ifndef UD_FLAT_MAP_H_
+#define UD_FLAT_MAP_H_ 1
+
+#include <Jolt/Jolt.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/*
+[REMINDER]
+
+A drop-in replacement of "std::unordered_map<uint64_t, V>" for the "transientUdToXxx" tables, which are cleared and refilled upon every "CalcSingleStep" (thus "rollback-chasing" of many frames used to be dominated by node allocation and hashing of "std::unordered_map").
+
+- The "ud" is already a "UDT | payload" pair where the payload is a small id (e.g. joinIndex, npcId, bulletId), therefore the slot index is derived directly from the payload (folded with the UDT), no general purpose hashing.
+- Keys are stored inline and compared upon each lookup, i.e. a "generation check" against stale "ud"s sharing the same slot (e.g. bullet ids keep increasing during a battle), collided keys are resolved by linear probing.
+- Values are stored in a flat array, "clear()" only resets the slots written since last "clear()", and capacity never shrinks -- hence no heap allocation after the first few frames.
+
+[WARNING]
+
+This class is NOT thread-safe for writing, but concurrent "count(...)" and "at(...)" are safe as long as no writer is running, same as "std::unordered_map". Unlike "std::unordered_map", references returned by "at(...)" or "operator[]" are invalidated upon growth (i.e. inserting a new key might trigger "rehash").
+
+The "V" type must be default constructible and move assignable.
+*/
+template <typename V>
+class UdFlatMap {
+public:
+    UdFlatMap(size_t initCapacity = 64);
+
+    size_t count(const uint64_t ud) const;
+    V& at(const uint64_t ud);
+    const V& at(const uint64_t ud) const;
+    V& operator[](const uint64_t ud);
+    size_t erase(const uint64_t ud);
+    void clear();
+    void reserve(size_t n);
+    size_t size() const { return liveCnt; }
+    bool empty() const { return 0 == liveCnt; }
+
+protected:
+    static constexpr uint64_t EMPTY_KEY = 0xFFFFFFFFFFFFFFFF;
+    static constexpr uint64_t TOMBSTONE_KEY = 0xFFFFFFFFFFFFFFFE;
+
+    std::vector<uint64_t> keys;
+    std::vector<V> vals;
+    std::vector<uint32_t> dirtySlots; // Slots written since last "clear()", including tombstones
+    size_t mask;
+    size_t liveCnt;
+    size_t usedCnt; // "liveCnt" + count of tombstones
+
+    inline size_t slotOf(const uint64_t ud) const {
+        const uint32_t payload = (uint32_t)(ud & 0xFFFFFFFF);
+        const uint32_t udtBits = (uint32_t)(ud >> 32);
+        return (size_t)((payload ^ (payload >> 16)) + udtBits * 0x9E3779B1u) & mask; // "payload >> 16" folds "hbIdx/sbIdx" of "UDT_XXX_HURTBOX/SHIELDBOX"
+    }
+
+    int findSlot(const uint64_t ud) const; // Returns -1 if not found
+    void rehash(size_t newCapacity);
+};
+
+#include "UdFlatMap.inl"
+
+#endif
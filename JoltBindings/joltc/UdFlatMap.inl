@@ -0,0 +1,118 @@
+template <typename V>
+inline UdFlatMap<V>::UdFlatMap(size_t initCapacity) {
+    size_t cap = 16;
+    while (cap < initCapacity) cap <<= 1;
+    keys.assign(cap, EMPTY_KEY);
+    vals.resize(cap);
+    dirtySlots.reserve(cap);
+    mask = cap - 1;
+    liveCnt = 0;
+    usedCnt = 0;
+}
+
+template <typename V>
+inline int UdFlatMap<V>::findSlot(const uint64_t ud) const {
+    size_t slot = slotOf(ud);
+    while (EMPTY_KEY != keys[slot]) {
+        if (ud == keys[slot]) return (int)slot;
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+template <typename V>
+inline size_t UdFlatMap<V>::count(const uint64_t ud) const {
+    return (-1 == findSlot(ud) ? 0 : 1);
+}
+
+template <typename V>
+inline V& UdFlatMap<V>::at(const uint64_t ud) {
+    int slot = findSlot(ud);
+    JPH_ASSERT(-1 != slot);
+    return vals[slot];
+}
+
+template <typename V>
+inline const V& UdFlatMap<V>::at(const uint64_t ud) const {
+    int slot = findSlot(ud);
+    JPH_ASSERT(-1 != slot);
+    return vals[slot];
+}
+
+template <typename V>
+inline V& UdFlatMap<V>::operator[](const uint64_t ud) {
+    int existingSlot = findSlot(ud);
+    if (-1 != existingSlot) return vals[existingSlot];
+
+    if (((usedCnt + 1) << 1) > keys.size()) {
+        // Keep load factor (including tombstones) no more than 0.5 such that probing terminates fast
+        rehash(((liveCnt + 1) << 2) > keys.size() ? (keys.size() << 1) : keys.size());
+    }
+
+    size_t slot = slotOf(ud);
+    while (EMPTY_KEY != keys[slot] && TOMBSTONE_KEY != keys[slot]) {
+        slot = (slot + 1) & mask;
+    }
+    if (EMPTY_KEY == keys[slot]) {
+        ++usedCnt;
+        dirtySlots.push_back((uint32_t)slot);
+    }
+    keys[slot] = ud;
+    vals[slot] = V();
+    ++liveCnt;
+    return vals[slot];
+}
+
+template <typename V>
+inline size_t UdFlatMap<V>::erase(const uint64_t ud) {
+    int slot = findSlot(ud);
+    if (-1 == slot) return 0;
+    keys[slot] = TOMBSTONE_KEY;
+    vals[slot] = V();
+    --liveCnt;
+    return 1;
+}
+
+template <typename V>
+inline void UdFlatMap<V>::clear() {
+    for (auto slot : dirtySlots) {
+        keys[slot] = EMPTY_KEY;
+        vals[slot] = V();
+    }
+    dirtySlots.clear();
+    liveCnt = 0;
+    usedCnt = 0;
+}
+
+template <typename V>
+inline void UdFlatMap<V>::reserve(size_t n) {
+    size_t cap = keys.size();
+    while (cap < (n << 1)) cap <<= 1;
+    if (cap == keys.size()) return;
+    rehash(cap);
+}
+
+template <typename V>
+inline void UdFlatMap<V>::rehash(size_t newCapacity) {
+    std::vector<uint64_t> oldKeys(newCapacity, EMPTY_KEY);
+    std::vector<V> oldVals(newCapacity);
+    oldKeys.swap(keys);
+    oldVals.swap(vals);
+    mask = newCapacity - 1;
+    dirtySlots.clear();
+    dirtySlots.reserve(newCapacity);
+    liveCnt = 0;
+    usedCnt = 0;
+    for (size_t i = 0; i < oldKeys.size(); ++i) {
+        if (EMPTY_KEY == oldKeys[i] || TOMBSTONE_KEY == oldKeys[i]) continue;
+        size_t slot = slotOf(oldKeys[i]);
+        while (EMPTY_KEY != keys[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        keys[slot] = oldKeys[i];
+        vals[slot] = std::move(oldVals[i]);
+        dirtySlots.push_back((uint32_t)slot);
+        ++liveCnt;
+        ++usedCnt;
+    }
+}
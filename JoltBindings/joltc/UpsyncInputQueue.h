@@ -0,0 +1,97 @@
+#ifndef UPSYNC_INPUT_QUEUE_H_
+#define UPSYNC_INPUT_QUEUE_H_ 1
+
+#include <atomic>
+#include <cstdint>
+
+typedef struct UpsyncInput {
+    uint32_t joinIndex;
+    int ifdId;
+    uint64_t input;
+    bool fromUdp;
+    bool fromTcp;
+} UpsyncInput;
+
+/*
+[REMINDER] A bounded multi-producer-single-consumer queue of "UpsyncInput", using the per-cell sequence number design of [Dmitry Vyukov's bounded MPMC queue](https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue).
+
+- "Push_ThreadSafe" is lock-free and can be called from any number of I/O threads concurrently. It returns false when the queue is full, in which case the caller may fall back to the locked "OnUpsyncSnapshotReceived" path.
+- "Pop_NotThreadSafe" MUST only be called by a single consumer, i.e. the stepping thread of the battle. A producer which has claimed a cell but not yet published it blocks the consumer at that cell, i.e. FIFO order of claiming is preserved.
+
+Unlike "RingBufferMt" (which is MOSTLY NOT thread-safe), no "FrameId" is involved here, the ordering of "ifdId" is resolved by "BackendBattle::DrainUpsyncInputs".
+*/
+class UpsyncInputQueue_ThreadSafe {
+public:
+    UpsyncInputQueue_ThreadSafe(int minCapacity) {
+        capacity = 1;
+        while (capacity < (uint64_t)minCapacity) {
+            capacity <<= 1;
+        }
+        mask = capacity - 1;
+        cells = new Cell[capacity];
+        for (uint64_t i = 0; i < capacity; ++i) {
+            cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos = 0;
+    }
+
+    UpsyncInputQueue_ThreadSafe(const UpsyncInputQueue_ThreadSafe&) = delete;
+    UpsyncInputQueue_ThreadSafe& operator=(const UpsyncInputQueue_ThreadSafe&) = delete;
+
+    ~UpsyncInputQueue_ThreadSafe() {
+        delete[] cells;
+        cells = nullptr;
+    }
+
+    bool Push_ThreadSafe(const UpsyncInput& val) {
+        uint64_t pos = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[pos & mask];
+            uint64_t seq = cell.seq.load(std::memory_order_acquire);
+            int64_t diff = (int64_t)seq - (int64_t)pos;
+            if (0 == diff) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.val = val;
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // Otherwise "pos" is reloaded by "compare_exchange_weak"
+            } else if (0 > diff) {
+                return false; // Full
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool Pop_NotThreadSafe(UpsyncInput& outVal) {
+        Cell& cell = cells[dequeuePos & mask];
+        uint64_t seq = cell.seq.load(std::memory_order_acquire);
+        if ((int64_t)seq - (int64_t)(dequeuePos + 1) < 0) {
+            return false; // Empty, or the producer of this cell hasn't published yet
+        }
+        outVal = cell.val;
+        cell.seq.store(dequeuePos + capacity, std::memory_order_release);
+        ++dequeuePos;
+        return true;
+    }
+
+    inline uint64_t GetCapacity() const {
+        return capacity;
+    }
+
+private:
+    typedef struct Cell {
+        std::atomic<uint64_t> seq;
+        UpsyncInput val;
+    } Cell;
+
+    alignas(64) std::atomic<uint64_t> enqueuePos; // Contended by producers only
+    alignas(64) uint64_t dequeuePos; // Owned by the single consumer
+    Cell* cells;
+    uint64_t capacity;
+    uint64_t mask;
+};
+
+#endif
@@ -13,6 +13,8 @@
 #include "NpcReactionConsts.h"
 #include "FrontendBattle.h"
 #include "BackendBattle.h"
+#include "BackendRoomHost.h"
+#include "StaticMapShapeCache.h"
 #include <unordered_set>
 
 #ifndef NDEBUG
@@ -32,6 +34,12 @@ std::unordered_set<uint32_t> trivialTrtSet;
 std::unordered_set<uint32_t> mixedMainAndSubCycleTrtSet;
 std::unordered_set<uint32_t> directSpawnerTrtSet;
 std::unordered_set<uint32_t> collidableTrtSet;
+std::vector<const Skill*> globalSkillConfigTable;
+std::vector<int> globalBulletConfigOffsetTable;
+std::vector<const BulletConfig*> globalBulletConfigTable;
+std::vector<const CharacterConfig*> globalCharacterConfigTable;
+std::vector<const TrapConfig*> globalTrapConfigTable;
+std::vector<const PickableConfig*> globalPickableConfigTable;
 
 bool PrimitiveConsts_Init(char* inBytes, int inBytesCnt) {
     if (nullptr != globalPrimitiveConsts) {
@@ -80,6 +88,23 @@ bool PrimitiveConsts_Init(char* inBytes, int inBytesCnt) {
     return true;
 }
 
+template <typename ConfigT>
+static void buildDenseConfigTable(const google::protobuf::Map<uint32, ConfigT>& configs, std::vector<const ConfigT*>& outTable) {
+    // Ids at or beyond "cMaxDenseConfigId" are left to the map fallback of "LookupXxxConfig", see "PbConsts.h".
+    uint32_t tableSize = 0;
+    for (auto& it : configs) {
+        if (it.first < cMaxDenseConfigId && it.first >= tableSize) {
+            tableSize = it.first + 1;
+        }
+    }
+    outTable.assign(tableSize, nullptr);
+    for (auto& it : configs) {
+        if (it.first < tableSize) {
+            outTable[it.first] = &(it.second);
+        }
+    }
+}
+
 bool ConfigConsts_Init(char* inBytes, int inBytesCnt) {
     if (nullptr != globalConfigConsts) {
         delete globalConfigConsts;
@@ -87,6 +112,22 @@ bool ConfigConsts_Init(char* inBytes, int inBytesCnt) {
     ConfigConsts tmp;
     tmp.ParseFromArray(inBytes, inBytesCnt);
     globalConfigConsts = new ConfigConsts(tmp);
+
+    buildDenseConfigTable(globalConfigConsts->character_configs(), globalCharacterConfigTable);
+    buildDenseConfigTable(globalConfigConsts->trap_configs(), globalTrapConfigTable);
+    buildDenseConfigTable(globalConfigConsts->pickable_configs(), globalPickableConfigTable);
+    buildDenseConfigTable(globalConfigConsts->skill_configs(), globalSkillConfigTable);
+
+    globalBulletConfigOffsetTable.assign(globalSkillConfigTable.size(), 0);
+    globalBulletConfigTable.clear();
+    for (size_t skillId = 0; skillId < globalSkillConfigTable.size(); ++skillId) {
+        globalBulletConfigOffsetTable[skillId] = (int)globalBulletConfigTable.size();
+        const Skill* skill = globalSkillConfigTable[skillId];
+        if (nullptr == skill) continue;
+        for (int i = 0; i < skill->hits_size(); ++i) {
+            globalBulletConfigTable.push_back(&(skill->hits(i)));
+        }
+    }
     return true;
 }
 
@@ -113,13 +154,43 @@ bool JPH_Init(int nBytesForTempAllocator)
     return true;
 }
 
+static JobSystemThreadPool* sharedJobSys = nullptr;
+bool JPH_InitSharedJobSystem(int nThreads) {
+    if (nullptr != sharedJobSys) return false;
+    if (0 >= nThreads) {
+        nThreads = thread::hardware_concurrency() - 1;
+    }
+    sharedJobSys = new JobSystemThreadPool(cMaxPhysicsJobs*cMaxConcurrentBattlesPerSharedJobSys, cMaxPhysicsBarriers*cMaxConcurrentBattlesPerSharedJobSys, nThreads);
+    return true;
+}
+
+bool JPH_SaveStaticMapCache(const char* filePath) {
+    return StaticMapShapeCache::SaveToFile(filePath);
+}
+
+bool JPH_LoadStaticMapCache(const char* filePath) {
+    return StaticMapShapeCache::LoadFromFile(filePath);
+}
+
+void JPH_ClearStaticMapCache(void) {
+    StaticMapShapeCache::Clear();
+}
+
 bool JPH_Shutdown(void)
 {
+    if (nullptr != sharedJobSys) {
+        delete sharedJobSys;
+        sharedJobSys = nullptr;
+    }
+
     if (nullptr != globalTempAllocator) {
         delete globalTempAllocator;
         globalTempAllocator = nullptr;
     } 
 
+    // Releases the shared static map shapes before their types are unregistered
+    StaticMapShapeCache::Clear();
+
     // Unregisters all types with the factory and cleans up the default material
     JPH::UnregisterTypes();
 
@@ -190,6 +261,35 @@ bool APP_GetIfd(void* inBattle, int inIfdId, char* outBytesPreallocatedStart, lo
      return battle->SetFrameLogEnabled(val);
 }
 
+bool APP_SetStaticBarrierMergeEnabled(void* inBattle, bool val) {
+    BaseBattle* battle = static_cast<BaseBattle*>(inBattle);
+    if (nullptr == battle) return false;
+    return battle->SetStaticBarrierMergeEnabled(val);
+}
+
+bool APP_GetStepProfile(void* inBattle, int64_t* outStepCnt, int64_t* outAccumNanos, int64_t* outMaxNanos, int phaseCntLimit, int* outPhaseCnt, bool resetAfterRead) {
+    BaseBattle* battle = static_cast<BaseBattle*>(inBattle);
+    if (nullptr == battle) return false;
+#ifdef JOLTC_STEP_PROFILER
+    StepProfiler& profiler = battle->stepProfiler;
+    int phaseCnt = (StepPhaseCnt < phaseCntLimit ? StepPhaseCnt : phaseCntLimit);
+    *outStepCnt = profiler.stepCnt;
+    for (int i = 0; i < phaseCnt; ++i) {
+        outAccumNanos[i] = profiler.accumNanos[i];
+        outMaxNanos[i] = profiler.maxNanos[i];
+    }
+    *outPhaseCnt = phaseCnt;
+    if (resetAfterRead) {
+        profiler.Reset();
+    }
+    return true;
+#else
+    *outStepCnt = 0;
+    *outPhaseCnt = 0;
+    return false;
+#endif
+}
+
 bool APP_GetFrameLog(void* inBattle, int inRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit) {
     BaseBattle* battle = static_cast<BaseBattle*>(inBattle);
     if (nullptr == battle) return false;
@@ -217,6 +317,17 @@ bool APP_GetFrameLog(void* inBattle, int inRdfId, char* outBytesPreallocatedStar
     return true;
 }
 
+bool APP_GetRdfChecksum(void* inBattle, int inRdfId, uint64_t* outChecksum) {
+    BaseBattle* battle = static_cast<BaseBattle*>(inBattle);
+    if (nullptr == battle) return false;
+    RenderFrame* rdf = battle->rdfBuffer.GetByFrameId(inRdfId);
+    if (nullptr == rdf) {
+        return false;
+    }
+    *outChecksum = rdf->checksum();
+    return true;
+}
+
 bool APP_GetStepResult(void* inBattle, int inRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit) {
     BaseBattle* battle = static_cast<BaseBattle*>(inBattle);
     if (nullptr == battle) return false;
@@ -323,9 +434,9 @@ int APP_ConvertToLastUsedRenderFrameId(int inputFrameId) {
     return BaseBattle::ConvertToLastUsedRenderFrameId(inputFrameId);
 }
 
-void* BACKEND_CreateBattle(int rdfBufferSize) {
+void* BACKEND_CreateBattle(int rdfBufferSize, int nBytesForTempAllocator) {
     // There's NO rollback on backend, so no need for a big "rdfBufferSize". 
-    BackendBattle* result = new BackendBattle(rdfBufferSize, globalPrimitiveConsts->default_backend_input_buffer_size(), globalTempAllocator);
+    BackendBattle* result = new BackendBattle(rdfBufferSize, globalPrimitiveConsts->default_backend_input_buffer_size(), globalTempAllocator, nBytesForTempAllocator, sharedJobSys);
 #ifndef NDEBUG
     Debug::Log("BACKEND_CreateBattle/C++", DColor::Green);
 #endif
@@ -362,8 +473,104 @@ int BACKEND_GetDynamicsRdfId(void* inBattle) {
     return backendBattle->GetDynamicsRdfId();
 }
 
-void* FRONTEND_CreateBattle(int rdfBufferSize, bool isOnlineArenaMode) {
-    FrontendBattle* result = new FrontendBattle(rdfBufferSize, (rdfBufferSize >> (globalPrimitiveConsts->input_scale_frames() >> 1)) + 1, globalTempAllocator, isOnlineArenaMode);
+bool BACKEND_SetRefRdfDeltaEnabled(void* inBattle, bool val) {
+    auto backendBattle = static_cast<BackendBattle*>(inBattle);
+    if (nullptr == backendBattle) return false;
+    return backendBattle->SetRefRdfDeltaEnabled(val);
+}
+
+bool BACKEND_EnqueueUpsyncInput(void* inBattle, uint32_t joinIndex, int ifdId, uint64_t input, bool fromUdp, bool fromTcp) {
+    auto backendBattle = static_cast<BackendBattle*>(inBattle);
+    if (nullptr == backendBattle) return false;
+    return backendBattle->EnqueueUpsyncInput(joinIndex, ifdId, input, fromUdp, fromTcp);
+}
+
+int BACKEND_DrainUpsyncInputs(void* inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit) {
+    auto backendBattle = static_cast<BackendBattle*>(inBattle);
+    if (nullptr == backendBattle) return 0;
+    return backendBattle->DrainUpsyncInputs(outBytesPreallocatedStart, outBytesCntLimit);
+}
+
+bool BACKEND_TakeUnfitDownsyncSnapshot(void* inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit) {
+    auto backendBattle = static_cast<BackendBattle*>(inBattle);
+    if (nullptr == backendBattle) return false;
+    return backendBattle->TakeUnfitDownsyncSnapshot(outBytesPreallocatedStart, outBytesCntLimit);
+}
+
+int BACKEND_SetIfdBufferSizeCap(void* inBattle, int cap) {
+    auto backendBattle = static_cast<BackendBattle*>(inBattle);
+    if (nullptr == backendBattle) return 0;
+    return backendBattle->SetIfdBufferSizeCap(cap);
+}
+
+int BACKEND_GetFirstDesyncedRdfId(void* inBattle, uint32_t joinIndex) {
+    auto backendBattle = static_cast<BackendBattle*>(inBattle);
+    if (nullptr == backendBattle) return globalPrimitiveConsts->terminating_render_frame_id();
+    return backendBattle->GetFirstDesyncedRdfId(joinIndex);
+}
+
+void* HOST_Create(int maxRoomsCnt, int nWorkers, int rdfBufferSize, int nBytesForTempAllocatorPerRoom, int downsyncBytesCntLimitPerRoom) {
+    if (0 >= maxRoomsCnt || 0 >= nBytesForTempAllocatorPerRoom) {
+        // [WARNING] Rooms are stepped concurrently by "BackendRoomHost::StepAll", thus MUST NOT share "globalTempAllocator" which is a stack allocator.
+#ifndef NDEBUG
+        std::ostringstream oss;
+        oss << "HOST_Create/C++ rejected maxRoomsCnt=" << maxRoomsCnt << ", nBytesForTempAllocatorPerRoom=" << nBytesForTempAllocatorPerRoom;
+        Debug::Log(oss.str(), DColor::Orange);
+#endif
+        return nullptr;
+    }
+    BackendRoomHost* result = new BackendRoomHost(maxRoomsCnt, nWorkers, rdfBufferSize, nBytesForTempAllocatorPerRoom, downsyncBytesCntLimitPerRoom, globalTempAllocator, sharedJobSys);
+#ifndef NDEBUG
+    Debug::Log("HOST_Create/C++", DColor::Green);
+#endif
+    return result;
+}
+
+bool HOST_Destroy(void* inHost) {
+    auto host = static_cast<BackendRoomHost*>(inHost);
+    if (nullptr == host) return false;
+    delete host;
+    return true;
+}
+
+int HOST_AddRoom(void* inHost, char* inBytes, int inBytesCnt) {
+    auto host = static_cast<BackendRoomHost*>(inHost);
+    if (nullptr == host) return -1;
+    return host->AddRoom(inBytes, inBytesCnt);
+}
+
+void* HOST_GetRoomBattle(void* inHost, int roomId) {
+    auto host = static_cast<BackendRoomHost*>(inHost);
+    if (nullptr == host) return nullptr;
+    return host->GetRoomBattle(roomId);
+}
+
+bool HOST_SubmitUpsync(void* inHost, int roomId, char* inBytes, int inBytesCnt, bool fromUdp, bool fromTcp) {
+    auto host = static_cast<BackendRoomHost*>(inHost);
+    if (nullptr == host) return false;
+    return host->SubmitUpsync(roomId, inBytes, inBytesCnt, fromUdp, fromTcp);
+}
+
+bool HOST_SubmitUpsyncInput(void* inHost, int roomId, uint32_t joinIndex, int ifdId, uint64_t input, bool fromUdp, bool fromTcp) {
+    auto host = static_cast<BackendRoomHost*>(inHost);
+    if (nullptr == host) return false;
+    return host->SubmitUpsyncInput(roomId, joinIndex, ifdId, input, fromUdp, fromTcp);
+}
+
+int HOST_StepAll(void* inHost, bool withRefRdf) {
+    auto host = static_cast<BackendRoomHost*>(inHost);
+    if (nullptr == host) return 0;
+    return host->StepAll(withRefRdf);
+}
+
+bool HOST_CollectDownsyncs(void* inHost, char* outBytesPreallocatedStart, long* outBytesCntLimit) {
+    auto host = static_cast<BackendRoomHost*>(inHost);
+    if (nullptr == host) return false;
+    return host->CollectDownsyncs(outBytesPreallocatedStart, outBytesCntLimit);
+}
+
+void* FRONTEND_CreateBattle(int rdfBufferSize, bool isOnlineArenaMode, int nBytesForTempAllocator) {
+    FrontendBattle* result = new FrontendBattle(rdfBufferSize, (rdfBufferSize >> (globalPrimitiveConsts->input_scale_frames() >> 1)) + 1, globalTempAllocator, isOnlineArenaMode, nBytesForTempAllocator, sharedJobSys);
 #ifndef NDEBUG
     Debug::Log("FRONTEND_CreateBattle/C++", DColor::Green);
 #endif
@@ -418,6 +625,18 @@ bool FRONTEND_ChaseRolledBackRdfs(void* inBattle, int* outChaserRdfId, bool toTi
     return frontendBattle->ChaseRolledBackRdfs(outChaserRdfId, toTimerRdfId);
 }
 
+bool FRONTEND_ChaseRolledBackRdfsWithBudget(void* inBattle, int budgetMicros, int* outChaserRdfId, int* outChasedRdfCnt) {
+    auto frontendBattle = static_cast<FrontendBattle*>(inBattle);
+    if (nullptr == frontendBattle) return false;
+    return frontendBattle->ChaseRolledBackRdfsWithBudget(budgetMicros, outChaserRdfId, outChasedRdfCnt);
+}
+
+bool FRONTEND_GetRollbackStats(void* inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit, bool resetAfterRead) {
+    auto frontendBattle = static_cast<FrontendBattle*>(inBattle);
+    if (nullptr == frontendBattle) return false;
+    return frontendBattle->GetRollbackStats(outBytesPreallocatedStart, outBytesCntLimit, resetAfterRead);
+}
+
 bool FRONTEND_GetRdfAndIfdIds(void* inBattle, int* outTimerRdfId, int* outChaserRdfId, int* outChaserRdfIdLowerBound, int* outLcacIfdId, int* outUdpLcacIfdId, int* outTimerRdfIdGenIfdId, int* outTimerRdfIdToUseIfdId) {
     auto frontendBattle = static_cast<FrontendBattle*>(inBattle);
     if (nullptr == frontendBattle) return false;
@@ -39,6 +39,18 @@ JPH_CAPI bool ConfigConsts_Init(char* inBytes, int inBytesCnt);
 JPH_CAPI bool JPH_Init(int nBytesForTempAllocator);
 JPH_CAPI bool JPH_Shutdown(void);
 
+/*
+[REMINDER] Creates a process-wide "JobSystemThreadPool" with "nThreads" worker threads (or "hardware_concurrency() - 1" if "nThreads <= 0"), which will then be borrowed by all battles created afterwards by "BACKEND_CreateBattle" and "FRONTEND_CreateBattle" -- instead of each battle spinning up its own pool. Must be called after "JPH_Init", and the pool is only destroyed in "JPH_Shutdown", i.e. all battles borrowing it MUST be destroyed before "JPH_Shutdown". At most "cMaxConcurrentBattlesPerSharedJobSys" battles borrow it at the same time, any battle created beyond that falls back to its own pool.
+*/
+JPH_CAPI bool JPH_InitSharedJobSystem(int nThreads);
+
+/*
+[REMINDER] Static map shapes cooked by "BACKEND_ResetStartRdf" and "FRONTEND_ResetStartRdf" are cached process-wide per map geometry and shared by all later battles of the same map, see "StaticMapShapeCache". The cache can be persisted by "JPH_SaveStaticMapCache" and warmed up by "JPH_LoadStaticMapCache" (both after "JPH_Init"), it's cleared in "JPH_Shutdown". "JPH_LoadStaticMapCache" returns false and loads nothing if the file was written by a different cooking logic, Jolt version or build flags.
+*/
+JPH_CAPI bool JPH_SaveStaticMapCache(const char* filePath);
+JPH_CAPI bool JPH_LoadStaticMapCache(const char* filePath);
+JPH_CAPI void JPH_ClearStaticMapCache(void);
+
 /*
 Kindly note that in Jolt, the default gravity direction is negative-y.
 */
@@ -48,7 +60,13 @@ JPH_CAPI bool APP_GetRdf(void* inBattle, int inRdfId, char* outBytesPreallocated
 JPH_CAPI bool APP_GetIfd(void* inBattle, int inIfdId, char* outBytesPreallocatedStart, long* outBytesCntLimit);
 JPH_CAPI bool APP_GetRdfBufferBounds(void* inBattle, int* outStRdfId, int* outEdRdfId);
 JPH_CAPI bool APP_SetFrameLogEnabled(void* inBattle, bool val);
+JPH_CAPI bool APP_SetStaticBarrierMergeEnabled(void* inBattle, bool val); // Returns the old value. Takes effect upon the next "ResetStartRdf" and MUST be set identically by all peers, see "BaseBattle.staticBarrierMergeEnabled".
 JPH_CAPI bool APP_GetFrameLog(void* inBattle, int inRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit);
+/*
+Per-phase wall time of "CalcSingleStep" accumulated since battle creation or the last reset, "outAccumNanos/outMaxNanos" are indexed by "StepPhase" (see "StepProfiler.h") and filled up to "min(StepPhaseCnt, phaseCntLimit)" entries. Returns false if the library is built without CMake option "STEP_PROFILER".
+*/
+JPH_CAPI bool APP_GetStepProfile(void* inBattle, int64_t* outStepCnt, int64_t* outAccumNanos, int64_t* outMaxNanos, int phaseCntLimit, int* outPhaseCnt, bool resetAfterRead = false);
+JPH_CAPI bool APP_GetRdfChecksum(void* inBattle, int inRdfId, uint64_t* outChecksum);
 JPH_CAPI bool APP_GetStepResult(void* inBattle, int inRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit);
 JPH_CAPI uint64_t APP_SetPlayerActive(void* inBattle, uint32_t joinIndex); // returns the new value
 JPH_CAPI uint64_t APP_SetPlayerInactive(void* inBattle, uint32_t joinIndex); // returns the new value
@@ -80,14 +98,47 @@ The equivalent to [DLLMU-v2.3.4 "inputBufferLock"](https://github.com/genxium/De
 
 Note that in addition to guarding write-operations to "inputBuffer/ifdBuffer", "inputBufferLock" MUST also guard "sending of DownsyncSnapshot" (or more efficiently, just also guard "FIFO-enqueuing of DownsyncSnapshot for async polling and sending") to preserve the same "order of message sending" as the "order of message generation", i.e. order of "DownsyncSnapshot.st_ifd_id" received on frontend via TCP must be non-descending, see https://github.com/genxium/DelayNoMoreUnity/blob/v2.3.4/backend/Battle/Room.cs#L1371 for more information.
 */
-JPH_CAPI void* BACKEND_CreateBattle(int rdfBufferSize);
+/*
+[REMINDER] When "nBytesForTempAllocator > 0", the created battle owns a "TempAllocatorImplWithMallocFallback" of that size for "PhysicsSystem::Update", thus is safe to be stepped concurrently with other battles on different threads; otherwise it falls back to the global one created in "JPH_Init", which is shared by all battles.
+*/
+JPH_CAPI void* BACKEND_CreateBattle(int rdfBufferSize, int nBytesForTempAllocator);
 JPH_CAPI bool BACKEND_ResetStartRdf(void* inBattle, char* inBytes, int inBytesCnt);
 JPH_CAPI bool BACKEND_OnUpsyncSnapshotReqReceived(void* inBattle, char* inBytes, int inBytesCnt, bool fromUdp, bool fromTcp, char* outBytesPreallocatedStart, long* outBytesCntLimit, int* outStEvictedCnt, int* outOldLcacIfdId, int* outNewLcacIfdId, int* outOldDynamicsRdfId, int* outNewDynamicsRdfId, int* outMaxPlayerInputFrontId, int* outMinPlayerInputFrontId); // [WARNING] Possibly writes "DownsyncSnapshot" into "outBytesPreallocatedStart" 
 JPH_CAPI int BACKEND_Step(void* inBattle, int fromRdfId, int toRdfId);
 JPH_CAPI int BACKEND_MoveForwardLcacIfdIdAndStep(void* inBattle, bool withRefRdf, int* outOldLcacIfdId, int* outNewLcacIfdId, int* outOldDynamicsRdfId, int* outNewDynamicsRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit);
 JPH_CAPI int BACKEND_GetDynamicsRdfId(void* inBattle);
+JPH_CAPI bool BACKEND_TakeUnfitDownsyncSnapshot(void* inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit); // When "BACKEND_OnUpsyncSnapshotReqReceived" or "BACKEND_MoveForwardLcacIfdIdAndStep" produced a "DownsyncSnapshot" larger than "*outBytesCntLimit", it's kept in the battle and "*outBytesCntLimit" is set to its size (i.e. larger than the one passed in), the caller MUST fetch it by this function with a large enough buffer before any further upsync or step. Returns false if there's none or the buffer is still insufficient.
+JPH_CAPI bool BACKEND_SetRefRdfDeltaEnabled(void* inBattle, bool val); // Returns the old value. When enabled, "BACKEND_MoveForwardLcacIfdIdAndStep(withRefRdf=true)" attaches "DownsyncSnapshot.ref_rdf_delta" instead of a full "ref_rdf" once all active players have acknowledged the previous one, see "BackendBattle.refRdfDeltaEnabled".
+/*
+[REMINDER] "BACKEND_EnqueueUpsyncInput" is the only "BACKEND_Xxx" function which is thread-safe, it pushes a single "(joinIndex, ifdId, input)" into a lock-free queue of the battle without the need of "inputBufferLock", returns false if the queue is full. The queued inputs are applied by "BACKEND_DrainUpsyncInputs", which MUST be called by the stepping thread (still under "inputBufferLock" if "BACKEND_OnUpsyncSnapshotReqReceived" is also in use) right before "BACKEND_MoveForwardLcacIfdIdAndStep". Any produced "DownsyncSnapshot" is written into "outBytesPreallocatedStart" as "[int32_t bytesCnt][bytesCnt bytes]" in native byte order, keep calling it till it returns 0 (i.e. the count of applied inputs). A "DownsyncSnapshot" that doesn't fit is never dropped, instead the draining stops and it's kept for "BACKEND_TakeUnfitDownsyncSnapshot", which MUST be called before the next drain, see "BackendBattle::DrainUpsyncInputs".
+*/
+JPH_CAPI bool BACKEND_EnqueueUpsyncInput(void* inBattle, uint32_t joinIndex, int ifdId, uint64_t input, bool fromUdp, bool fromTcp);
+JPH_CAPI int BACKEND_DrainUpsyncInputs(void* inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit);
+JPH_CAPI int BACKEND_SetIfdBufferSizeCap(void* inBattle, int cap); // Returns the old value. Allows "ifdBuffer" to grow in place up to "cap" instead of force-confirming inputs of a lagging player, see "BackendBattle.ifdBufferSizeCap". Rooms of "HOST_Xxx" can be configured via "HOST_GetRoomBattle".
+JPH_CAPI int BACKEND_GetFirstDesyncedRdfId(void* inBattle, uint32_t joinIndex); // Returns the earliest "rdfId" whose "UpsyncSnapshot.checksum" reported by "joinIndex" mismatched the backend counterpart, or "terminating_render_frame_id" if none.
+
+/*
+[REMINDER] 
+
+These "HOST_Xxx" functions wrap a "BackendRoomHost", which owns multiple "BackendBattle" instances (i.e. rooms) and applies the per-room "inputBufferLock" by itself, i.e. unlike "BACKEND_Xxx" functions the caller doesn't need to lock anything. 
+
+- "HOST_Create" takes "nWorkers <= 0" as "hardware_concurrency() - 1", and each room owns a temp allocator of "nBytesForTempAllocatorPerRoom" bytes (see comments of "BACKEND_CreateBattle"). Rooms are stepped concurrently, thus "nBytesForTempAllocatorPerRoom <= 0" (i.e. all rooms sharing the global temp allocator) is rejected by returning nullptr. Rooms borrow the shared job system if "JPH_InitSharedJobSystem" was called before "HOST_Create".
+- "HOST_AddRoom" takes the same "inBytes" as "BACKEND_ResetStartRdf" and returns the "roomId", or -1 upon failure. It's NOT thread-safe against "HOST_AddRoom" or "HOST_StepAll".
+- "HOST_SubmitUpsync" takes the same "inBytes" as "BACKEND_OnUpsyncSnapshotReqReceived", any produced "DownsyncSnapshot" is queued in the room. A "DownsyncSnapshot" larger than "downsyncBytesCntLimitPerRoom" is still queued, by growing the scratch buffer of the room.
+- "HOST_SubmitUpsyncInput" pushes a single "(joinIndex, ifdId, input)" into a lock-free queue of the room without contending its "inputBufferLock", returns false if the queue is full. Queued inputs are applied at the beginning of the next "HOST_StepAll".
+- "HOST_StepAll" drains the queued inputs of "HOST_SubmitUpsyncInput" and then calls "BackendBattle::MoveForwardLcacIfdIdAndStep" for all rooms in parallel, any produced "DownsyncSnapshot" is queued in the room, returns the count of rooms that produced one.
+- "HOST_CollectDownsyncs" drains all queued "DownsyncSnapshot"s into "outBytesPreallocatedStart", each framed as "[int32_t roomId][int32_t bytesCnt][bytesCnt bytes]" in native byte order and in the order of generation per room. Returns false if some room was left uncollected due to "outBytesCntLimit".
+*/
+JPH_CAPI void* HOST_Create(int maxRoomsCnt, int nWorkers, int rdfBufferSize, int nBytesForTempAllocatorPerRoom, int downsyncBytesCntLimitPerRoom);
+JPH_CAPI bool HOST_Destroy(void* inHost);
+JPH_CAPI int HOST_AddRoom(void* inHost, char* inBytes, int inBytesCnt);
+JPH_CAPI void* HOST_GetRoomBattle(void* inHost, int roomId); // The returned battle can be used with "APP_Xxx" functions, but MUST NOT be destroyed by "APP_DestroyBattle"
+JPH_CAPI bool HOST_SubmitUpsync(void* inHost, int roomId, char* inBytes, int inBytesCnt, bool fromUdp, bool fromTcp);
+JPH_CAPI bool HOST_SubmitUpsyncInput(void* inHost, int roomId, uint32_t joinIndex, int ifdId, uint64_t input, bool fromUdp, bool fromTcp);
+JPH_CAPI int HOST_StepAll(void* inHost, bool withRefRdf);
+JPH_CAPI bool HOST_CollectDownsyncs(void* inHost, char* outBytesPreallocatedStart, long* outBytesCntLimit);
 
-JPH_CAPI void* FRONTEND_CreateBattle(int rdfBufferSize, bool isOnlineArenaMode);
+JPH_CAPI void* FRONTEND_CreateBattle(int rdfBufferSize, bool isOnlineArenaMode, int nBytesForTempAllocator); // See comments of "BACKEND_CreateBattle" for "nBytesForTempAllocator"
 JPH_CAPI bool FRONTEND_ResetStartRdf(void* inBattle, char* inBytes, int inBytesCnt, const uint32_t inSelfJoinIndex, const char * const inSelfPlayerId, const int inSelfCmdAuthKey);
 JPH_CAPI bool FRONTEND_UpsertSelfCmd(void* inBattle, uint64_t inSingleInput, int* outChaserRdfId);
 JPH_CAPI bool FRONTEND_UpsertSelfCmd_With_Ifd_Output(void* inBattle, uint64_t inSingleInput, int* outChaserRdfId, char* outBytesPreallocatedStart, long* outBytesCntLimit);
@@ -96,6 +147,8 @@ JPH_CAPI bool FRONTEND_OnUpsyncSnapshotReqReceived(void* inBattle, char* inBytes
 JPH_CAPI bool FRONTEND_OnDownsyncSnapshotReceived(void* inBattle, char* inBytes, int inBytesCnt, int* outPostTimerRdfEvictedCnt, int* outPostTimerRdfDelayedIfdEvictedCnt, int* outChaserRdfId, int* outLcacIfdId, int* outUdpLcacIfdId, int* outMaxPlayerInputFrontId, int* outMinPlayerInputFrontId);
 JPH_CAPI bool FRONTEND_Step(void* inBattle);
 JPH_CAPI bool FRONTEND_ChaseRolledBackRdfs(void* inBattle, int* outNewChaserRdfId, bool toTimerRdfId = false);
+JPH_CAPI bool FRONTEND_ChaseRolledBackRdfsWithBudget(void* inBattle, int budgetMicros, int* outNewChaserRdfId, int* outChasedRdfCnt);
+JPH_CAPI bool FRONTEND_GetRollbackStats(void* inBattle, char* outBytesPreallocatedStart, long* outBytesCntLimit, bool resetAfterRead = false);
 JPH_CAPI bool FRONTEND_GetRdfAndIfdIds(void* inBattle, int* outTimerRdfId, int* outChaserRdfId, int* outChaserRdfIdLowerBound, int* outLcacIfdId, int* outUdpLcacIfdId, int* outTimerRdfIdGenIfdId, int* outTimerRdfIdToUseIfdId);
 
 #endif /* JOLT_C_H_ */
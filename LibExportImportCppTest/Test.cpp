@@ -191,7 +191,7 @@ int main(int argc, char** argv)
     uint32_t selfJoinIndex = 1;
     const char * const selfPlayerId = "foobar";
     const int selfCmdAuthKey = 123456;
-    FrontendBattle* battle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, false));
+    FrontendBattle* battle = static_cast<FrontendBattle*>(FRONTEND_CreateBattle(512, false, 0));
     std::cout << "Created battle = " << battle << std::endl;
 
     bool resetStartRdfRes = FRONTEND_ResetStartRdf(battle, pbByteBuffer, (int)byteSize, selfJoinIndex, selfPlayerId, selfCmdAuthKey);
@@ -378,8 +378,8 @@ public class SteamOnlineMapController : AbstractJoltMapController {
         });
 
         int rdfBufferSize = 60*PbPrimitivesOverride.BATTLE_DYNAMICS_FPS;
-        battle = Bindings.FRONTEND_CreateBattle(rdfBufferSize, true);
-        shadowBattle = Bindings.BACKEND_CreateBattle(rdfBufferSize);
+        battle = Bindings.FRONTEND_CreateBattle(rdfBufferSize, true, 0);
+        shadowBattle = Bindings.BACKEND_CreateBattle(rdfBufferSize, 0);
 
         characterSelectPanel.SetCallbacks(this, uiSoundSource, () => {
             SceneManager.LoadScene(PlayerSettingsManager.Instance.GetLoginSceneName(), LoadSceneMode.Single);